@@ -225,6 +225,7 @@ void SetLayout(layer_data *device_data, GLOBAL_CB_NODE *pCB, ImageSubresourcePai
 // Set image layout for given VkImageSubresourceRange struct
 void SetImageLayout(layer_data *device_data, GLOBAL_CB_NODE *cb_node, const IMAGE_STATE *image_state,
                     VkImageSubresourceRange image_subresource_range, const VkImageLayout &layout) {
+    if (GetDisables(device_data)->image_layouts) return;
     assert(image_state);
     for (uint32_t level_index = 0; level_index < image_subresource_range.levelCount; ++level_index) {
         uint32_t level = image_subresource_range.baseMipLevel + level_index;
@@ -276,6 +277,7 @@ bool VerifyFramebufferAndRenderPassLayouts(layer_data *device_data, GLOBAL_CB_NO
                         "You cannot start a render pass using a framebuffer "
                         "with a different number of attachments.");
     }
+    if (GetDisables(device_data)->image_layouts) return skip;
     for (uint32_t i = 0; i < pRenderPassInfo->attachmentCount; ++i) {
         const VkImageView &image_view = framebufferInfo.pAttachments[i];
         auto view_state = GetImageViewState(device_data, image_view);
@@ -320,6 +322,7 @@ void TransitionAttachmentRefLayout(layer_data *device_data, GLOBAL_CB_NODE *pCB,
 
 void TransitionSubpassLayouts(layer_data *device_data, GLOBAL_CB_NODE *pCB, const RENDER_PASS_STATE *render_pass_state,
                               const int subpass_index, FRAMEBUFFER_STATE *framebuffer_state) {
+    if (GetDisables(device_data)->image_layouts) return;
     assert(render_pass_state);
 
     if (framebuffer_state) {
@@ -366,6 +369,7 @@ bool ValidateImageAspectLayout(layer_data *device_data, GLOBAL_CB_NODE *pCB, con
 // 2. Transition from initialLayout to layout used in subpass 0
 void TransitionBeginRenderPassLayouts(layer_data *device_data, GLOBAL_CB_NODE *cb_state, const RENDER_PASS_STATE *render_pass_state,
                                       FRAMEBUFFER_STATE *framebuffer_state) {
+    if (GetDisables(device_data)->image_layouts) return;
     // First transition into initialLayout
     auto const rpci = render_pass_state->createInfo.ptr();
     for (uint32_t i = 0; i < rpci->attachmentCount; ++i) {
@@ -489,6 +493,8 @@ bool ValidateBarriersToImages(layer_data *device_data, VkCommandBuffer cmdBuffer
                             string_VkFormat(image_create_info->format), aspect_mask, validation_error_map[VALIDATION_ERROR_00302]);
             }
         }
+        if (GetDisables(device_data)->image_layouts) continue;
+
         uint32_t level_count = ResolveRemainingLevels(&img_barrier->subresourceRange, image_create_info->mipLevels);
         uint32_t layer_count = ResolveRemainingLayers(&img_barrier->subresourceRange, image_create_info->arrayLayers);
 
@@ -515,6 +521,7 @@ bool ValidateBarriersToImages(layer_data *device_data, VkCommandBuffer cmdBuffer
 
 void TransitionImageLayouts(layer_data *device_data, VkCommandBuffer cmdBuffer, uint32_t memBarrierCount,
                             const VkImageMemoryBarrier *pImgMemBarriers) {
+    if (GetDisables(device_data)->image_layouts) return;
     GLOBAL_CB_NODE *pCB = GetCBNode(device_data, cmdBuffer);
 
     for (uint32_t i = 0; i < memBarrierCount; ++i) {
@@ -541,6 +548,7 @@ void TransitionImageLayouts(layer_data *device_data, VkCommandBuffer cmdBuffer,
 bool VerifyImageLayout(layer_data const *device_data, GLOBAL_CB_NODE const *cb_node, IMAGE_STATE *image_state,
                        VkImageSubresourceLayers subLayers, VkImageLayout explicit_layout, VkImageLayout optimal_layout,
                        const char *caller, UNIQUE_VALIDATION_ERROR_CODE msg_code, bool *error) {
+    if (GetDisables(device_data)->image_layouts) return false;
     const auto report_data = core_validation::GetReportData(device_data);
     const auto image = image_state->image;
     bool skip = false;
@@ -587,6 +595,7 @@ bool VerifyImageLayout(layer_data const *device_data, GLOBAL_CB_NODE const *cb_n
 
 void TransitionFinalSubpassLayouts(layer_data *device_data, GLOBAL_CB_NODE *pCB, const VkRenderPassBeginInfo *pRenderPassBegin,
                                    FRAMEBUFFER_STATE *framebuffer_state) {
+    if (GetDisables(device_data)->image_layouts) return;
     auto renderPass = GetRenderPassState(device_data, pRenderPassBegin->renderPass);
     if (!renderPass) return;
 
@@ -864,6 +873,7 @@ uint32_t ResolveRemainingLayers(const VkImageSubresourceRange *range, uint32_t l
 
 bool VerifyClearImageLayout(layer_data *device_data, GLOBAL_CB_NODE *cb_node, IMAGE_STATE *image_state,
                             VkImageSubresourceRange range, VkImageLayout dest_image_layout, const char *func_name) {
+    if (GetDisables(device_data)->image_layouts) return false;
     bool skip = false;
     const debug_report_data *report_data = core_validation::GetReportData(device_data);
 
@@ -923,6 +933,7 @@ bool VerifyClearImageLayout(layer_data *device_data, GLOBAL_CB_NODE *cb_node, IM
 
 void RecordClearImageLayout(layer_data *device_data, GLOBAL_CB_NODE *cb_node, VkImage image, VkImageSubresourceRange range,
                             VkImageLayout dest_image_layout) {
+    if (GetDisables(device_data)->image_layouts) return;
     VkImageCreateInfo *image_create_info = &(GetImageState(device_data, image)->createInfo);
     uint32_t level_count = ResolveRemainingLevels(&range, image_create_info->mipLevels);
     uint32_t layer_count = ResolveRemainingLayers(&range, image_create_info->arrayLayers);
@@ -967,11 +978,7 @@ void PreCallRecordCmdClearImage(layer_data *dev_data, VkCommandBuffer commandBuf
     auto image_state = GetImageState(dev_data, image);
     if (cb_node && image_state) {
         AddCommandBufferBindingImage(dev_data, cb_node, image_state);
-        std::function<bool()> function = [=]() {
-            SetImageMemoryValid(dev_data, image_state, true);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        core_validation::AddDeferredImageMemoryUpdate(cb_node, image_state, true);
         core_validation::UpdateCmdBufferLastCmd(cb_node, cmd_type);
         for (uint32_t i = 0; i < rangeCount; ++i) {
             RecordClearImageLayout(dev_data, cb_node, image, pRanges[i], imageLayout);
@@ -1524,13 +1531,8 @@ void PreCallRecordCmdCopyImage(layer_data *device_data, GLOBAL_CB_NODE *cb_node,
     // Update bindings between images and cmd buffer
     AddCommandBufferBindingImage(device_data, cb_node, src_image_state);
     AddCommandBufferBindingImage(device_data, cb_node, dst_image_state);
-    std::function<bool()> function = [=]() { return ValidateImageMemoryIsValid(device_data, src_image_state, "vkCmdCopyImage()"); };
-    cb_node->validate_functions.push_back(function);
-    function = [=]() {
-        SetImageMemoryValid(device_data, dst_image_state, true);
-        return false;
-    };
-    cb_node->validate_functions.push_back(function);
+    core_validation::AddDeferredImageMemoryCheck(cb_node, src_image_state, "vkCmdCopyImage()");
+    core_validation::AddDeferredImageMemoryUpdate(cb_node, dst_image_state, true);
     core_validation::UpdateCmdBufferLastCmd(cb_node, CMD_COPYIMAGE);
 }
 
@@ -1742,15 +1744,8 @@ void PreCallRecordCmdResolveImage(layer_data *device_data, GLOBAL_CB_NODE *cb_no
     AddCommandBufferBindingImage(device_data, cb_node, src_image_state);
     AddCommandBufferBindingImage(device_data, cb_node, dst_image_state);
 
-    std::function<bool()> function = [=]() {
-        return ValidateImageMemoryIsValid(device_data, src_image_state, "vkCmdResolveImage()");
-    };
-    cb_node->validate_functions.push_back(function);
-    function = [=]() {
-        SetImageMemoryValid(device_data, dst_image_state, true);
-        return false;
-    };
-    cb_node->validate_functions.push_back(function);
+    core_validation::AddDeferredImageMemoryCheck(cb_node, src_image_state, "vkCmdResolveImage()");
+    core_validation::AddDeferredImageMemoryUpdate(cb_node, dst_image_state, true);
     core_validation::UpdateCmdBufferLastCmd(cb_node, CMD_RESOLVEIMAGE);
 }
 
@@ -1918,13 +1913,8 @@ void PreCallRecordCmdBlitImage(layer_data *device_data, GLOBAL_CB_NODE *cb_node,
     AddCommandBufferBindingImage(device_data, cb_node, src_image_state);
     AddCommandBufferBindingImage(device_data, cb_node, dst_image_state);
 
-    std::function<bool()> function = [=]() { return ValidateImageMemoryIsValid(device_data, src_image_state, "vkCmdBlitImage()"); };
-    cb_node->validate_functions.push_back(function);
-    function = [=]() {
-        SetImageMemoryValid(device_data, dst_image_state, true);
-        return false;
-    };
-    cb_node->validate_functions.push_back(function);
+    core_validation::AddDeferredImageMemoryCheck(cb_node, src_image_state, "vkCmdBlitImage()");
+    core_validation::AddDeferredImageMemoryUpdate(cb_node, dst_image_state, true);
     core_validation::UpdateCmdBufferLastCmd(cb_node, CMD_BLITIMAGE);
 }
 
@@ -1933,6 +1923,7 @@ void PreCallRecordCmdBlitImage(layer_data *device_data, GLOBAL_CB_NODE *cb_node,
 // as the global IMAGE layout
 bool ValidateCmdBufImageLayouts(layer_data *device_data, GLOBAL_CB_NODE *pCB,
                                 std::unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> &imageLayoutMap) {
+    if (GetDisables(device_data)->image_layouts) return false;
     bool skip = false;
     const debug_report_data *report_data = core_validation::GetReportData(device_data);
     for (auto cb_image_data : pCB->imageLayoutMap) {
@@ -2044,6 +2035,7 @@ static bool ValidateMaskBits(core_validation::layer_data *device_data, VkCommand
 
 bool ValidateMaskBitsFromLayouts(core_validation::layer_data *device_data, VkCommandBuffer cmdBuffer,
                                  const VkAccessFlags &accessMask, const VkImageLayout &layout, const char *type) {
+    if (GetDisables(device_data)->image_layouts) return false;
     const debug_report_data *report_data = core_validation::GetReportData(device_data);
 
     bool skip = false;
@@ -2124,6 +2116,7 @@ bool ValidateLayoutVsAttachmentDescription(const debug_report_data *report_data,
 }
 
 bool ValidateLayouts(core_validation::layer_data *device_data, VkDevice device, const VkRenderPassCreateInfo *pCreateInfo) {
+    if (GetDisables(device_data)->image_layouts) return false;
     const debug_report_data *report_data = core_validation::GetReportData(device_data);
     bool skip = false;
 
@@ -2229,6 +2222,7 @@ bool ValidateLayouts(core_validation::layer_data *device_data, VkDevice device,
 // For any image objects that overlap mapped memory, verify that their layouts are PREINIT or GENERAL
 bool ValidateMapImageLayouts(core_validation::layer_data *device_data, VkDevice device, DEVICE_MEM_INFO const *mem_info,
                              VkDeviceSize offset, VkDeviceSize end_offset) {
+    if (GetDisables(device_data)->image_layouts) return false;
     const debug_report_data *report_data = core_validation::GetReportData(device_data);
     bool skip = false;
     // Iterate over all bound image ranges and verify that for any that overlap the map ranges, the layouts are
@@ -2552,15 +2546,8 @@ void PreCallRecordCmdCopyBuffer(layer_data *device_data, GLOBAL_CB_NODE *cb_node
     AddCommandBufferBindingBuffer(device_data, cb_node, src_buffer_state);
     AddCommandBufferBindingBuffer(device_data, cb_node, dst_buffer_state);
 
-    std::function<bool()> function = [=]() {
-        return ValidateBufferMemoryIsValid(device_data, src_buffer_state, "vkCmdCopyBuffer()");
-    };
-    cb_node->validate_functions.push_back(function);
-    function = [=]() {
-        SetBufferMemoryValid(device_data, dst_buffer_state, true);
-        return false;
-    };
-    cb_node->validate_functions.push_back(function);
+    core_validation::AddDeferredBufferMemoryCheck(cb_node, src_buffer_state, "vkCmdCopyBuffer()");
+    core_validation::AddDeferredBufferMemoryUpdate(cb_node, dst_buffer_state, true);
     core_validation::UpdateCmdBufferLastCmd(cb_node, CMD_COPYBUFFER);
 }
 
@@ -2658,11 +2645,7 @@ bool PreCallValidateCmdFillBuffer(layer_data *device_data, GLOBAL_CB_NODE *cb_no
 }
 
 void PreCallRecordCmdFillBuffer(layer_data *device_data, GLOBAL_CB_NODE *cb_node, BUFFER_STATE *buffer_state) {
-    std::function<bool()> function = [=]() {
-        SetBufferMemoryValid(device_data, buffer_state, true);
-        return false;
-    };
-    cb_node->validate_functions.push_back(function);
+    core_validation::AddDeferredBufferMemoryUpdate(cb_node, buffer_state, true);
     // Update bindings between buffer and cmd buffer
     AddCommandBufferBindingBuffer(device_data, cb_node, buffer_state);
     core_validation::UpdateCmdBufferLastCmd(cb_node, CMD_FILLBUFFER);
@@ -3031,15 +3014,8 @@ void PreCallRecordCmdCopyImageToBuffer(layer_data *device_data, GLOBAL_CB_NODE *
     AddCommandBufferBindingImage(device_data, cb_node, src_image_state);
     AddCommandBufferBindingBuffer(device_data, cb_node, dst_buffer_state);
 
-    std::function<bool()> function = [=]() {
-        return ValidateImageMemoryIsValid(device_data, src_image_state, "vkCmdCopyImageToBuffer()");
-    };
-    cb_node->validate_functions.push_back(function);
-    function = [=]() {
-        SetBufferMemoryValid(device_data, dst_buffer_state, true);
-        return false;
-    };
-    cb_node->validate_functions.push_back(function);
+    core_validation::AddDeferredImageMemoryCheck(cb_node, src_image_state, "vkCmdCopyImageToBuffer()");
+    core_validation::AddDeferredBufferMemoryUpdate(cb_node, dst_buffer_state, true);
 
     core_validation::UpdateCmdBufferLastCmd(cb_node, CMD_COPYIMAGETOBUFFER);
 }
@@ -3103,13 +3079,8 @@ void PreCallRecordCmdCopyBufferToImage(layer_data *device_data, GLOBAL_CB_NODE *
     }
     AddCommandBufferBindingBuffer(device_data, cb_node, src_buffer_state);
     AddCommandBufferBindingImage(device_data, cb_node, dst_image_state);
-    std::function<bool()> function = [=]() {
-        SetImageMemoryValid(device_data, dst_image_state, true);
-        return false;
-    };
-    cb_node->validate_functions.push_back(function);
-    function = [=]() { return ValidateBufferMemoryIsValid(device_data, src_buffer_state, "vkCmdCopyBufferToImage()"); };
-    cb_node->validate_functions.push_back(function);
+    core_validation::AddDeferredImageMemoryUpdate(cb_node, dst_image_state, true);
+    core_validation::AddDeferredBufferMemoryCheck(cb_node, src_buffer_state, "vkCmdCopyBufferToImage()");
 
     core_validation::UpdateCmdBufferLastCmd(cb_node, CMD_COPYBUFFERTOIMAGE);
 }
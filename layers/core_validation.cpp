@@ -49,7 +49,11 @@
 #include <stdlib.h>
 #include <string.h>
 #include <string>
+#include <thread>
 #include <tuple>
+#include <condition_variable>
+#include <exception>
+#include <functional>
 
 #include "vk_loader_platform.h"
 #include "vk_dispatch_table_helper.h"
@@ -66,6 +70,7 @@
 #include "vk_layer_data.h"
 #include "vk_layer_extension_utils.h"
 #include "vk_layer_utils.h"
+#include "vk_layer_stats.h"
 #include "spirv-tools/libspirv.h"
 
 #if defined __ANDROID__
@@ -105,6 +110,97 @@ static const uint32_t kSurfaceSizeFromSwapchain = 0xFFFFFFFFu;
 // fwd decls
 struct shader_module;
 
+// Worker threads kept for the life of a device to spread per-pipeline setup of large vkCreate*Pipelines batches. Batches are
+// serialized by global_lock, so the pool only ever runs one at a time.
+class PipelineWorkerPool {
+   public:
+    explicit PipelineWorkerPool(uint32_t thread_count) : stop_(false), generation_(0), count_(0), active_(0), func_(nullptr) {
+        // If a thread can't be started, the ones that did and the calling thread simply share each batch
+        try {
+            threads_.reserve(thread_count);
+            for (uint32_t i = 0; i < thread_count; i++) {
+                threads_.emplace_back(&PipelineWorkerPool::WorkerMain, this);
+            }
+        } catch (const std::exception &) {
+        }
+    }
+
+    ~PipelineWorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            stop_ = true;
+        }
+        start_.notify_all();
+        for (auto &thread : threads_) {
+            thread.join();
+        }
+    }
+
+    // Call func(i) for each i in [0, count) on the pool's threads and the calling thread, and return once all calls have
+    // finished. If any call throws, no further indices are started and the first exception is rethrown here.
+    void Run(uint32_t count, const std::function<void(uint32_t)> &func) {
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            func_ = &func;
+            count_ = count;
+            next_index_.store(0);
+            error_ = nullptr;
+            active_ = static_cast<uint32_t>(threads_.size());
+            ++generation_;
+        }
+        start_.notify_all();
+        Work();
+        std::unique_lock<std::mutex> lock(lock_);
+        done_.wait(lock, [this] { return active_ == 0; });
+        func_ = nullptr;
+        if (error_) {
+            std::exception_ptr error = error_;
+            error_ = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+   private:
+    // Workers pull indices from a shared counter, so uneven per-pipeline cost still balances out
+    void Work() {
+        for (uint32_t i = next_index_++; i < count_; i = next_index_++) {
+            try {
+                (*func_)(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(lock_);
+                if (!error_) error_ = std::current_exception();
+                next_index_.store(count_);
+            }
+        }
+    }
+
+    void WorkerMain() {
+        uint64_t seen_generation = 0;
+        std::unique_lock<std::mutex> lock(lock_);
+        while (true) {
+            start_.wait(lock, [&] { return stop_ || generation_ != seen_generation; });
+            if (stop_) return;
+            seen_generation = generation_;
+            lock.unlock();
+            Work();
+            lock.lock();
+            if (--active_ == 0) done_.notify_one();
+        }
+    }
+
+    bool stop_;
+    uint64_t generation_;
+    uint32_t count_;
+    uint32_t active_;
+    const std::function<void(uint32_t)> *func_;
+    std::atomic<uint32_t> next_index_;
+    std::exception_ptr error_;
+    std::mutex lock_;
+    std::condition_variable start_;
+    std::condition_variable done_;
+    std::vector<std::thread> threads_;
+};
+
 struct instance_layer_data {
     VkInstance instance = VK_NULL_HANDLE;
     debug_report_data *report_data = nullptr;
@@ -175,11 +271,12 @@ struct layer_data {
     PHYS_DEV_PROPERTIES_NODE phys_dev_properties = {};
     VkPhysicalDeviceMemoryProperties phys_dev_mem_props = {};
     VkPhysicalDeviceProperties phys_dev_props = {};
+    // Started by the first pipeline batch large enough to use it
+    unique_ptr<PipelineWorkerPool> pipeline_worker_pool;
 };
 
-// TODO : Do we need to guard access to layer_data_map w/ lock?
-static unordered_map<void *, layer_data *> layer_data_map;
-static unordered_map<void *, instance_layer_data *> instance_layer_data_map;
+static LayerDataMap<layer_data> layer_data_map;
+static LayerDataMap<instance_layer_data> instance_layer_data_map;
 
 static uint32_t loader_layer_if_version = CURRENT_LOADER_LAYER_INTERFACE_VERSION;
 
@@ -202,7 +299,7 @@ void ValidateLayerOrdering(const TCreateInfo &createInfo) {
 }
 
 // Code imported from shader_checker
-static void build_def_index(shader_module *);
+static void build_def_index(shader_module const *);
 
 // A forward iterator over spirv instructions. Provides easy access to len, opcode, and content words
 // without the caller needing to care too much about the physical SPIRV module layout.
@@ -249,20 +346,47 @@ struct spirv_inst_iter {
     spirv_inst_iter const &operator*() const { return *this; }
 };
 
+typedef std::pair<unsigned, unsigned> location_t;
+typedef std::pair<unsigned, unsigned> descriptor_slot_t;
+
+struct interface_var {
+    uint32_t id;
+    uint32_t type_id;
+    uint32_t offset;
+    bool is_patch;
+    bool is_block_member;
+    bool is_relaxed_precision;
+    // TODO: collect the name, too? Isn't required to be present.
+};
+
+// Reflection results for a single entrypoint of a module. None of this depends on the pipeline, so it is computed the
+// first time a pipeline uses the entrypoint and reused by every later pipeline that uses the same module and entrypoint.
+struct shader_entrypoint_info {
+    spirv_inst_iter entrypoint;
+    std::unordered_set<uint32_t> accessible_ids;
+    std::vector<std::pair<descriptor_slot_t, interface_var>> descriptor_uses;
+    std::vector<std::pair<uint32_t, interface_var>> input_attachment_uses;
+    // Only collected for the graphics stages
+    std::map<location_t, interface_var> inputs;
+    std::map<location_t, interface_var> outputs;
+};
+
 struct shader_module {
     // The spirv image itself
     vector<uint32_t> words;
-    // A mapping of <id> to the first word of its def. this is useful because walking type
-    // trees, constant expressions, etc requires jumping all over the instruction stream.
-    unordered_map<unsigned, unsigned> def_index;
+    // A mapping of <id> to the first word of its def, indexed directly by id (zero where we don't track a def). This is
+    // useful because walking type trees, constant expressions, etc requires jumping all over the instruction stream.
+    // Built on first use, as many modules are never inspected beyond vkCreateShaderModule.
+    mutable vector<uint32_t> def_index;
+    mutable std::once_flag def_index_built;
+    // Reflection cache, keyed by entrypoint name and stage
+    mutable std::mutex entrypoint_info_lock;
+    mutable std::map<std::pair<string, VkShaderStageFlagBits>, unique_ptr<shader_entrypoint_info>> entrypoint_info;
     bool has_valid_spirv;
 
     shader_module(VkShaderModuleCreateInfo const *pCreateInfo)
         : words((uint32_t *)pCreateInfo->pCode, (uint32_t *)pCreateInfo->pCode + pCreateInfo->codeSize / sizeof(uint32_t)),
-          def_index(),
-          has_valid_spirv(true) {
-        build_def_index(this);
-    }
+          has_valid_spirv(true) {}
 
     shader_module() : has_valid_spirv(false) {}
 
@@ -274,16 +398,16 @@ struct shader_module {
 
     // Gets an iterator to the definition of an id
     spirv_inst_iter get_def(unsigned id) const {
-        auto it = def_index.find(id);
-        if (it == def_index.end()) {
+        std::call_once(def_index_built, build_def_index, this);
+        if (id >= def_index.size() || !def_index[id]) {
             return end();
         }
-        return at(it->second);
+        return at(def_index[id]);
     }
 };
 
 // TODO : This can be much smarter, using separate locks for separate global data
-static std::mutex global_lock;
+static LayerStatsMutex global_lock("global_lock");
 
 // Return IMAGE_VIEW_STATE ptr for specified imageView or else NULL
 IMAGE_VIEW_STATE *GetImageViewState(const layer_data *dev_data, VkImageView image_view) {
@@ -497,6 +621,46 @@ void SetBufferMemoryValid(layer_data *dev_data, BUFFER_STATE *buffer_state, bool
     SetMemoryValid(dev_data, buffer_state->binding.mem, reinterpret_cast<uint64_t &>(buffer_state->buffer), valid);
 }
 
+// Record memory validity checks and updates into the command buffer, to be replayed by ProcessMemoryAccesses at submit time
+void AddDeferredImageMemoryCheck(GLOBAL_CB_NODE *cb_node, IMAGE_STATE *image_state, const char *func_name) {
+    cb_node->memory_accesses.push_back({CB_MEMORY_ACCESS_VALIDATE, image_state, nullptr, func_name});
+}
+
+void AddDeferredBufferMemoryCheck(GLOBAL_CB_NODE *cb_node, BUFFER_STATE *buffer_state, const char *func_name) {
+    cb_node->memory_accesses.push_back({CB_MEMORY_ACCESS_VALIDATE, nullptr, buffer_state, func_name});
+}
+
+void AddDeferredImageMemoryUpdate(GLOBAL_CB_NODE *cb_node, IMAGE_STATE *image_state, bool valid) {
+    cb_node->memory_accesses.push_back(
+        {valid ? CB_MEMORY_ACCESS_SET_VALID : CB_MEMORY_ACCESS_SET_INVALID, image_state, nullptr, nullptr});
+}
+
+void AddDeferredBufferMemoryUpdate(GLOBAL_CB_NODE *cb_node, BUFFER_STATE *buffer_state, bool valid) {
+    cb_node->memory_accesses.push_back(
+        {valid ? CB_MEMORY_ACCESS_SET_VALID : CB_MEMORY_ACCESS_SET_INVALID, nullptr, buffer_state, nullptr});
+}
+
+// Replay the memory accesses recorded into a command buffer, in recording order
+static bool ProcessMemoryAccesses(layer_data *dev_data, GLOBAL_CB_NODE const *cb_node) {
+    bool skip = false;
+    for (auto const &access : cb_node->memory_accesses) {
+        if (access.image_state) {
+            if (access.type == CB_MEMORY_ACCESS_VALIDATE) {
+                skip |= ValidateImageMemoryIsValid(dev_data, access.image_state, access.func_name);
+            } else {
+                SetImageMemoryValid(dev_data, access.image_state, access.type == CB_MEMORY_ACCESS_SET_VALID);
+            }
+        } else if (access.buffer_state) {
+            if (access.type == CB_MEMORY_ACCESS_VALIDATE) {
+                skip |= ValidateBufferMemoryIsValid(dev_data, access.buffer_state, access.func_name);
+            } else {
+                SetBufferMemoryValid(dev_data, access.buffer_state, access.type == CB_MEMORY_ACCESS_SET_VALID);
+            }
+        }
+    }
+    return skip;
+}
+
 // Create binding link between given sampler and command buffer node
 void AddCommandBufferBindingSampler(GLOBAL_CB_NODE *cb_node, SAMPLER_STATE *sampler_state) {
     sampler_state->cb_bindings.insert(cb_node);
@@ -577,7 +741,7 @@ static void clear_cmd_buf_and_mem_references(layer_data *dev_data, GLOBAL_CB_NOD
             }
             cb_node->memObjs.clear();
         }
-        cb_node->validate_functions.clear();
+        cb_node->memory_accesses.clear();
     }
 }
 
@@ -760,8 +924,15 @@ static bool SetSparseMemBinding(layer_data *dev_data, MEM_BINDING binding, uint6
 }
 
 // SPIRV utility functions
-static void build_def_index(shader_module *module) {
+static void build_def_index(shader_module const *module) {
+    if (module->words.size() < 5) return;
+
+    // The id bound from the module header sizes the index
+    module->def_index.assign(module->words[3], 0);
+
     for (auto insn : *module) {
+        uint32_t result_id = 0;
+
         switch (insn.opcode()) {
             // Types
             case spv::OpTypeVoid:
@@ -784,7 +955,7 @@ static void build_def_index(shader_module *module) {
             case spv::OpTypeReserveId:
             case spv::OpTypeQueue:
             case spv::OpTypePipe:
-                module->def_index[insn.word(1)] = insn.offset();
+                result_id = insn.word(1);
                 break;
 
             // Fixed constants
@@ -794,7 +965,7 @@ static void build_def_index(shader_module *module) {
             case spv::OpConstantComposite:
             case spv::OpConstantSampler:
             case spv::OpConstantNull:
-                module->def_index[insn.word(2)] = insn.offset();
+                result_id = insn.word(2);
                 break;
 
             // Specialization constants
@@ -803,27 +974,31 @@ static void build_def_index(shader_module *module) {
             case spv::OpSpecConstant:
             case spv::OpSpecConstantComposite:
             case spv::OpSpecConstantOp:
-                module->def_index[insn.word(2)] = insn.offset();
+                result_id = insn.word(2);
                 break;
 
             // Variables
             case spv::OpVariable:
-                module->def_index[insn.word(2)] = insn.offset();
+                result_id = insn.word(2);
                 break;
 
             // Functions
             case spv::OpFunction:
-                module->def_index[insn.word(2)] = insn.offset();
+                result_id = insn.word(2);
                 break;
 
             default:
                 // We don't care about any other defs for now.
                 break;
         }
+
+        if (result_id && result_id < module->def_index.size()) {
+            module->def_index[result_id] = insn.offset();
+        }
     }
 }
 
-static spirv_inst_iter find_entrypoint(shader_module *src, char const *name, VkShaderStageFlagBits stageBits) {
+static spirv_inst_iter find_entrypoint(shader_module const *src, char const *name, VkShaderStageFlagBits stageBits) {
     for (auto insn : *src) {
         if (insn.opcode() == spv::OpEntryPoint) {
             auto entrypointName = (char const *)&insn.word(3);
@@ -1090,19 +1265,6 @@ static unsigned get_locations_consumed_by_format(VkFormat format) {
     }
 }
 
-typedef std::pair<unsigned, unsigned> location_t;
-typedef std::pair<unsigned, unsigned> descriptor_slot_t;
-
-struct interface_var {
-    uint32_t id;
-    uint32_t type_id;
-    uint32_t offset;
-    bool is_patch;
-    bool is_block_member;
-    bool is_relaxed_precision;
-    // TODO: collect the name, too? Isn't required to be present.
-};
-
 struct shader_stage_attributes {
     char const *const name;
     bool arrayed_input;
@@ -1357,15 +1519,14 @@ static std::vector<std::pair<descriptor_slot_t, interface_var>> collect_interfac
 }
 
 static bool validate_interface_between_stages(debug_report_data *report_data, shader_module const *producer,
-                                              spirv_inst_iter producer_entrypoint, shader_stage_attributes const *producer_stage,
-                                              shader_module const *consumer, spirv_inst_iter consumer_entrypoint,
+                                              shader_entrypoint_info const *producer_info,
+                                              shader_stage_attributes const *producer_stage, shader_module const *consumer,
+                                              shader_entrypoint_info const *consumer_info,
                                               shader_stage_attributes const *consumer_stage) {
     bool pass = true;
 
-    auto outputs =
-        collect_interface_by_location(producer, producer_entrypoint, spv::StorageClassOutput, producer_stage->arrayed_output);
-    auto inputs =
-        collect_interface_by_location(consumer, consumer_entrypoint, spv::StorageClassInput, consumer_stage->arrayed_input);
+    auto const &outputs = producer_info->outputs;
+    auto const &inputs = consumer_info->inputs;
 
     auto a_it = outputs.begin();
     auto b_it = inputs.begin();
@@ -1508,10 +1669,10 @@ static bool validate_vi_consistency(debug_report_data *report_data, VkPipelineVe
 }
 
 static bool validate_vi_against_vs_inputs(debug_report_data *report_data, VkPipelineVertexInputStateCreateInfo const *vi,
-                                          shader_module const *vs, spirv_inst_iter entrypoint) {
+                                          shader_module const *vs, shader_entrypoint_info const *vs_info) {
     bool pass = true;
 
-    auto inputs = collect_interface_by_location(vs, entrypoint, spv::StorageClassInput, false);
+    auto const &inputs = vs_info->inputs;
 
     // Build index by location
     std::map<uint32_t, VkVertexInputAttributeDescription const *> attribs;
@@ -1572,7 +1733,7 @@ static bool validate_vi_against_vs_inputs(debug_report_data *report_data, VkPipe
 }
 
 static bool validate_fs_outputs_against_render_pass(debug_report_data *report_data, shader_module const *fs,
-                                                    spirv_inst_iter entrypoint, VkRenderPassCreateInfo const *rpci,
+                                                    shader_entrypoint_info const *fs_info, VkRenderPassCreateInfo const *rpci,
                                                     uint32_t subpass_index) {
     std::map<uint32_t, VkFormat> color_attachments;
     auto subpass = rpci->pSubpasses[subpass_index];
@@ -1588,7 +1749,7 @@ static bool validate_fs_outputs_against_render_pass(debug_report_data *report_da
 
     // TODO: dual source blend index (spv::DecIndex, zero if not provided)
 
-    auto outputs = collect_interface_by_location(fs, entrypoint, spv::StorageClassOutput, false);
+    auto const &outputs = fs_info->outputs;
 
     auto it_a = outputs.begin();
     auto it_b = color_attachments.begin();
@@ -1808,7 +1969,7 @@ static bool validate_push_constant_block_against_pipeline(debug_report_data *rep
 
 static bool validate_push_constant_usage(debug_report_data *report_data,
                                          std::vector<VkPushConstantRange> const *push_constant_ranges, shader_module const *src,
-                                         std::unordered_set<uint32_t> accessible_ids, VkShaderStageFlagBits stage) {
+                                         std::unordered_set<uint32_t> const &accessible_ids, VkShaderStageFlagBits stage) {
     bool pass = true;
 
     for (auto id : accessible_ids) {
@@ -2393,9 +2554,46 @@ static uint32_t descriptor_type_to_reqs(shader_module const *module, uint32_t ty
     }
 }
 
+// Return the reflection results for the named entrypoint of a module, building and caching them on first use.
+// Returns nullptr if the module has no such entrypoint.
+static shader_entrypoint_info const *get_entrypoint_info(debug_report_data *report_data, shader_module const *module,
+                                                         char const *name, VkShaderStageFlagBits stage) {
+    std::lock_guard<std::mutex> lock(module->entrypoint_info_lock);
+
+    auto key = std::make_pair(string(name), stage);
+    auto info_it = module->entrypoint_info.find(key);
+    if (info_it != module->entrypoint_info.end()) {
+        return info_it->second.get();
+    }
+
+    auto entrypoint = find_entrypoint(module, name, stage);
+    if (entrypoint == module->end()) {
+        return nullptr;
+    }
+
+    auto info = new shader_entrypoint_info();
+    info->entrypoint = entrypoint;
+    info->accessible_ids = mark_accessible_ids(module, entrypoint);
+    info->descriptor_uses = collect_interface_by_descriptor_slot(report_data, module, info->accessible_ids);
+    if (stage == VK_SHADER_STAGE_FRAGMENT_BIT) {
+        info->input_attachment_uses = collect_interface_by_input_attachment_index(module, info->accessible_ids);
+    }
+
+    auto stage_id = get_shader_stage_id(stage);
+    if (stage_id < ARRAY_SIZE(shader_stage_attribs)) {
+        info->inputs = collect_interface_by_location(module, entrypoint, spv::StorageClassInput,
+                                                     shader_stage_attribs[stage_id].arrayed_input);
+        info->outputs = collect_interface_by_location(module, entrypoint, spv::StorageClassOutput,
+                                                      shader_stage_attribs[stage_id].arrayed_output);
+    }
+
+    module->entrypoint_info[key] = unique_ptr<shader_entrypoint_info>(info);
+    return info;
+}
+
 static bool validate_pipeline_shader_stage(
     layer_data *dev_data, VkPipelineShaderStageCreateInfo const *pStage, PIPELINE_STATE *pipeline,
-    shader_module **out_module, spirv_inst_iter *out_entrypoint) {
+    shader_module **out_module, shader_entrypoint_info const **out_entrypoint_info) {
     bool pass = true;
     auto module_it = dev_data->shaderModuleMap.find(pStage->module);
     auto module = *out_module = module_it->second.get();
@@ -2404,31 +2602,27 @@ static bool validate_pipeline_shader_stage(
     if (!module->has_valid_spirv) return pass;
 
     // Find the entrypoint
-    auto entrypoint = *out_entrypoint = find_entrypoint(module, pStage->pName, pStage->stage);
-    if (entrypoint == module->end()) {
+    auto entrypoint_info = *out_entrypoint_info = get_entrypoint_info(report_data, module, pStage->pName, pStage->stage);
+    if (!entrypoint_info) {
         if (log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
                     VALIDATION_ERROR_00510, "SC", "No entrypoint found named `%s` for stage %s. %s.", pStage->pName,
                     string_VkShaderStageFlagBits(pStage->stage), validation_error_map[VALIDATION_ERROR_00510])) {
-            return false;  // no point continuing beyond here, any analysis is just going to be garbage.
+            return false;
         }
+        return pass;  // no point continuing beyond here, any analysis is just going to be garbage.
     }
 
     // Validate shader capabilities against enabled device features
     pass &= validate_shader_capabilities(dev_data, module);
 
-    // Mark accessible ids
-    auto accessible_ids = mark_accessible_ids(module, entrypoint);
-
-    // Validate descriptor set layout against what the entrypoint actually uses
-    auto descriptor_uses = collect_interface_by_descriptor_slot(report_data, module, accessible_ids);
-
     auto pipelineLayout = pipeline->pipeline_layout;
 
     pass &= validate_specialization_offsets(report_data, pStage);
-    pass &= validate_push_constant_usage(report_data, &pipelineLayout.push_constant_ranges, module, accessible_ids, pStage->stage);
+    pass &= validate_push_constant_usage(report_data, &pipelineLayout.push_constant_ranges, module,
+                                         entrypoint_info->accessible_ids, pStage->stage);
 
-    // Validate descriptor use
-    for (auto use : descriptor_uses) {
+    // Validate descriptor set layout against what the entrypoint actually uses
+    for (auto const &use : entrypoint_info->descriptor_uses) {
         // While validating shaders capture which slots are used by the pipeline
         auto &reqs = pipeline->active_slots[use.first.first][use.first.second];
         reqs = descriptor_req(reqs | descriptor_type_to_reqs(module, use.second.type_id));
@@ -2477,12 +2671,10 @@ static bool validate_pipeline_shader_stage(
 
     // Validate use of input attachments against subpass structure
     if (pStage->stage == VK_SHADER_STAGE_FRAGMENT_BIT) {
-        auto input_attachment_uses = collect_interface_by_input_attachment_index(module, accessible_ids);
-
         auto rpci = pipeline->render_pass_ci.ptr();
         auto subpass = pipeline->graphicsPipelineCI.subpass;
 
-        for (auto use : input_attachment_uses) {
+        for (auto const &use : entrypoint_info->input_attachment_uses) {
             auto input_attachments = rpci->pSubpasses[subpass].pInputAttachments;
             auto index = (input_attachments && use.first < rpci->pSubpasses[subpass].inputAttachmentCount)
                              ? input_attachments[use.first].attachment
@@ -2517,7 +2709,7 @@ static bool validate_and_capture_pipeline_shader_state(layer_data *dev_data, PIP
 
     shader_module *shaders[5];
     memset(shaders, 0, sizeof(shaders));
-    spirv_inst_iter entrypoints[5];
+    shader_entrypoint_info const *entrypoints[5];
     memset(entrypoints, 0, sizeof(entrypoints));
     bool pass = true;
 
@@ -2536,7 +2728,7 @@ static bool validate_and_capture_pipeline_shader_state(layer_data *dev_data, PIP
         pass &= validate_vi_consistency(dev_data->report_data, vi);
     }
 
-    if (shaders[vertex_stage] && shaders[vertex_stage]->has_valid_spirv) {
+    if (entrypoints[vertex_stage]) {
         pass &= validate_vi_against_vs_inputs(dev_data->report_data, vi, shaders[vertex_stage], entrypoints[vertex_stage]);
     }
 
@@ -2550,7 +2742,7 @@ static bool validate_and_capture_pipeline_shader_state(layer_data *dev_data, PIP
 
     for (; producer != fragment_stage && consumer <= fragment_stage; consumer++) {
         assert(shaders[producer]);
-        if (shaders[consumer] && shaders[consumer]->has_valid_spirv && shaders[producer]->has_valid_spirv) {
+        if (entrypoints[consumer] && entrypoints[producer]) {
             pass &= validate_interface_between_stages(dev_data->report_data, shaders[producer], entrypoints[producer],
                                                       &shader_stage_attribs[producer], shaders[consumer], entrypoints[consumer],
                                                       &shader_stage_attribs[consumer]);
@@ -2559,7 +2751,7 @@ static bool validate_and_capture_pipeline_shader_state(layer_data *dev_data, PIP
         }
     }
 
-    if (shaders[fragment_stage] && shaders[fragment_stage]->has_valid_spirv) {
+    if (entrypoints[fragment_stage]) {
         pass &= validate_fs_outputs_against_render_pass(dev_data->report_data, shaders[fragment_stage], entrypoints[fragment_stage],
                                                         pPipeline->render_pass_ci.ptr(), pCreateInfo->subpass);
     }
@@ -2571,9 +2763,9 @@ static bool validate_compute_pipeline(layer_data *dev_data, PIPELINE_STATE *pPip
     auto pCreateInfo = pPipeline->computePipelineCI.ptr();
 
     shader_module *module;
-    spirv_inst_iter entrypoint;
+    shader_entrypoint_info const *entrypoint_info;
 
-    return validate_pipeline_shader_stage(dev_data, &pCreateInfo->stage, pPipeline, &module, &entrypoint);
+    return validate_pipeline_shader_stage(dev_data, &pCreateInfo->stage, pPipeline, &module, &entrypoint_info);
 }
 // Return Set node ptr for specified set or else NULL
 cvdescriptorset::DescriptorSet *GetSetNode(const layer_data *dev_data, VkDescriptorSet set) {
@@ -2713,6 +2905,7 @@ static bool ValidatePipelineDrawtimeState(layer_data const *dev_data, LAST_BOUND
     if (pCB->activeRenderPass) {
         std::string err_string;
         if ((pCB->activeRenderPass->renderPass != pPipeline->graphicsPipelineCI.renderPass) &&
+            will_log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT) &&
             !verify_renderpass_compatibility(dev_data, pCB->activeRenderPass->createInfo.ptr(), pPipeline->render_pass_ci.ptr(),
                                              err_string)) {
             // renderPass that PSO was created with must be compatible with active renderPass that PSO is being used with
@@ -2753,12 +2946,13 @@ static bool ValidateDrawState(layer_data *dev_data, GLOBAL_CB_NODE *cb_node, con
         // Early return as any further checks below will be busted w/o a pipeline
         if (result) return true;
     }
+    const CHECK_DISABLED *disabled = GetDisables(dev_data);
     // First check flag states
-    if (VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point)
+    if (VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point && !disabled->draw_state)
         result = validate_draw_state_flags(dev_data, cb_node, pPipe, indexed, msg_code);
 
     // Now complete other state checks
-    if (VK_NULL_HANDLE != state.pipeline_layout.layout) {
+    if (VK_NULL_HANDLE != state.pipeline_layout.layout && !disabled->draw_descriptor_sets) {
         string errorString;
         auto pipeline_layout = pPipe->pipeline_layout;
 
@@ -2820,7 +3014,9 @@ static bool ValidateDrawState(layer_data *dev_data, GLOBAL_CB_NODE *cb_node, con
     }
 
     // Check general pipeline state that needs to be validated at drawtime
-    if (VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point) result |= ValidatePipelineDrawtimeState(dev_data, state, cb_node, pPipe);
+    if (VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point && !disabled->draw_state) {
+        result |= ValidatePipelineDrawtimeState(dev_data, state, cb_node, pPipe);
+    }
 
     return result;
 }
@@ -2873,7 +3069,7 @@ static bool verifyLineWidth(layer_data *dev_data, DRAW_STATE_ERROR dsError, Vulk
 }
 
 // Verify that create state for a pipeline is valid
-static bool verifyPipelineCreateState(layer_data *dev_data, std::vector<PIPELINE_STATE *> pPipelines, int pipelineIndex) {
+static bool verifyPipelineCreateState(layer_data *dev_data, std::vector<PIPELINE_STATE *> const &pPipelines, int pipelineIndex) {
     bool skip = false;
 
     PIPELINE_STATE *pPipeline = pPipelines[pipelineIndex];
@@ -3514,8 +3710,70 @@ bool outsideRenderPass(const layer_data *dev_data, GLOBAL_CB_NODE *pCB, const ch
     return outside;
 }
 
+// Validation profiles name families of checks. When lunarg_core_validation.validation_profile lists any profiles, every
+// family that is not listed is disabled. Checks outside of all families always run.
+static void SetValidationProfile(instance_layer_data *instance_data, const char *profile_list) {
+    if (!*profile_list) return;
+
+    std::vector<std::string> profiles;
+    std::stringstream profile_stream(profile_list);
+    std::string profile;
+    while (std::getline(profile_stream, profile, ',')) {
+        profile.erase(0, profile.find_first_not_of(' '));
+        profile.erase(profile.find_last_not_of(' ') + 1);
+        profiles.push_back(profile);
+    }
+    auto disable_unless = [&profiles](const char *family) {
+        return std::find(profiles.begin(), profiles.end(), family) == profiles.end();
+    };
+
+    CHECK_DISABLED &disabled = instance_data->disabled;
+    const bool sync = disable_unless("sync");
+    disabled.object_in_use |= sync;
+    disabled.wait_for_fences |= sync;
+    disabled.get_fence_state |= sync;
+    disabled.queue_wait_idle |= sync;
+    disabled.device_wait_idle |= sync;
+    disabled.destroy_fence |= sync;
+    disabled.destroy_semaphore |= sync;
+    disabled.destroy_event |= sync;
+    disabled.destroy_query_pool |= sync;
+    disabled.get_query_pool_results |= sync;
+    disabled.destroy_command_pool |= sync;
+
+    const bool memory = disable_unless("memory");
+    disabled.free_memory |= memory;
+    disabled.destroy_buffer |= memory;
+    disabled.destroy_buffer_view |= memory;
+    disabled.destroy_image |= memory;
+    disabled.destroy_image_view |= memory;
+
+    const bool descriptors = disable_unless("descriptors");
+    disabled.create_descriptor_set_layout |= descriptors;
+    disabled.push_constant_range |= descriptors;
+    disabled.allocate_descriptor_sets |= descriptors;
+    disabled.free_descriptor_sets |= descriptors;
+    disabled.update_descriptor_sets |= descriptors;
+    disabled.idle_descriptor_set |= descriptors;
+    disabled.destroy_descriptor_pool |= descriptors;
+    disabled.draw_descriptor_sets |= descriptors;
+
+    disabled.shader_validation |= disable_unless("shaders");
+    disabled.image_layouts |= disable_unless("layouts");
+    disabled.draw_state |= disable_unless("draw_state");
+
+    const bool objects = disable_unless("objects");
+    disabled.command_buffer_state |= objects;
+    disabled.destroy_pipeline |= objects;
+    disabled.destroy_sampler |= objects;
+    disabled.destroy_framebuffer |= objects;
+    disabled.destroy_renderpass |= objects;
+}
+
 static void init_core_validation(instance_layer_data *instance_data, const VkAllocationCallbacks *pAllocator) {
     layer_debug_actions(instance_data->report_data, instance_data->logging_callback, pAllocator, "lunarg_core_validation");
+    GetLayerStats().Init("lunarg_core_validation");
+    SetValidationProfile(instance_data, getLayerOption("lunarg_core_validation.validation_profile"));
 }
 
 static void checkInstanceRegisterExtensions(const VkInstanceCreateInfo *pCreateInfo, instance_layer_data *instance_data) {
@@ -3613,7 +3871,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
     instance_layer_data *instance_data = GetLayerDataPtr(key, instance_layer_data_map);
     instance_data->dispatch_table.DestroyInstance(instance, pAllocator);
 
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<LayerStatsMutex> lock(global_lock);
     // Clean up logging callback, if any
     while (instance_data->logging_callback.size() > 0) {
         VkDebugReportCallbackEXT callback = instance_data->logging_callback.back();
@@ -3621,6 +3879,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
         instance_data->logging_callback.pop_back();
     }
 
+    GetLayerStats().DumpJson();
     layer_debug_report_destroy_instance(instance_data->report_data);
     layer_data_map.erase(key);
 }
@@ -3762,7 +4021,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
         return result;
     }
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     layer_data *device_data = GetLayerDataPtr(get_dispatch_key(*pDevice), layer_data_map);
 
     device_data->instance_data = instance_data;
@@ -3804,7 +4063,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     dispatch_key key = get_dispatch_key(device);
     layer_data *dev_data = GetLayerDataPtr(key, layer_data_map);
     // Free all the memory
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     deletePipelines(dev_data);
     dev_data->renderPassMap.clear();
     for (auto ii = dev_data->commandBufferMap.begin(); ii != dev_data->commandBufferMap.end(); ++ii) {
@@ -3827,6 +4086,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     dev_data->bufferMap.clear();
     // Queues persist until device is destroyed
     dev_data->queueMap.clear();
+    dev_data->pipeline_worker_pool.reset();
     // Report any memory leaks
     layer_debug_report_destroy_device(device);
     lock.unlock();
@@ -3886,7 +4146,7 @@ static void incrementResources(layer_data *dev_data, GLOBAL_CB_NODE *cb_node) {
     // TODO : We should be able to remove the NULL look-up checks from the code below as long as
     //  all the corresponding cases are verified to cause CB_INVALID state and the CB_INVALID state
     //  should then be flagged prior to calling this function
-    for (auto drawDataElement : cb_node->drawData) {
+    for (auto const &drawDataElement : cb_node->drawData) {
         for (auto buffer : drawDataElement.buffers) {
             auto buffer_state = GetBufferState(dev_data, buffer);
             if (buffer_state) {
@@ -3900,6 +4160,46 @@ static void incrementResources(layer_data *dev_data, GLOBAL_CB_NODE *cb_node) {
     }
 }
 
+// Small table of per-queue sequence numbers used while walking submissions across queues.
+// A submission's semaphore waits only ever reference a handful of queues, so entries live in
+// inline storage and are found by linear scan; overflow spills to a deque for pathological cases.
+template <typename Key>
+class QueueSeqTable {
+   public:
+    struct Entry {
+        Key queue;
+        uint64_t target_seq;
+        uint64_t done_seq;
+    };
+
+    Entry &operator[](Key queue) {
+        for (uint32_t i = 0; i < inline_count_; ++i) {
+            if (inline_[i].queue == queue) return inline_[i];
+        }
+        for (auto &entry : overflow_) {
+            if (entry.queue == queue) return entry;
+        }
+        if (inline_count_ < kInlineEntries) {
+            inline_[inline_count_] = {queue, 0, 0};
+            return inline_[inline_count_++];
+        }
+        overflow_.push_back({queue, 0, 0});
+        return overflow_.back();
+    }
+
+    template <typename Func>
+    void ForEach(Func func) const {
+        for (uint32_t i = 0; i < inline_count_; ++i) func(inline_[i]);
+        for (auto const &entry : overflow_) func(entry);
+    }
+
+   private:
+    static const uint32_t kInlineEntries = 8;
+    Entry inline_[kInlineEntries];
+    uint32_t inline_count_ = 0;
+    std::deque<Entry> overflow_;  // deque so references into it stay valid as it grows
+};
+
 // Note: This function assumes that the global lock is held by the calling thread.
 // For the given queue, verify the queue state up to the given seq number.
 // Currently the only check is to make sure that if there are events to be waited on prior to
@@ -3907,18 +4207,17 @@ static void incrementResources(layer_data *dev_data, GLOBAL_CB_NODE *cb_node) {
 static bool VerifyQueueStateToSeq(layer_data *dev_data, QUEUE_STATE *initial_queue, uint64_t initial_seq) {
     bool skip = false;
 
-    // sequence number we want to validate up to, per queue
-    std::unordered_map<QUEUE_STATE *, uint64_t> target_seqs { { initial_queue, initial_seq } };
-    // sequence number we've completed validation for, per queue
-    std::unordered_map<QUEUE_STATE *, uint64_t> done_seqs;
+    // sequence number we want to validate up to, and have completed validation for, per queue
+    QueueSeqTable<QUEUE_STATE *> seqs;
+    seqs[initial_queue].target_seq = initial_seq;
     std::vector<QUEUE_STATE *> worklist { initial_queue };
 
     while (worklist.size()) {
         auto queue = worklist.back();
         worklist.pop_back();
 
-        auto target_seq = target_seqs[queue];
-        auto seq = std::max(done_seqs[queue], queue->seq);
+        auto target_seq = seqs[queue].target_seq;
+        auto seq = std::max(seqs[queue].done_seq, queue->seq);
         auto sub_it = queue->submissions.begin() + int(seq - queue->seq);  // seq >= queue->seq
 
         for (; seq < target_seq; ++sub_it, ++seq) {
@@ -3928,14 +4227,15 @@ static bool VerifyQueueStateToSeq(layer_data *dev_data, QUEUE_STATE *initial_que
                 if (other_queue == queue)
                     continue;   // semaphores /always/ point backwards, so no point here.
 
-                auto other_target_seq = std::max(target_seqs[other_queue], wait.seq);
-                auto other_done_seq = std::max(done_seqs[other_queue], other_queue->seq);
+                auto &other = seqs[other_queue];
+                auto other_target_seq = std::max(other.target_seq, wait.seq);
+                auto other_done_seq = std::max(other.done_seq, other_queue->seq);
 
                 // if this wait is for another queue, and covers new sequence
                 // numbers beyond what we've already validated, mark the new
                 // target seq and (possibly-re)add the queue to the worklist.
                 if (other_done_seq < other_target_seq) {
-                    target_seqs[other_queue] = other_target_seq;
+                    other.target_seq = other_target_seq;
                     worklist.push_back(other_queue);
                 }
             }
@@ -3943,7 +4243,7 @@ static bool VerifyQueueStateToSeq(layer_data *dev_data, QUEUE_STATE *initial_que
             for (auto cb : sub_it->cbs) {
                 auto cb_node = GetCBNode(dev_data, cb);
                 if (cb_node) {
-                    for (auto queryEventsPair : cb_node->waitedEventsBeforeQueryReset) {
+                    for (auto const &queryEventsPair : cb_node->waitedEventsBeforeQueryReset) {
                         for (auto event : queryEventsPair.second) {
                             if (dev_data->eventMap[event].needsSignaled) {
                                 skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
@@ -3959,7 +4259,7 @@ static bool VerifyQueueStateToSeq(layer_data *dev_data, QUEUE_STATE *initial_que
         }
 
         // finally mark the point we've now validated this queue to.
-        done_seqs[queue] = seq;
+        seqs[queue].done_seq = seq;
     }
 
     return skip;
@@ -3997,7 +4297,7 @@ static void DecrementBoundResources(layer_data *dev_data, GLOBAL_CB_NODE const *
 }
 
 static void RetireWorkOnQueue(layer_data *dev_data, QUEUE_STATE *pQueue, uint64_t seq) {
-    std::unordered_map<VkQueue, uint64_t> otherQueueSeqs;
+    QueueSeqTable<VkQueue> otherQueueSeqs;
 
     // Roll this queue forward, one submission at a time.
     while (pQueue->seq < seq) {
@@ -4008,7 +4308,7 @@ static void RetireWorkOnQueue(layer_data *dev_data, QUEUE_STATE *pQueue, uint64_
             if (pSemaphore) {
                 pSemaphore->in_use.fetch_sub(1);
             }
-            auto &lastSeq = otherQueueSeqs[wait.queue];
+            auto &lastSeq = otherQueueSeqs[wait.queue].target_seq;
             lastSeq = std::max(lastSeq, wait.seq);
         }
 
@@ -4026,7 +4326,7 @@ static void RetireWorkOnQueue(layer_data *dev_data, QUEUE_STATE *pQueue, uint64_
             }
             // First perform decrement on general case bound objects
             DecrementBoundResources(dev_data, cb_node);
-            for (auto drawDataElement : cb_node->drawData) {
+            for (auto const &drawDataElement : cb_node->drawData) {
                 for (auto buffer : drawDataElement.buffers) {
                     auto buffer_state = GetBufferState(dev_data, buffer);
                     if (buffer_state) {
@@ -4060,9 +4360,9 @@ static void RetireWorkOnQueue(layer_data *dev_data, QUEUE_STATE *pQueue, uint64_
     }
 
     // Roll other queues forward to the highest seq we saw a wait for
-    for (auto qs : otherQueueSeqs) {
-        RetireWorkOnQueue(dev_data, GetQueueState(dev_data, qs.first), qs.second);
-    }
+    otherQueueSeqs.ForEach([dev_data](QueueSeqTable<VkQueue>::Entry const &qs) {
+        RetireWorkOnQueue(dev_data, GetQueueState(dev_data, qs.queue), qs.target_seq);
+    });
 }
 
 // Submit a fence to a queue, delimiting previous fences and previous untracked
@@ -4118,7 +4418,7 @@ static bool validateResources(layer_data *dev_data, GLOBAL_CB_NODE *cb_node) {
     // TODO : We should be able to remove the NULL look-up checks from the code below as long as
     //  all the corresponding cases are verified to cause CB_INVALID state and the CB_INVALID state
     //  should then be flagged prior to calling this function
-    for (auto drawDataElement : cb_node->drawData) {
+    for (auto const &drawDataElement : cb_node->drawData) {
         for (auto buffer : drawDataElement.buffers) {
             auto buffer_state = GetBufferState(dev_data, buffer);
             if (!buffer_state) {
@@ -4319,6 +4619,9 @@ static void PostCallRecordQueueSubmit(layer_data *dev_data, VkQueue queue, uint3
     }
 }
 
+static bool ProcessEventUpdates(layer_data *dev_data, VkQueue queue, GLOBAL_CB_NODE *cb_node);
+static bool ProcessQueryUpdates(layer_data *dev_data, VkQueue queue, GLOBAL_CB_NODE const *cb_node);
+
 static bool PreCallValidateQueueSubmit(layer_data *dev_data, VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
                                        VkFence fence) {
     auto pFence = GetFenceNode(dev_data, fence);
@@ -4383,16 +4686,10 @@ static bool PreCallValidateQueueSubmit(layer_data *dev_data, VkQueue queue, uint
                     return true;
                 }
 
-                // Call submit-time functions to validate/update state
-                for (auto &function : cb_node->validate_functions) {
-                    skip |= function();
-                }
-                for (auto &function : cb_node->eventUpdates) {
-                    skip |= function(queue);
-                }
-                for (auto &function : cb_node->queryUpdates) {
-                    skip |= function(queue);
-                }
+                // Replay the submit-time checks and state updates recorded into the command buffer
+                skip |= ProcessMemoryAccesses(dev_data, cb_node);
+                skip |= ProcessEventUpdates(dev_data, queue, cb_node);
+                skip |= ProcessQueryUpdates(dev_data, queue, cb_node);
             }
         }
     }
@@ -4400,15 +4697,18 @@ static bool PreCallValidateQueueSubmit(layer_data *dev_data, VkQueue queue, uint
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) {
+    LAYER_STATS_CALL("vkQueueSubmit");
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
 
     bool skip = PreCallValidateQueueSubmit(dev_data, queue, submitCount, pSubmits, fence);
     lock.unlock();
 
     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
 
+    layer_stats_call.Pause();
     VkResult result = dev_data->dispatch_table.QueueSubmit(queue, submitCount, pSubmits, fence);
+    layer_stats_call.Resume();
 
     lock.lock();
     PostCallRecordQueueSubmit(dev_data, queue, submitCount, pSubmits, fence);
@@ -4437,7 +4737,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(VkDevice device, const VkMemoryAll
                                               const VkAllocationCallbacks *pAllocator, VkDeviceMemory *pMemory) {
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateAllocateMemory(dev_data);
     if (!skip) {
         lock.unlock();
@@ -4508,7 +4808,7 @@ VKAPI_ATTR void VKAPI_CALL FreeMemory(VkDevice device, VkDeviceMemory mem, const
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     DEVICE_MEM_INFO *mem_info = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateFreeMemory(dev_data, mem, &mem_info, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -4692,7 +4992,7 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitForFences(VkDevice device, uint32_t fenceCoun
                                              uint64_t timeout) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     // Verify fence status of submitted fences
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateWaitForFences(dev_data, fenceCount, pFences);
     lock.unlock();
     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -4716,7 +5016,7 @@ static void PostCallRecordGetFenceStatus(layer_data *dev_data, VkFence fence) {
 
 VKAPI_ATTR VkResult VKAPI_CALL GetFenceStatus(VkDevice device, VkFence fence) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateGetFenceStatus(dev_data, fence);
     lock.unlock();
     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -4744,7 +5044,7 @@ static void PostCallRecordGetDeviceQueue(layer_data *dev_data, uint32_t q_family
 VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue *pQueue) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     dev_data->dispatch_table.GetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<LayerStatsMutex> lock(global_lock);
 
     PostCallRecordGetDeviceQueue(dev_data, queueFamilyIndex, *pQueue);
 }
@@ -4762,7 +5062,7 @@ static void PostCallRecordQueueWaitIdle(layer_data *dev_data, QUEUE_STATE *queue
 VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(VkQueue queue) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     QUEUE_STATE *queue_state = nullptr;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateQueueWaitIdle(dev_data, queue, &queue_state);
     lock.unlock();
     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -4792,7 +5092,7 @@ static void PostCallRecordDeviceWaitIdle(layer_data *dev_data) {
 
 VKAPI_ATTR VkResult VKAPI_CALL DeviceWaitIdle(VkDevice device) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateDeviceWaitIdle(dev_data);
     lock.unlock();
     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -4827,7 +5127,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyFence(VkDevice device, VkFence fence, const Vk
     // Common data objects used pre & post call
     FENCE_NODE *fence_node = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateDestroyFence(dev_data, fence, &fence_node, &obj_struct);
 
     if (!skip) {
@@ -4856,7 +5156,7 @@ VKAPI_ATTR void VKAPI_CALL DestroySemaphore(VkDevice device, VkSemaphore semapho
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     SEMAPHORE_NODE *sema_node;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateDestroySemaphore(dev_data, semaphore, &sema_node, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -4886,7 +5186,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyEvent(VkDevice device, VkEvent event, const Vk
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     EVENT_STATE *event_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateDestroyEvent(dev_data, event, &event_state, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -4920,7 +5220,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyQueryPool(VkDevice device, VkQueryPool queryPo
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     QUERY_POOL_NODE *qp_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateDestroyQueryPool(dev_data, queryPool, &qp_state, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -5023,7 +5323,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(VkDevice device, VkQueryPool
                                                    size_t dataSize, void *pData, VkDeviceSize stride, VkQueryResultFlags flags) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     unordered_map<QueryObject, vector<VkCommandBuffer>> queries_in_flight;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateGetQueryPoolResults(dev_data, queryPool, firstQuery, queryCount, flags, &queries_in_flight);
     lock.unlock();
     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -5229,7 +5529,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyBuffer(VkDevice device, VkBuffer buffer, const
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     BUFFER_STATE *buffer_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateDestroyBuffer(dev_data, buffer, &buffer_state, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -5246,7 +5546,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyBufferView(VkDevice device, VkBufferView buffe
     // Common data objects used pre & post call
     BUFFER_VIEW_STATE *buffer_view_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     // Validate state before calling down chain, update common data if we'll be calling down chain
     bool skip = PreCallValidateDestroyBufferView(dev_data, bufferView, &buffer_view_state, &obj_struct);
     if (!skip) {
@@ -5263,7 +5563,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyImage(VkDevice device, VkImage image, const Vk
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     IMAGE_STATE *image_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateDestroyImage(dev_data, image, &image_state, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -5293,7 +5593,7 @@ static bool PreCallValidateBindBufferMemory(layer_data *dev_data, VkBuffer buffe
                                             VkDeviceSize memoryOffset) {
     bool skip = false;
     if (buffer_state) {
-        std::unique_lock<std::mutex> lock(global_lock);
+        std::unique_lock<LayerStatsMutex> lock(global_lock);
         // Track objects tied to memory
         uint64_t buffer_handle = reinterpret_cast<uint64_t &>(buffer);
         skip = ValidateSetMemBinding(dev_data, mem, buffer_handle, kVulkanObjectTypeBuffer, "vkBindBufferMemory()");
@@ -5384,7 +5684,7 @@ static bool PreCallValidateBindBufferMemory(layer_data *dev_data, VkBuffer buffe
 static void PostCallRecordBindBufferMemory(layer_data *dev_data, VkBuffer buffer, BUFFER_STATE *buffer_state, VkDeviceMemory mem,
                                            VkDeviceSize memoryOffset) {
     if (buffer_state) {
-        std::unique_lock<std::mutex> lock(global_lock);
+        std::unique_lock<LayerStatsMutex> lock(global_lock);
         // Track bound memory range information
         auto mem_info = GetMemObjInfo(dev_data, mem);
         if (mem_info) {
@@ -5441,7 +5741,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyImageView(VkDevice device, VkImageView imageVi
     // Common data objects used pre & post call
     IMAGE_VIEW_STATE *image_view_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateDestroyImageView(dev_data, imageView, &image_view_state, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -5457,7 +5757,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyShaderModule(VkDevice device, VkShaderModule s
                                                const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     dev_data->shaderModuleMap.erase(shaderModule);
     lock.unlock();
 
@@ -5487,7 +5787,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipeline(VkDevice device, VkPipeline pipeline,
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     PIPELINE_STATE *pipeline_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateDestroyPipeline(dev_data, pipeline, &pipeline_state, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -5502,7 +5802,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipeline(VkDevice device, VkPipeline pipeline,
 VKAPI_ATTR void VKAPI_CALL DestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout,
                                                  const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     dev_data->pipelineLayoutMap.erase(pipelineLayout);
     lock.unlock();
 
@@ -5532,7 +5832,7 @@ VKAPI_ATTR void VKAPI_CALL DestroySampler(VkDevice device, VkSampler sampler, co
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     SAMPLER_STATE *sampler_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateDestroySampler(dev_data, sampler, &sampler_state, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -5552,7 +5852,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorSetLayout(VkDevice device, VkDescrip
                                                       const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     dev_data->dispatch_table.DestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     PostCallRecordDestroyDescriptorSetLayout(dev_data, descriptorSetLayout);
 }
 
@@ -5584,7 +5884,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorPool(VkDevice device, VkDescriptorPo
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     DESCRIPTOR_POOL_STATE *desc_pool_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateDestroyDescriptorPool(dev_data, descriptorPool, &desc_pool_state, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -5637,7 +5937,7 @@ VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(VkDevice device, VkCommandPool com
                                               const VkCommandBuffer *pCommandBuffers) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
 
     for (uint32_t i = 0; i < commandBufferCount; i++) {
         auto cb_node = GetCBNode(dev_data, pCommandBuffers[i]);
@@ -5676,7 +5976,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(VkDevice device, const VkComman
     VkResult result = dev_data->dispatch_table.CreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
 
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<LayerStatsMutex> lock(global_lock);
         dev_data->commandPoolMap[*pCommandPool].createFlags = pCreateInfo->flags;
         dev_data->commandPoolMap[*pCommandPool].queueFamilyIndex = pCreateInfo->queueFamilyIndex;
     }
@@ -5702,7 +6002,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateQueryPool(VkDevice device, const VkQueryPoo
         result = dev_data->dispatch_table.CreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
     }
     if (result == VK_SUCCESS) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<LayerStatsMutex> lock(global_lock);
         QUERY_POOL_NODE *qp_node = &dev_data->queryPoolMap[*pQueryPool];
         qp_node->createInfo = *pCreateInfo;
     }
@@ -5745,7 +6045,7 @@ static void PostCallRecordDestroyCommandPool(layer_data *dev_data, VkCommandPool
 VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     COMMAND_POOL_NODE *cp_state = nullptr;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateDestroyCommandPool(dev_data, commandPool, &cp_state);
     if (!skip) {
         lock.unlock();
@@ -5761,7 +6061,7 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandPool(VkDevice device, VkCommandPool c
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     auto pPool = GetCommandPoolNode(dev_data, commandPool);
     skip |= checkCommandBuffersInFlight(dev_data, pPool, "reset command pool with", VALIDATION_ERROR_00072);
     lock.unlock();
@@ -5785,7 +6085,7 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandPool(VkDevice device, VkCommandPool c
 VKAPI_ATTR VkResult VKAPI_CALL ResetFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     for (uint32_t i = 0; i < fenceCount; ++i) {
         auto pFence = GetFenceNode(dev_data, pFences[i]);
         if (pFence && pFence->state == FENCE_INFLIGHT) {
@@ -5850,7 +6150,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyFramebuffer(VkDevice device, VkFramebuffer fra
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     FRAMEBUFFER_STATE *framebuffer_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateDestroyFramebuffer(dev_data, framebuffer, &framebuffer_state, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -5884,7 +6184,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyRenderPass(VkDevice device, VkRenderPass rende
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     RENDER_PASS_STATE *rp_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateDestroyRenderPass(dev_data, renderPass, &rp_state, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -5899,7 +6199,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyRenderPass(VkDevice device, VkRenderPass rende
 VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice device, const VkBufferCreateInfo *pCreateInfo,
                                             const VkAllocationCallbacks *pAllocator, VkBuffer *pBuffer) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateCreateBuffer(dev_data, pCreateInfo);
     lock.unlock();
 
@@ -5917,7 +6217,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice device, const VkBufferCreat
 VKAPI_ATTR VkResult VKAPI_CALL CreateBufferView(VkDevice device, const VkBufferViewCreateInfo *pCreateInfo,
                                                 const VkAllocationCallbacks *pAllocator, VkBufferView *pView) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateCreateBufferView(dev_data, pCreateInfo);
     lock.unlock();
     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -5956,7 +6256,7 @@ const VkPhysicalDeviceProperties *GetPhysicalDeviceProperties(core_validation::l
     return &device_data->phys_dev_props;
 }
 
-const CHECK_DISABLED *GetDisables(core_validation::layer_data *device_data) { return &device_data->instance_data->disabled; }
+const CHECK_DISABLED *GetDisables(core_validation::layer_data const *device_data) { return &device_data->instance_data->disabled; }
 
 std::unordered_map<VkImage, std::unique_ptr<IMAGE_STATE>> *GetImageMap(core_validation::layer_data *device_data) {
     return &device_data->imageMap;
@@ -6005,7 +6305,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImage(VkDevice device, const VkImageCreateI
         result = dev_data->dispatch_table.CreateImage(device, pCreateInfo, pAllocator, pImage);
     }
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<LayerStatsMutex> lock(global_lock);
         PostCallRecordCreateImage(dev_data, pCreateInfo, pImage);
     }
     return result;
@@ -6014,7 +6314,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImage(VkDevice device, const VkImageCreateI
 VKAPI_ATTR VkResult VKAPI_CALL CreateImageView(VkDevice device, const VkImageViewCreateInfo *pCreateInfo,
                                                const VkAllocationCallbacks *pAllocator, VkImageView *pView) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateCreateImageView(dev_data, pCreateInfo);
     lock.unlock();
     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -6033,7 +6333,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFence(VkDevice device, const VkFenceCreateI
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->dispatch_table.CreateFence(device, pCreateInfo, pAllocator, pFence);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<LayerStatsMutex> lock(global_lock);
         auto &fence_node = dev_data->fenceMap[*pFence];
         fence_node.fence = *pFence;
         fence_node.createInfo = *pCreateInfo;
@@ -6117,6 +6417,62 @@ bool validate_dual_src_blend_feature(layer_data *device_data, PIPELINE_STATE *pi
     return skip;
 }
 
+// Pipeline batches at least this large have their per-pipeline setup spread across worker threads
+static const uint32_t kParallelPipelineBatchThreshold = 8;
+static const uint32_t kPipelinesPerWorker = 4;
+
+// Call func(i) for each i in [0, count), spreading the calls across the device's worker pool when the batch is large enough
+// for that to pay off. Returns once every index has been processed; an exception thrown by func is rethrown here. func must
+// only modify state owned by its index, and anything else it reads must not be modified by the calling thread until this
+// returns. Must be called with global_lock held.
+template <typename FUNC>
+static void ForEachPipelineInBatch(layer_data *dev_data, uint32_t count, FUNC func) {
+    const uint32_t hardware_threads = std::thread::hardware_concurrency();
+    if (count < kParallelPipelineBatchThreshold || count / kPipelinesPerWorker < 2 || hardware_threads < 2) {
+        for (uint32_t i = 0; i < count; i++) {
+            func(i);
+        }
+        return;
+    }
+
+    if (!dev_data->pipeline_worker_pool) {
+        dev_data->pipeline_worker_pool.reset(new PipelineWorkerPool(hardware_threads - 1));
+    }
+    dev_data->pipeline_worker_pool->Run(count, func);
+}
+
+// Build (or find already cached) the reflection results for a pipeline's shader stage, so that the later serial validation
+// pass only has to look them up. Nothing is reported here.
+static void PrepareShaderStageReflection(layer_data const *dev_data, VkPipelineShaderStageCreateInfo const *pStage) {
+    auto module_it = dev_data->shaderModuleMap.find(pStage->module);
+    if (module_it == dev_data->shaderModuleMap.end() || !module_it->second->has_valid_spirv) return;
+    get_entrypoint_info(dev_data->report_data, module_it->second.get(), pStage->pName, pStage->stage);
+}
+
+// Shadow the create state for one graphics pipeline and prepare its shader reflection. This may run on a worker thread, so it
+// only reads device state and leaves all validation and reporting to PreCallCreateGraphicsPipelines.
+static void InitGraphicsPipelineState(layer_data *dev_data, PIPELINE_STATE *pipe_state,
+                                      const VkGraphicsPipelineCreateInfo *create_info) {
+    pipe_state->initGraphicsPipeline(create_info);
+    pipe_state->render_pass_ci.initialize(GetRenderPassState(dev_data, create_info->renderPass)->createInfo.ptr());
+    pipe_state->pipeline_layout = *getPipelineLayout(dev_data, create_info->layout);
+    if (!GetDisables(dev_data)->shader_validation) {
+        for (uint32_t i = 0; i < create_info->stageCount; i++) {
+            PrepareShaderStageReflection(dev_data, &create_info->pStages[i]);
+        }
+    }
+}
+
+// Compute counterpart of InitGraphicsPipelineState
+static void InitComputePipelineState(layer_data *dev_data, PIPELINE_STATE *pipe_state,
+                                     const VkComputePipelineCreateInfo *create_info) {
+    pipe_state->initComputePipeline(create_info);
+    pipe_state->pipeline_layout = *getPipelineLayout(dev_data, create_info->layout);
+    if (!GetDisables(dev_data)->shader_validation) {
+        PrepareShaderStageReflection(dev_data, &create_info->stage);
+    }
+}
+
 static bool PreCallCreateGraphicsPipelines(layer_data *device_data, uint32_t count,
                                            const VkGraphicsPipelineCreateInfo *create_infos, vector<PIPELINE_STATE *> &pipe_state) {
     bool skip = false;
@@ -6125,7 +6481,9 @@ static bool PreCallCreateGraphicsPipelines(layer_data *device_data, uint32_t cou
 
     for (uint32_t i = 0; i < count; i++) {
         skip |= verifyPipelineCreateState(device_data, pipe_state, i);
-        if (create_infos[i].pVertexInputState != NULL) {
+        // Each attribute costs a format query down the chain, only to report VALIDATION_ERROR_01413
+        if (create_infos[i].pVertexInputState != NULL &&
+            will_log_msg(device_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VALIDATION_ERROR_01413)) {
             for (uint32_t j = 0; j < create_infos[i].pVertexInputState->vertexAttributeDescriptionCount; j++) {
                 VkFormat format = create_infos[i].pVertexInputState->pVertexAttributeDescriptions[j].format;
                 // Internal call to get format info.  Still goes through layers, could potentially go directly to ICD.
@@ -6159,14 +6517,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipeli
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
 
     uint32_t i = 0;
-    std::unique_lock<std::mutex> lock(global_lock);
-
-    for (i = 0; i < count; i++) {
-        pipe_state[i] = new PIPELINE_STATE;
-        pipe_state[i]->initGraphicsPipeline(&pCreateInfos[i]);
-        pipe_state[i]->render_pass_ci.initialize(GetRenderPassState(dev_data, pCreateInfos[i].renderPass)->createInfo.ptr());
-        pipe_state[i]->pipeline_layout = *getPipelineLayout(dev_data, pCreateInfos[i].layout);
-    }
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
+
+    // The shadowing and SPIR-V reflection are the expensive part and are independent per pipeline; validation itself is then
+    // done serially, in index order, so messages are reported exactly as for a one-at-a-time walk of the batch.
+    ForEachPipelineInBatch(dev_data, count, [&](uint32_t index) {
+        pipe_state[index] = new PIPELINE_STATE;
+        InitGraphicsPipelineState(dev_data, pipe_state[index], &pCreateInfos[index]);
+    });
     skip |= PreCallCreateGraphicsPipelines(dev_data, count, pCreateInfos, pipe_state);
 
     if (skip) {
@@ -6203,15 +6561,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(VkDevice device, VkPipelin
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
 
     uint32_t i = 0;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
+
+    // Create and initialize internal tracking data structures, see CreateGraphicsPipelines
+    ForEachPipelineInBatch(dev_data, count, [&](uint32_t index) {
+        pPipeState[index] = new PIPELINE_STATE;
+        InitComputePipelineState(dev_data, pPipeState[index], &pCreateInfos[index]);
+    });
+
     for (i = 0; i < count; i++) {
         // TODO: Verify compute stage bits
 
-        // Create and initialize internal tracking data structure
-        pPipeState[i] = new PIPELINE_STATE;
-        pPipeState[i]->initComputePipeline(&pCreateInfos[i]);
-        pPipeState[i]->pipeline_layout = *getPipelineLayout(dev_data, pCreateInfos[i].layout);
-
         // TODO: Add Compute Pipeline Verification
         skip |= !validate_compute_pipeline(dev_data, pPipeState[i]);
         // skip |= verifyPipelineCreateState(dev_data, pPipeState[i]);
@@ -6247,7 +6607,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSampler(VkDevice device, const VkSamplerCre
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->dispatch_table.CreateSampler(device, pCreateInfo, pAllocator, pSampler);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<LayerStatsMutex> lock(global_lock);
         dev_data->samplerMap[*pSampler] = unique_ptr<SAMPLER_STATE>(new SAMPLER_STATE(pSampler, pCreateInfo));
     }
     return result;
@@ -6269,7 +6629,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorSetLayout(VkDevice device, const
                                                          VkDescriptorSetLayout *pSetLayout) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateCreateDescriptorSetLayout(dev_data, pCreateInfo);
     if (!skip) {
         lock.unlock();
@@ -6421,7 +6781,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(VkDevice device, const VkPip
 
     VkResult result = dev_data->dispatch_table.CreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<LayerStatsMutex> lock(global_lock);
         PIPELINE_LAYOUT_NODE &plNode = dev_data->pipelineLayoutMap[*pPipelineLayout];
         plNode.layout = *pPipelineLayout;
         plNode.set_layouts.resize(pCreateInfo->setLayoutCount);
@@ -6448,7 +6808,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorPool(VkDevice device, const VkDes
                         "Out of memory while attempting to allocate DESCRIPTOR_POOL_STATE in vkCreateDescriptorPool()"))
                 return VK_ERROR_VALIDATION_FAILED_EXT;
         } else {
-            std::lock_guard<std::mutex> lock(global_lock);
+            std::lock_guard<LayerStatsMutex> lock(global_lock);
             dev_data->descriptorPoolMap[*pDescriptorPool] = pNewNode;
         }
     } else {
@@ -6463,7 +6823,7 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetDescriptorPool(VkDevice device, VkDescriptor
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->dispatch_table.ResetDescriptorPool(device, descriptorPool, flags);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<LayerStatsMutex> lock(global_lock);
         clearDescriptorPool(dev_data, device, descriptorPool, flags);
     }
     return result;
@@ -6491,7 +6851,7 @@ static void PostCallRecordAllocateDescriptorSets(layer_data *dev_data, const VkD
 VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo *pAllocateInfo,
                                                       VkDescriptorSet *pDescriptorSets) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     cvdescriptorset::AllocateDescriptorSetsData common_data(pAllocateInfo->descriptorSetCount);
     bool skip = PreCallValidateAllocateDescriptorSets(dev_data, pAllocateInfo, &common_data);
     lock.unlock();
@@ -6557,7 +6917,7 @@ VKAPI_ATTR VkResult VKAPI_CALL FreeDescriptorSets(VkDevice device, VkDescriptorP
                                                   const VkDescriptorSet *pDescriptorSets) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     // Make sure that no sets being destroyed are in-flight
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateFreeDescriptorSets(dev_data, descriptorPool, count, pDescriptorSets);
     lock.unlock();
 
@@ -6599,15 +6959,18 @@ static void PostCallRecordUpdateDescriptorSets(layer_data *dev_data, uint32_t de
 VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount,
                                                 const VkWriteDescriptorSet *pDescriptorWrites, uint32_t descriptorCopyCount,
                                                 const VkCopyDescriptorSet *pDescriptorCopies) {
+    LAYER_STATS_CALL("vkUpdateDescriptorSets");
     // Only map look-up at top level is for device-level layer_data
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateUpdateDescriptorSets(dev_data, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount,
                                                     pDescriptorCopies);
     lock.unlock();
     if (!skip) {
+        layer_stats_call.Pause();
         dev_data->dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount,
                                                       pDescriptorCopies);
+        layer_stats_call.Resume();
         lock.lock();
         // Since UpdateDescriptorSets() is void, nothing to check prior to updating state
         PostCallRecordUpdateDescriptorSets(dev_data, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount,
@@ -6620,7 +6983,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(VkDevice device, const VkC
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->dispatch_table.AllocateCommandBuffers(device, pCreateInfo, pCommandBuffer);
     if (VK_SUCCESS == result) {
-        std::unique_lock<std::mutex> lock(global_lock);
+        std::unique_lock<LayerStatsMutex> lock(global_lock);
         auto pPool = GetCommandPoolNode(dev_data, pCreateInfo->commandPool);
 
         if (pPool) {
@@ -6660,9 +7023,10 @@ static void AddFramebufferBinding(layer_data *dev_data, GLOBAL_CB_NODE *cb_state
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo *pBeginInfo) {
+    LAYER_STATS_CALL("vkBeginCommandBuffer");
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     // Validate command buffer level
     GLOBAL_CB_NODE *cb_node = GetCBNode(dev_data, commandBuffer);
     if (cb_node) {
@@ -6779,15 +7143,18 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer commandBuffer,
     if (skip) {
         return VK_ERROR_VALIDATION_FAILED_EXT;
     }
+    layer_stats_call.Pause();
     VkResult result = dev_data->dispatch_table.BeginCommandBuffer(commandBuffer, pBeginInfo);
+    layer_stats_call.Resume();
 
     return result;
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(VkCommandBuffer commandBuffer) {
+    LAYER_STATS_CALL("vkEndCommandBuffer");
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         if ((VK_COMMAND_BUFFER_LEVEL_PRIMARY == pCB->createInfo.level) ||
@@ -6807,7 +7174,9 @@ VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(VkCommandBuffer commandBuffer) {
     }
     if (!skip) {
         lock.unlock();
+        layer_stats_call.Pause();
         auto result = dev_data->dispatch_table.EndCommandBuffer(commandBuffer);
+        layer_stats_call.Resume();
         lock.lock();
         if (VK_SUCCESS == result) {
             pCB->state = CB_RECORDED;
@@ -6821,7 +7190,7 @@ VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(VkCommandBuffer commandBuffer) {
 VKAPI_ATTR VkResult VKAPI_CALL ResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     VkCommandPool cmdPool = pCB->createInfo.commandPool;
     auto pPool = GetCommandPoolNode(dev_data, cmdPool);
@@ -6847,9 +7216,10 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandBuffer(VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
                                            VkPipeline pipeline) {
+    LAYER_STATS_CALL("vkCmdBindPipeline");
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *cb_state = GetCBNode(dev_data, commandBuffer);
     if (cb_state) {
         skip |= ValidateCmdQueueFlags(dev_data, cb_state, "vkCmdBindPipeline()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
@@ -6890,14 +7260,16 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipe
         }
     }
     lock.unlock();
+    layer_stats_call.Pause();
     if (!skip) dev_data->dispatch_table.CmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
+    layer_stats_call.Resume();
 }
 
 VKAPI_ATTR void VKAPI_CALL CmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
                                           const VkViewport *pViewports) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetViewport()", VK_QUEUE_GRAPHICS_BIT, VALIDATION_ERROR_01446);
@@ -6913,7 +7285,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t
                                          const VkRect2D *pScissors) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetScissor()", VK_QUEUE_GRAPHICS_BIT, VALIDATION_ERROR_01495);
@@ -6928,7 +7300,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t
 VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetLineWidth()", VK_QUEUE_GRAPHICS_BIT, VALIDATION_ERROR_01480);
@@ -6956,7 +7328,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(VkCommandBuffer commandBuffer, float
                                            float depthBiasSlopeFactor) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetDepthBias()", VK_QUEUE_GRAPHICS_BIT, VALIDATION_ERROR_01485);
@@ -6981,7 +7353,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(VkCommandBuffer commandBuffer, float
 VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4]) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetBlendConstants()", VK_QUEUE_GRAPHICS_BIT, VALIDATION_ERROR_01553);
@@ -6996,7 +7368,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(VkCommandBuffer commandBuffer, c
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetDepthBounds()", VK_QUEUE_GRAPHICS_BIT, VALIDATION_ERROR_01509);
@@ -7012,7 +7384,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(VkCommandBuffer commandBuffe
                                                     uint32_t compareMask) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetStencilCompareMask()", VK_QUEUE_GRAPHICS_BIT, VALIDATION_ERROR_01519);
@@ -7027,7 +7399,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(VkCommandBuffer commandBuffe
 VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetStencilWriteMask()", VK_QUEUE_GRAPHICS_BIT, VALIDATION_ERROR_01525);
@@ -7042,7 +7414,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(VkCommandBuffer commandBuffer,
 VKAPI_ATTR void VKAPI_CALL CmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetStencilReference()", VK_QUEUE_GRAPHICS_BIT, VALIDATION_ERROR_01531);
@@ -7058,9 +7430,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(VkCommandBuffer commandBuffer,
                                                  VkPipelineLayout layout, uint32_t firstSet, uint32_t setCount,
                                                  const VkDescriptorSet *pDescriptorSets, uint32_t dynamicOffsetCount,
                                                  const uint32_t *pDynamicOffsets) {
+    LAYER_STATS_CALL("vkCmdBindDescriptorSets");
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *cb_state = GetCBNode(dev_data, commandBuffer);
     if (cb_state) {
         skip |= ValidateCmdQueueFlags(dev_data, cb_state, "vkCmdBindDescriptorSets()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
@@ -7213,9 +7586,12 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(VkCommandBuffer commandBuffer,
         }
     }
     lock.unlock();
-    if (!skip)
+    if (!skip) {
+        layer_stats_call.Pause();
         dev_data->dispatch_table.CmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, setCount,
                                                        pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+        layer_stats_call.Resume();
+    }
 }
 
 VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
@@ -7223,7 +7599,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkB
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     // TODO : Somewhere need to verify that IBs have correct usage state flagged
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
 
     auto buffer_state = GetBufferState(dev_data, buffer);
     auto cb_node = GetCBNode(dev_data, commandBuffer);
@@ -7231,10 +7607,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkB
         skip |= ValidateCmdQueueFlags(dev_data, cb_node, "vkCmdBindIndexBuffer()", VK_QUEUE_GRAPHICS_BIT, VALIDATION_ERROR_01357);
         skip |= ValidateCmd(dev_data, cb_node, CMD_BINDINDEXBUFFER, "vkCmdBindIndexBuffer()");
         skip |= ValidateMemoryIsBoundToBuffer(dev_data, buffer_state, "vkCmdBindIndexBuffer()", VALIDATION_ERROR_02543);
-        std::function<bool()> function = [=]() {
-            return ValidateBufferMemoryIsValid(dev_data, buffer_state, "vkCmdBindIndexBuffer()");
-        };
-        cb_node->validate_functions.push_back(function);
+        AddDeferredBufferMemoryCheck(cb_node, buffer_state, "vkCmdBindIndexBuffer()");
         UpdateCmdBufferLastCmd(cb_node, CMD_BINDINDEXBUFFER);
         VkDeviceSize offset_align = 0;
         switch (indexType) {
@@ -7272,14 +7645,21 @@ void updateResourceTracking(GLOBAL_CB_NODE *pCB, uint32_t firstBinding, uint32_t
     }
 }
 
-static inline void updateResourceTrackingOnDraw(GLOBAL_CB_NODE *pCB) { pCB->drawData.push_back(pCB->currentDrawData); }
+// Only record a new draw-data snapshot when the bound vertex buffers changed since the last draw, so submit-time
+// in_use accounting and retirement scale with the number of distinct bindings rather than the number of draws
+static inline void updateResourceTrackingOnDraw(GLOBAL_CB_NODE *pCB) {
+    if (pCB->drawData.empty() || pCB->drawData.back().buffers != pCB->currentDrawData.buffers) {
+        pCB->drawData.push_back(pCB->currentDrawData);
+    }
+}
 
 VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount,
                                                 const VkBuffer *pBuffers, const VkDeviceSize *pOffsets) {
+    LAYER_STATS_CALL("vkCmdBindVertexBuffers");
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     // TODO : Somewhere need to verify that VBs have correct usage state flagged
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
 
     auto cb_node = GetCBNode(dev_data, commandBuffer);
     if (cb_node) {
@@ -7289,10 +7669,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(VkCommandBuffer commandBuffer, u
             auto buffer_state = GetBufferState(dev_data, pBuffers[i]);
             assert(buffer_state);
             skip |= ValidateMemoryIsBoundToBuffer(dev_data, buffer_state, "vkCmdBindVertexBuffers()", VALIDATION_ERROR_02546);
-            std::function<bool()> function = [=]() {
-                return ValidateBufferMemoryIsValid(dev_data, buffer_state, "vkCmdBindVertexBuffers()");
-            };
-            cb_node->validate_functions.push_back(function);
+            AddDeferredBufferMemoryCheck(cb_node, buffer_state, "vkCmdBindVertexBuffers()");
         }
         UpdateCmdBufferLastCmd(cb_node, CMD_BINDVERTEXBUFFER);
         updateResourceTracking(cb_node, firstBinding, bindingCount, pBuffers);
@@ -7300,7 +7677,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(VkCommandBuffer commandBuffer, u
         assert(0);
     }
     lock.unlock();
+    layer_stats_call.Pause();
     if (!skip) dev_data->dispatch_table.CmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+    layer_stats_call.Resume();
 }
 
 // Expects global_lock to be held by caller
@@ -7311,20 +7690,12 @@ static void MarkStoreImagesAndBuffersAsWritten(layer_data *dev_data, GLOBAL_CB_N
 
         auto image_state = GetImageState(dev_data, view_state->create_info.image);
         assert(image_state);
-        std::function<bool()> function = [=]() {
-            SetImageMemoryValid(dev_data, image_state, true);
-            return false;
-        };
-        pCB->validate_functions.push_back(function);
+        AddDeferredImageMemoryUpdate(pCB, image_state, true);
     }
     for (auto buffer : pCB->updateBuffers) {
         auto buffer_state = GetBufferState(dev_data, buffer);
         assert(buffer_state);
-        std::function<bool()> function = [=]() {
-            SetBufferMemoryValid(dev_data, buffer_state, true);
-            return false;
-        };
-        pCB->validate_functions.push_back(function);
+        AddDeferredBufferMemoryUpdate(pCB, buffer_state, true);
     }
 }
 
@@ -7373,13 +7744,16 @@ static void PostCallRecordCmdDraw(layer_data *dev_data, GLOBAL_CB_NODE *cb_state
 
 VKAPI_ATTR void VKAPI_CALL CmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
                                    uint32_t firstVertex, uint32_t firstInstance) {
+    LAYER_STATS_CALL("vkCmdDraw");
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     GLOBAL_CB_NODE *cb_state = nullptr;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateCmdDraw(dev_data, commandBuffer, false, VK_PIPELINE_BIND_POINT_GRAPHICS, &cb_state, "vkCmdDraw()");
     lock.unlock();
     if (!skip) {
+        layer_stats_call.Pause();
         dev_data->dispatch_table.CmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+        layer_stats_call.Resume();
         lock.lock();
         PostCallRecordCmdDraw(dev_data, cb_state, VK_PIPELINE_BIND_POINT_GRAPHICS);
         lock.unlock();
@@ -7398,14 +7772,17 @@ static void PostCallRecordCmdDrawIndexed(layer_data *dev_data, GLOBAL_CB_NODE *c
 
 VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount,
                                           uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) {
+    LAYER_STATS_CALL("vkCmdDrawIndexed");
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     GLOBAL_CB_NODE *cb_state = nullptr;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateCmdDrawIndexed(dev_data, commandBuffer, true, VK_PIPELINE_BIND_POINT_GRAPHICS, &cb_state,
                                               "vkCmdDrawIndexed()");
     lock.unlock();
     if (!skip) {
+        layer_stats_call.Pause();
         dev_data->dispatch_table.CmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+        layer_stats_call.Resume();
         lock.lock();
         PostCallRecordCmdDrawIndexed(dev_data, cb_state, VK_PIPELINE_BIND_POINT_GRAPHICS);
         lock.unlock();
@@ -7432,15 +7809,18 @@ static void PostCallRecordCmdDrawIndirect(layer_data *dev_data, GLOBAL_CB_NODE *
 
 VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t count,
                                            uint32_t stride) {
+    LAYER_STATS_CALL("vkCmdDrawIndirect");
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     GLOBAL_CB_NODE *cb_state = nullptr;
     BUFFER_STATE *buffer_state = nullptr;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateCmdDrawIndirect(dev_data, commandBuffer, buffer, false, VK_PIPELINE_BIND_POINT_GRAPHICS, &cb_state,
                                                &buffer_state, "vkCmdDrawIndirect()");
     lock.unlock();
     if (!skip) {
+        layer_stats_call.Pause();
         dev_data->dispatch_table.CmdDrawIndirect(commandBuffer, buffer, offset, count, stride);
+        layer_stats_call.Resume();
         lock.lock();
         PostCallRecordCmdDrawIndirect(dev_data, cb_state, VK_PIPELINE_BIND_POINT_GRAPHICS, buffer_state);
         lock.unlock();
@@ -7468,15 +7848,18 @@ static void PostCallRecordCmdDrawIndexedIndirect(layer_data *dev_data, GLOBAL_CB
 
 VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                   uint32_t count, uint32_t stride) {
+    LAYER_STATS_CALL("vkCmdDrawIndexedIndirect");
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     GLOBAL_CB_NODE *cb_state = nullptr;
     BUFFER_STATE *buffer_state = nullptr;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateCmdDrawIndexedIndirect(dev_data, commandBuffer, buffer, true, VK_PIPELINE_BIND_POINT_GRAPHICS,
                                                       &cb_state, &buffer_state, "vkCmdDrawIndexedIndirect()");
     lock.unlock();
     if (!skip) {
+        layer_stats_call.Pause();
         dev_data->dispatch_table.CmdDrawIndexedIndirect(commandBuffer, buffer, offset, count, stride);
+        layer_stats_call.Resume();
         lock.lock();
         PostCallRecordCmdDrawIndexedIndirect(dev_data, cb_state, VK_PIPELINE_BIND_POINT_GRAPHICS, buffer_state);
         lock.unlock();
@@ -7494,14 +7877,17 @@ static void PostCallRecordCmdDispatch(layer_data *dev_data, GLOBAL_CB_NODE *cb_s
 }
 
 VKAPI_ATTR void VKAPI_CALL CmdDispatch(VkCommandBuffer commandBuffer, uint32_t x, uint32_t y, uint32_t z) {
+    LAYER_STATS_CALL("vkCmdDispatch");
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     GLOBAL_CB_NODE *cb_state = nullptr;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip =
         PreCallValidateCmdDispatch(dev_data, commandBuffer, false, VK_PIPELINE_BIND_POINT_COMPUTE, &cb_state, "vkCmdDispatch()");
     lock.unlock();
     if (!skip) {
+        layer_stats_call.Pause();
         dev_data->dispatch_table.CmdDispatch(commandBuffer, x, y, z);
+        layer_stats_call.Resume();
         lock.lock();
         PostCallRecordCmdDispatch(dev_data, cb_state, VK_PIPELINE_BIND_POINT_COMPUTE);
         lock.unlock();
@@ -7529,7 +7915,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(VkCommandBuffer commandBuffer, Vk
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     GLOBAL_CB_NODE *cb_state = nullptr;
     BUFFER_STATE *buffer_state = nullptr;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateCmdDispatchIndirect(dev_data, commandBuffer, buffer, false, VK_PIPELINE_BIND_POINT_COMPUTE,
                                                    &cb_state, &buffer_state, "vkCmdDispatchIndirect()");
     lock.unlock();
@@ -7544,7 +7930,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(VkCommandBuffer commandBuffer, Vk
 VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
                                          uint32_t regionCount, const VkBufferCopy *pRegions) {
     layer_data *device_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
 
     auto cb_node = GetCBNode(device_data, commandBuffer);
     auto src_buffer_state = GetBufferState(device_data, srcBuffer);
@@ -7568,7 +7954,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage(VkCommandBuffer commandBuffer, VkImage s
                                         const VkImageCopy *pRegions) {
     bool skip = false;
     layer_data *device_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
 
     auto cb_node = GetCBNode(device_data, commandBuffer);
     auto src_image_state = GetImageState(device_data, srcImage);
@@ -7608,7 +7994,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage(VkCommandBuffer commandBuffer, VkImage s
                                         VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                         const VkImageBlit *pRegions, VkFilter filter) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
 
     auto cb_node = GetCBNode(dev_data, commandBuffer);
     auto src_image_state = GetImageState(dev_data, srcImage);
@@ -7627,8 +8013,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage(VkCommandBuffer commandBuffer, VkImage s
 VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage,
                                                 VkImageLayout dstImageLayout, uint32_t regionCount,
                                                 const VkBufferImageCopy *pRegions) {
+    LAYER_STATS_CALL("vkCmdCopyBufferToImage");
     layer_data *device_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = false;
     auto cb_node = GetCBNode(device_data, commandBuffer);
     auto src_buffer_state = GetBufferState(device_data, srcBuffer);
@@ -7645,7 +8032,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(VkCommandBuffer commandBuffer, V
         PreCallRecordCmdCopyBufferToImage(device_data, cb_node, src_buffer_state, dst_image_state, regionCount, pRegions,
                                           dstImageLayout);
         lock.unlock();
+        layer_stats_call.Pause();
         device_data->dispatch_table.CmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+        layer_stats_call.Resume();
     }
 }
 
@@ -7653,7 +8042,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(VkCommandBuffer commandBuffer, V
                                                 VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy *pRegions) {
     bool skip = false;
     layer_data *device_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
 
     auto cb_node = GetCBNode(device_data, commandBuffer);
     auto src_image_state = GetImageState(device_data, srcImage);
@@ -7678,7 +8067,7 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuff
                                            VkDeviceSize dataSize, const uint32_t *pData) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
 
     auto cb_node = GetCBNode(dev_data, commandBuffer);
     auto dst_buff_state = GetBufferState(dev_data, dstBuffer);
@@ -7689,11 +8078,7 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuff
         // Validate that DST buffer has correct usage flags set
         skip |= ValidateBufferUsageFlags(dev_data, dst_buff_state, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true, VALIDATION_ERROR_01146,
                                          "vkCmdUpdateBuffer()", "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
-        std::function<bool()> function = [=]() {
-            SetBufferMemoryValid(dev_data, dst_buff_state, true);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        AddDeferredBufferMemoryUpdate(cb_node, dst_buff_state, true);
 
         skip |= ValidateCmdQueueFlags(dev_data, cb_node, "vkCmdUpdateBuffer()",
                                       VK_QUEUE_TRANSFER_BIT | VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, VALIDATION_ERROR_01154);
@@ -7710,7 +8095,7 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuff
 VKAPI_ATTR void VKAPI_CALL CmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                          VkDeviceSize size, uint32_t data) {
     layer_data *device_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     auto cb_node = GetCBNode(device_data, commandBuffer);
     auto buffer_state = GetBufferState(device_data, dstBuffer);
 
@@ -7733,7 +8118,7 @@ VKAPI_ATTR void VKAPI_CALL CmdClearAttachments(VkCommandBuffer commandBuffer, ui
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<LayerStatsMutex> lock(global_lock);
         skip = PreCallValidateCmdClearAttachments(dev_data, commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
     }
     if (!skip) dev_data->dispatch_table.CmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
@@ -7743,7 +8128,7 @@ VKAPI_ATTR void VKAPI_CALL CmdClearColorImage(VkCommandBuffer commandBuffer, VkI
                                               const VkClearColorValue *pColor, uint32_t rangeCount,
                                               const VkImageSubresourceRange *pRanges) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
 
     bool skip = PreCallValidateCmdClearColorImage(dev_data, commandBuffer, image, imageLayout, rangeCount, pRanges);
     if (!skip) {
@@ -7757,7 +8142,7 @@ VKAPI_ATTR void VKAPI_CALL CmdClearDepthStencilImage(VkCommandBuffer commandBuff
                                                      const VkClearDepthStencilValue *pDepthStencil, uint32_t rangeCount,
                                                      const VkImageSubresourceRange *pRanges) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
 
     bool skip = PreCallValidateCmdClearDepthStencilImage(dev_data, commandBuffer, image, imageLayout, rangeCount, pRanges);
     if (!skip) {
@@ -7771,7 +8156,7 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage(VkCommandBuffer commandBuffer, VkImag
                                            VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                            const VkImageResolve *pRegions) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
 
     auto cb_node = GetCBNode(dev_data, commandBuffer);
     auto src_image_state = GetImageState(dev_data, srcImage);
@@ -7813,7 +8198,7 @@ bool setEventStageMask(VkQueue queue, VkCommandBuffer commandBuffer, VkEvent eve
 VKAPI_ATTR void VKAPI_CALL CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetEvent()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
@@ -7833,9 +8218,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent ev
         if (!pCB->waitedEvents.count(event)) {
             pCB->writeEventsBeforeWait.push_back(event);
         }
-        std::function<bool(VkQueue)> eventUpdate =
-            std::bind(setEventStageMask, std::placeholders::_1, commandBuffer, event, stageMask);
-        pCB->eventUpdates.push_back(eventUpdate);
+        pCB->eventUpdates.push_back({CB_EVENT_SET_STAGE_MASK, event, stageMask, 0, 0});
     }
     lock.unlock();
     if (!skip) dev_data->dispatch_table.CmdSetEvent(commandBuffer, event, stageMask);
@@ -7844,7 +8227,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent ev
 VKAPI_ATTR void VKAPI_CALL CmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdResetEvent()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
@@ -7865,9 +8248,7 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent(VkCommandBuffer commandBuffer, VkEvent
             pCB->writeEventsBeforeWait.push_back(event);
         }
         // TODO : Add check for VALIDATION_ERROR_00226
-        std::function<bool(VkQueue)> eventUpdate =
-            std::bind(setEventStageMask, std::placeholders::_1, commandBuffer, event, VkPipelineStageFlags(0));
-        pCB->eventUpdates.push_back(eventUpdate);
+        pCB->eventUpdates.push_back({CB_EVENT_SET_STAGE_MASK, event, VkPipelineStageFlags(0), 0, 0});
     }
     lock.unlock();
     if (!skip) dev_data->dispatch_table.CmdResetEvent(commandBuffer, event, stageMask);
@@ -8089,6 +8470,19 @@ bool validateEventStageMask(VkQueue queue, GLOBAL_CB_NODE *pCB, uint32_t eventCo
     return skip;
 }
 
+// Apply the event updates recorded into a command buffer against the given queue
+static bool ProcessEventUpdates(layer_data *dev_data, VkQueue queue, GLOBAL_CB_NODE *cb_node) {
+    bool skip = false;
+    for (auto const &update : cb_node->eventUpdates) {
+        if (update.type == CB_EVENT_SET_STAGE_MASK) {
+            skip |= setEventStageMask(queue, cb_node->commandBuffer, update.event, update.stage_mask);
+        } else {
+            skip |= validateEventStageMask(queue, cb_node, update.event_count, update.first_event_index, update.stage_mask);
+        }
+    }
+    return skip;
+}
+
 // Note that we only check bits that HAVE required queueflags -- don't care entries are skipped
 static std::unordered_map<VkPipelineStageFlags, VkQueueFlags> supported_pipeline_stages_table = {
     {VK_PIPELINE_STAGE_COMMAND_PROCESS_BIT_NVX, VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT},
@@ -8176,7 +8570,7 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t
                                          uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier *pImageMemoryBarriers) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *cb_state = GetCBNode(dev_data, commandBuffer);
     if (cb_state) {
         skip |= ValidateStageMasksAgainstQueueCapabilities(dev_data, cb_state, sourceStageMask, dstStageMask, "vkCmdWaitEvents",
@@ -8197,9 +8591,8 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t
             cb_state->waitedEvents.insert(pEvents[i]);
             cb_state->events.push_back(pEvents[i]);
         }
-        std::function<bool(VkQueue)> event_update =
-            std::bind(validateEventStageMask, std::placeholders::_1, cb_state, eventCount, first_event_index, sourceStageMask);
-        cb_state->eventUpdates.push_back(event_update);
+        cb_state->eventUpdates.push_back(
+            {CB_EVENT_VALIDATE_WAIT, VK_NULL_HANDLE, sourceStageMask, eventCount, first_event_index});
         skip |= ValidateCmdQueueFlags(dev_data, cb_state, "vkCmdWaitEvents()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
                                       VALIDATION_ERROR_00262);
         skip |= ValidateCmd(dev_data, cb_state, CMD_WAITEVENTS, "vkCmdWaitEvents()");
@@ -8253,9 +8646,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkP
                                               uint32_t memoryBarrierCount, const VkMemoryBarrier *pMemoryBarriers,
                                               uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier *pBufferMemoryBarriers,
                                               uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier *pImageMemoryBarriers) {
+    LAYER_STATS_CALL("vkCmdPipelineBarrier");
     bool skip = false;
     layer_data *device_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *cb_state = GetCBNode(device_data, commandBuffer);
     if (cb_state) {
         skip |= PreCallValidateCmdPipelineBarrier(device_data, cb_state, commandBuffer, srcStageMask, dstStageMask,
@@ -8269,9 +8663,11 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkP
     }
     lock.unlock();
     if (!skip) {
+        layer_stats_call.Pause();
         device_data->dispatch_table.CmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount,
                                                        pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers,
                                                        imageMemoryBarrierCount, pImageMemoryBarriers);
+        layer_stats_call.Resume();
     }
 }
 
@@ -8291,7 +8687,7 @@ bool setQueryState(VkQueue queue, VkCommandBuffer commandBuffer, QueryObject obj
 VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t slot, VkFlags flags) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         QueryObject query = {queryPool, slot};
@@ -8313,7 +8709,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryP
 VKAPI_ATTR void VKAPI_CALL CmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t slot) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *cb_state = GetCBNode(dev_data, commandBuffer);
     if (cb_state) {
         QueryObject query = {queryPool, slot};
@@ -8325,8 +8721,7 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPoo
         } else {
             cb_state->activeQueries.erase(query);
         }
-        std::function<bool(VkQueue)> query_update = std::bind(setQueryState, std::placeholders::_1, commandBuffer, query, true);
-        cb_state->queryUpdates.push_back(query_update);
+        cb_state->queryUpdates.push_back({CB_QUERY_SET_STATE, commandBuffer, query, 1, true});
         skip |= ValidateCmdQueueFlags(dev_data, cb_state, "VkCmdEndQuery()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
                                       VALIDATION_ERROR_01046);
         skip |= ValidateCmd(dev_data, cb_state, CMD_ENDQUERY, "VkCmdEndQuery()");
@@ -8342,15 +8737,13 @@ VKAPI_ATTR void VKAPI_CALL CmdResetQueryPool(VkCommandBuffer commandBuffer, VkQu
                                              uint32_t queryCount) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *cb_state = GetCBNode(dev_data, commandBuffer);
     if (cb_state) {
         for (uint32_t i = 0; i < queryCount; i++) {
             QueryObject query = {queryPool, firstQuery + i};
             cb_state->waitedEventsBeforeQueryReset[query] = cb_state->waitedEvents;
-            std::function<bool(VkQueue)> query_update =
-                std::bind(setQueryState, std::placeholders::_1, commandBuffer, query, false);
-            cb_state->queryUpdates.push_back(query_update);
+            cb_state->queryUpdates.push_back({CB_QUERY_SET_STATE, commandBuffer, query, 1, false});
         }
         skip |= ValidateCmdQueueFlags(dev_data, cb_state, "VkCmdResetQueryPool()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
                                       VALIDATION_ERROR_01024);
@@ -8364,9 +8757,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResetQueryPool(VkCommandBuffer commandBuffer, VkQu
     if (!skip) dev_data->dispatch_table.CmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
 }
 
-bool validateQuery(VkQueue queue, GLOBAL_CB_NODE *pCB, VkQueryPool queryPool, uint32_t queryCount, uint32_t firstQuery) {
+bool validateQuery(VkQueue queue, VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t queryCount,
+                   uint32_t firstQuery) {
     bool skip = false;
-    layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(pCB->commandBuffer), layer_data_map);
+    layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     auto queue_data = dev_data->queueMap.find(queue);
     if (queue_data == dev_data->queueMap.end()) return false;
     for (uint32_t i = 0; i < queryCount; i++) {
@@ -8389,7 +8783,7 @@ bool validateQuery(VkQueue queue, GLOBAL_CB_NODE *pCB, VkQueryPool queryPool, ui
         }
         if (fail) {
             skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                            reinterpret_cast<uint64_t>(pCB->commandBuffer), __LINE__, DRAWSTATE_INVALID_QUERY, "DS",
+                            reinterpret_cast<uint64_t>(commandBuffer), __LINE__, DRAWSTATE_INVALID_QUERY, "DS",
                             "Requesting a copy from query to buffer with invalid query: queryPool 0x%" PRIx64 ", index %d",
                             reinterpret_cast<uint64_t &>(queryPool), firstQuery + i);
         }
@@ -8397,12 +8791,25 @@ bool validateQuery(VkQueue queue, GLOBAL_CB_NODE *pCB, VkQueryPool queryPool, ui
     return skip;
 }
 
+// Apply the query updates recorded into a command buffer (including those inherited from secondaries) against the given queue
+static bool ProcessQueryUpdates(layer_data *dev_data, VkQueue queue, GLOBAL_CB_NODE const *cb_node) {
+    bool skip = false;
+    for (auto const &update : cb_node->queryUpdates) {
+        if (update.type == CB_QUERY_SET_STATE) {
+            skip |= setQueryState(queue, update.command_buffer, update.query, update.available);
+        } else {
+            skip |= validateQuery(queue, update.command_buffer, update.query.pool, update.query_count, update.query.index);
+        }
+    }
+    return skip;
+}
+
 VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery,
                                                    uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                                    VkDeviceSize stride, VkQueryResultFlags flags) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
 
     auto cb_node = GetCBNode(dev_data, commandBuffer);
     auto dst_buff_state = GetBufferState(dev_data, dstBuffer);
@@ -8413,14 +8820,8 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(VkCommandBuffer commandBuffer
         // Validate that DST buffer has correct usage flags set
         skip |= ValidateBufferUsageFlags(dev_data, dst_buff_state, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true, VALIDATION_ERROR_01066,
                                          "vkCmdCopyQueryPoolResults()", "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
-        std::function<bool()> function = [=]() {
-            SetBufferMemoryValid(dev_data, dst_buff_state, true);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
-        std::function<bool(VkQueue)> query_update =
-            std::bind(validateQuery, std::placeholders::_1, cb_node, queryPool, queryCount, firstQuery);
-        cb_node->queryUpdates.push_back(query_update);
+        AddDeferredBufferMemoryUpdate(cb_node, dst_buff_state, true);
+        cb_node->queryUpdates.push_back({CB_QUERY_VALIDATE_RANGE, commandBuffer, {queryPool, firstQuery}, queryCount, false});
         skip |= ValidateCmdQueueFlags(dev_data, cb_node, "vkCmdCopyQueryPoolResults()",
                                       VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, VALIDATION_ERROR_01073);
         skip |= ValidateCmd(dev_data, cb_node, CMD_COPYQUERYPOOLRESULTS, "vkCmdCopyQueryPoolResults()");
@@ -8441,7 +8842,7 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants(VkCommandBuffer commandBuffer, VkPip
                                             uint32_t offset, uint32_t size, const void *pValues) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *cb_state = GetCBNode(dev_data, commandBuffer);
     if (cb_state) {
         skip |= ValidateCmdQueueFlags(dev_data, cb_state, "vkCmdPushConstants()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
@@ -8486,12 +8887,11 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPi
                                              VkQueryPool queryPool, uint32_t slot) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *cb_state = GetCBNode(dev_data, commandBuffer);
     if (cb_state) {
         QueryObject query = {queryPool, slot};
-        std::function<bool(VkQueue)> query_update = std::bind(setQueryState, std::placeholders::_1, commandBuffer, query, true);
-        cb_state->queryUpdates.push_back(query_update);
+        cb_state->queryUpdates.push_back({CB_QUERY_SET_STATE, commandBuffer, query, 1, true});
         skip |= ValidateCmdQueueFlags(dev_data, cb_state, "vkCmdWriteTimestamp()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
                                       VALIDATION_ERROR_01082);
         skip |= ValidateCmd(dev_data, cb_state, CMD_WRITETIMESTAMP, "vkCmdWriteTimestamp()");
@@ -8726,7 +9126,7 @@ static void PostCallRecordCreateFramebuffer(layer_data *dev_data, const VkFrameb
 VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo *pCreateInfo,
                                                  const VkAllocationCallbacks *pAllocator, VkFramebuffer *pFramebuffer) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip = PreCallValidateCreateFramebuffer(dev_data, pCreateInfo);
     lock.unlock();
 
@@ -9029,7 +9429,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(VkDevice device, const VkShade
     VkResult res = dev_data->dispatch_table.CreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule);
 
     if (res == VK_SUCCESS && !GetDisables(dev_data)->shader_validation) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<LayerStatsMutex> lock(global_lock);
         const auto new_shader_module = (SPV_SUCCESS == spv_valid ? new shader_module(pCreateInfo) : new shader_module());
         dev_data->shaderModuleMap[*pShaderModule] = unique_ptr<shader_module>(new_shader_module);
     }
@@ -9150,7 +9550,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(VkDevice device, const VkRenderP
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     // TODO: As part of wrapping up the mem_tracker/core_validation merge the following routine should be consolidated with
     //       ValidateLayouts.
     skip |= ValidateRenderpassAttachmentUsage(dev_data, pCreateInfo);
@@ -9255,9 +9655,10 @@ static bool FormatSpecificLoadAndStoreOpSettings(VkFormat format, T color_depth_
 
 VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                               VkSubpassContents contents) {
+    LAYER_STATS_CALL("vkCmdBeginRenderPass");
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *cb_node = GetCBNode(dev_data, commandBuffer);
     auto render_pass_state = pRenderPassBegin ? GetRenderPassState(dev_data, pRenderPassBegin->renderPass) : nullptr;
     auto framebuffer = pRenderPassBegin ? GetFramebufferState(dev_data, pRenderPassBegin->framebuffer) : nullptr;
@@ -9271,32 +9672,16 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(VkCommandBuffer commandBuffer, con
                 if (FormatSpecificLoadAndStoreOpSettings(pAttachment->format, pAttachment->loadOp, pAttachment->stencilLoadOp,
                                                          VK_ATTACHMENT_LOAD_OP_CLEAR)) {
                     clear_op_size = static_cast<uint32_t>(i) + 1;
-                    std::function<bool()> function = [=]() {
-                        SetImageMemoryValid(dev_data, GetImageState(dev_data, fb_info.image), true);
-                        return false;
-                    };
-                    cb_node->validate_functions.push_back(function);
+                    AddDeferredImageMemoryUpdate(cb_node, GetImageState(dev_data, fb_info.image), true);
                 } else if (FormatSpecificLoadAndStoreOpSettings(pAttachment->format, pAttachment->loadOp,
                                                                 pAttachment->stencilLoadOp, VK_ATTACHMENT_LOAD_OP_DONT_CARE)) {
-                    std::function<bool()> function = [=]() {
-                        SetImageMemoryValid(dev_data, GetImageState(dev_data, fb_info.image), false);
-                        return false;
-                    };
-                    cb_node->validate_functions.push_back(function);
+                    AddDeferredImageMemoryUpdate(cb_node, GetImageState(dev_data, fb_info.image), false);
                 } else if (FormatSpecificLoadAndStoreOpSettings(pAttachment->format, pAttachment->loadOp,
                                                                 pAttachment->stencilLoadOp, VK_ATTACHMENT_LOAD_OP_LOAD)) {
-                    std::function<bool()> function = [=]() {
-                        return ValidateImageMemoryIsValid(dev_data, GetImageState(dev_data, fb_info.image),
-                                                          "vkCmdBeginRenderPass()");
-                    };
-                    cb_node->validate_functions.push_back(function);
+                    AddDeferredImageMemoryCheck(cb_node, GetImageState(dev_data, fb_info.image), "vkCmdBeginRenderPass()");
                 }
                 if (render_pass_state->attachment_first_read[i]) {
-                    std::function<bool()> function = [=]() {
-                        return ValidateImageMemoryIsValid(dev_data, GetImageState(dev_data, fb_info.image),
-                                                          "vkCmdBeginRenderPass()");
-                    };
-                    cb_node->validate_functions.push_back(function);
+                    AddDeferredImageMemoryCheck(cb_node, GetImageState(dev_data, fb_info.image), "vkCmdBeginRenderPass()");
                 }
             }
             if (clear_op_size > pRenderPassBegin->clearValueCount) {
@@ -9347,14 +9732,16 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(VkCommandBuffer commandBuffer, con
     }
     lock.unlock();
     if (!skip) {
+        layer_stats_call.Pause();
         dev_data->dispatch_table.CmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
+        layer_stats_call.Resume();
     }
 }
 
 VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= validatePrimaryCommandBuffer(dev_data, pCB, "vkCmdNextSubpass()", VALIDATION_ERROR_00459);
@@ -9389,7 +9776,7 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpa
 VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(VkCommandBuffer commandBuffer) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     auto pCB = GetCBNode(dev_data, commandBuffer);
     FRAMEBUFFER_STATE *framebuffer = NULL;
     if (pCB) {
@@ -9408,18 +9795,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(VkCommandBuffer commandBuffer) {
                 auto pAttachment = &rp_state->createInfo.pAttachments[i];
                 if (FormatSpecificLoadAndStoreOpSettings(pAttachment->format, pAttachment->storeOp, pAttachment->stencilStoreOp,
                                                          VK_ATTACHMENT_STORE_OP_STORE)) {
-                    std::function<bool()> function = [=]() {
-                        SetImageMemoryValid(dev_data, GetImageState(dev_data, fb_info.image), true);
-                        return false;
-                    };
-                    pCB->validate_functions.push_back(function);
+                    AddDeferredImageMemoryUpdate(pCB, GetImageState(dev_data, fb_info.image), true);
                 } else if (FormatSpecificLoadAndStoreOpSettings(pAttachment->format, pAttachment->storeOp,
                                                                 pAttachment->stencilStoreOp, VK_ATTACHMENT_STORE_OP_DONT_CARE)) {
-                    std::function<bool()> function = [=]() {
-                        SetImageMemoryValid(dev_data, GetImageState(dev_data, fb_info.image), false);
-                        return false;
-                    };
-                    pCB->validate_functions.push_back(function);
+                    AddDeferredImageMemoryUpdate(pCB, GetImageState(dev_data, fb_info.image), false);
                 }
             }
         }
@@ -9664,7 +10043,7 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(VkCommandBuffer commandBuffer, uin
                                               const VkCommandBuffer *pCommandBuffers) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         GLOBAL_CB_NODE *pSubCB = NULL;
@@ -9755,9 +10134,7 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(VkCommandBuffer commandBuffer, uin
             pSubCB->primaryCommandBuffer = pCB->commandBuffer;
             pCB->secondaryCommandBuffers.insert(pSubCB->commandBuffer);
             dev_data->globalInFlightCmdBuffers.insert(pSubCB->commandBuffer);
-            for (auto &function : pSubCB->queryUpdates) {
-                pCB->queryUpdates.push_back(function);
-            }
+            pCB->queryUpdates.insert(pCB->queryUpdates.end(), pSubCB->queryUpdates.begin(), pSubCB->queryUpdates.end());
         }
         skip |= validatePrimaryCommandBuffer(dev_data, pCB, "vkCmdExecuteCommands()", VALIDATION_ERROR_00163);
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdExecuteCommands()",
@@ -9775,7 +10152,7 @@ VKAPI_ATTR VkResult VKAPI_CALL MapMemory(VkDevice device, VkDeviceMemory mem, Vk
 
     bool skip = false;
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     DEVICE_MEM_INFO *mem_info = GetMemObjInfo(dev_data, mem);
     if (mem_info) {
         // TODO : This could me more fine-grained to track just region that is valid
@@ -9812,7 +10189,7 @@ VKAPI_ATTR void VKAPI_CALL UnmapMemory(VkDevice device, VkDeviceMemory mem) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     skip |= deleteMemRanges(dev_data, mem);
     lock.unlock();
     if (!skip) {
@@ -9931,7 +10308,7 @@ static bool ValidateMappedMemoryRangeDeviceLimits(layer_data *dev_data, const ch
 static bool PreCallValidateFlushMappedMemoryRanges(layer_data *dev_data, uint32_t mem_range_count,
                                                    const VkMappedMemoryRange *mem_ranges) {
     bool skip = false;
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<LayerStatsMutex> lock(global_lock);
     skip |= ValidateAndCopyNoncoherentMemoryToDriver(dev_data, mem_range_count, mem_ranges);
     skip |= validateMemoryIsMapped(dev_data, "vkFlushMappedMemoryRanges", mem_range_count, mem_ranges);
     return skip;
@@ -9951,14 +10328,14 @@ VKAPI_ATTR VkResult VKAPI_CALL FlushMappedMemoryRanges(VkDevice device, uint32_t
 static bool PreCallValidateInvalidateMappedMemoryRanges(layer_data *dev_data, uint32_t mem_range_count,
                                                         const VkMappedMemoryRange *mem_ranges) {
     bool skip = false;
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<LayerStatsMutex> lock(global_lock);
     skip |= validateMemoryIsMapped(dev_data, "vkInvalidateMappedMemoryRanges", mem_range_count, mem_ranges);
     return skip;
 }
 
 static void PostCallRecordInvalidateMappedMemoryRanges(layer_data *dev_data, uint32_t mem_range_count,
                                                        const VkMappedMemoryRange *mem_ranges) {
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<LayerStatsMutex> lock(global_lock);
     // Update our shadow copy with modified driver data
     CopyNoncoherentMemoryFromDriver(dev_data, mem_range_count, mem_ranges);
 }
@@ -9981,7 +10358,7 @@ static bool PreCallValidateBindImageMemory(layer_data *dev_data, VkImage image,
                                            VkDeviceSize memoryOffset) {
     bool skip = false;
     if (image_state) {
-        std::unique_lock<std::mutex> lock(global_lock);
+        std::unique_lock<LayerStatsMutex> lock(global_lock);
         // Track objects tied to memory
         uint64_t image_handle = reinterpret_cast<uint64_t &>(image);
         skip = ValidateSetMemBinding(dev_data, mem, image_handle, kVulkanObjectTypeImage, "vkBindImageMemory()");
@@ -10038,7 +10415,7 @@ static bool PreCallValidateBindImageMemory(layer_data *dev_data, VkImage image,
 static void PostCallRecordBindImageMemory(layer_data *dev_data, VkImage image, IMAGE_STATE *image_state, VkDeviceMemory mem,
                                           VkDeviceSize memoryOffset) {
     if (image_state) {
-        std::unique_lock<std::mutex> lock(global_lock);
+        std::unique_lock<LayerStatsMutex> lock(global_lock);
         // Track bound memory range information
         auto mem_info = GetMemObjInfo(dev_data, mem);
         if (mem_info) {
@@ -10074,7 +10451,7 @@ VKAPI_ATTR VkResult VKAPI_CALL SetEvent(VkDevice device, VkEvent event) {
     bool skip = false;
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     auto event_state = GetEventNode(dev_data, event);
     if (event_state) {
         event_state->needsSignaled = false;
@@ -10105,7 +10482,7 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueBindSparse(VkQueue queue, uint32_t bindInfoC
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
     bool skip = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     auto pFence = GetFenceNode(dev_data, fence);
     auto pQueue = GetQueueState(dev_data, queue);
 
@@ -10210,7 +10587,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(VkDevice device, const VkSemaphor
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->dispatch_table.CreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
     if (result == VK_SUCCESS) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<LayerStatsMutex> lock(global_lock);
         SEMAPHORE_NODE *sNode = &dev_data->semaphoreMap[*pSemaphore];
         sNode->signaler.first = VK_NULL_HANDLE;
         sNode->signaler.second = 0;
@@ -10224,7 +10601,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateEvent(VkDevice device, const VkEventCreateI
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->dispatch_table.CreateEvent(device, pCreateInfo, pAllocator, pEvent);
     if (result == VK_SUCCESS) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<LayerStatsMutex> lock(global_lock);
         dev_data->eventMap[*pEvent].needsSignaled = false;
         dev_data->eventMap[*pEvent].write_in_use = 0;
         dev_data->eventMap[*pEvent].stageMask = VkPipelineStageFlags(0);
@@ -10453,7 +10830,7 @@ static void PostCallRecordCreateSwapchainKHR(layer_data *dev_data, VkResult resu
                                              VkSwapchainKHR *pSwapchain, SURFACE_STATE *surface_state,
                                              SWAPCHAIN_NODE *old_swapchain_state) {
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<LayerStatsMutex> lock(global_lock);
         auto swapchain_state = unique_ptr<SWAPCHAIN_NODE>(new SWAPCHAIN_NODE(pCreateInfo, *pSwapchain));
         surface_state->swapchain = swapchain_state.get();
         dev_data->device_extensions.swapchainMap[*pSwapchain] = std::move(swapchain_state);
@@ -10489,7 +10866,7 @@ VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(VkDevice device, VkSwapchainKHR s
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     auto swapchain_data = GetSwapchainNode(dev_data, swapchain);
     if (swapchain_data) {
         if (swapchain_data->images.size() > 0) {
@@ -10529,7 +10906,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(VkDevice device, VkSwapchai
     if (result == VK_SUCCESS && pSwapchainImages != NULL) {
         // This should never happen and is checked by param checker.
         if (!pCount) return result;
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<LayerStatsMutex> lock(global_lock);
         const size_t count = *pCount;
         auto swapchain_node = GetSwapchainNode(dev_data, swapchain);
         if (swapchain_node && !swapchain_node->images.empty()) {
@@ -10568,9 +10945,12 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(VkDevice device, VkSwapchai
             image_state->valid = false;
             image_state->binding.mem = MEMTRACKER_SWAP_CHAIN_IMAGE_KEY;
             swapchain_node->images.push_back(pSwapchainImages[i]);
-            ImageSubresourcePair subpair = {pSwapchainImages[i], false, VkImageSubresource()};
-            dev_data->imageSubresourceMap[pSwapchainImages[i]].push_back(subpair);
-            dev_data->imageLayoutMap[subpair] = image_layout_node;
+            // Layouts are only tracked, and checked at present time, while layout validation is enabled
+            if (!GetDisables(dev_data)->image_layouts) {
+                ImageSubresourcePair subpair = {pSwapchainImages[i], false, VkImageSubresource()};
+                dev_data->imageSubresourceMap[pSwapchainImages[i]].push_back(subpair);
+                dev_data->imageLayoutMap[subpair] = image_layout_node;
+            }
             dev_data->device_extensions.imageToSwapchainMap[pSwapchainImages[i]] = swapchain;
         }
     }
@@ -10578,10 +10958,11 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(VkDevice device, VkSwapchai
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo) {
+    LAYER_STATS_CALL("vkQueuePresentKHR");
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
 
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<LayerStatsMutex> lock(global_lock);
     auto queue_state = GetQueueState(dev_data, queue);
 
     for (uint32_t i = 0; i < pPresentInfo->waitSemaphoreCount; ++i) {
@@ -10617,7 +10998,9 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInf
                 }
 
                 vector<VkImageLayout> layouts;
-                if (FindLayouts(dev_data, image, layouts)) {
+                if (!GetDisables(dev_data)->image_layouts &&
+                    will_log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VALIDATION_ERROR_01964) &&
+                    FindLayouts(dev_data, image, layouts)) {
                     for (auto layout : layouts) {
                         if (layout != VK_IMAGE_LAYOUT_PRESENT_SRC_KHR) {
                             skip |=
@@ -10729,7 +11112,9 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInf
         return VK_ERROR_VALIDATION_FAILED_EXT;
     }
 
+    layer_stats_call.Pause();
     VkResult result = dev_data->dispatch_table.QueuePresentKHR(queue, pPresentInfo);
+    layer_stats_call.Resume();
 
     if (result != VK_ERROR_VALIDATION_FAILED_EXT) {
         // Semaphore waits occur before error generation, if the call reached
@@ -10770,7 +11155,7 @@ static bool PreCallValidateCreateSharedSwapchainsKHR(layer_data *dev_data, uint3
                                                      std::vector<SURFACE_STATE *> &surface_state,
                                                      std::vector<SWAPCHAIN_NODE *> &old_swapchain_state) {
     if (pCreateInfos) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<LayerStatsMutex> lock(global_lock);
         for (uint32_t i = 0; i < swapchainCount; i++) {
             surface_state.push_back(GetSurfaceState(dev_data->instance_data, pCreateInfos[i].surface));
             old_swapchain_state.push_back(GetSwapchainNode(dev_data, pCreateInfos[i].oldSwapchain));
@@ -10836,7 +11221,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImageKHR(VkDevice device, VkSwapchainK
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
 
     if (fence == VK_NULL_HANDLE && semaphore == VK_NULL_HANDLE) {
         skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT,
@@ -11085,7 +11470,7 @@ static VkResult CreateSurface(VkInstance instance, TCreateInfo const *pCreateInf
     VkResult result = (instance_data->dispatch_table.*fptr)(instance, pCreateInfo, pAllocator, pSurface);
 
     if (result == VK_SUCCESS) {
-        std::unique_lock<std::mutex> lock(global_lock);
+        std::unique_lock<LayerStatsMutex> lock(global_lock);
         instance_data->surface_map[*pSurface] = SURFACE_STATE(*pSurface);
         lock.unlock();
     }
@@ -11096,7 +11481,7 @@ static VkResult CreateSurface(VkInstance instance, TCreateInfo const *pCreateInf
 VKAPI_ATTR void VKAPI_CALL DestroySurfaceKHR(VkInstance instance, VkSurfaceKHR surface, const VkAllocationCallbacks *pAllocator) {
     bool skip = false;
     instance_layer_data *instance_data = GetLayerDataPtr(get_dispatch_key(instance), instance_layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     auto surface_state = GetSurfaceState(instance_data, surface);
 
     if (surface_state) {
@@ -11162,7 +11547,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceCapabilitiesKHR(VkPhysica
                                                                        VkSurfaceCapabilitiesKHR *pSurfaceCapabilities) {
     auto instance_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), instance_layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     auto physical_device_state = GetPhysicalDeviceState(instance_data, physicalDevice);
     lock.unlock();
 
@@ -11180,7 +11565,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceCapabilitiesKHR(VkPhysica
 VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex,
                                                                   VkSurfaceKHR surface, VkBool32 *pSupported) {
     auto instance_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), instance_layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     auto surface_state = GetSurfaceState(instance_data, surface);
     lock.unlock();
 
@@ -11199,7 +11584,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfacePresentModesKHR(VkPhysica
                                                                        VkPresentModeKHR *pPresentModes) {
     bool skip = false;
     auto instance_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), instance_layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     // TODO: this isn't quite right. available modes may differ by surface AND physical device.
     auto physical_device_state = GetPhysicalDeviceState(instance_data, physicalDevice);
     auto &call_state = physical_device_state->vkGetPhysicalDeviceSurfacePresentModesKHRState;
@@ -11260,7 +11645,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceFormatsKHR(VkPhysicalDevi
                                                                   VkSurfaceFormatKHR *pSurfaceFormats) {
     bool skip = false;
     auto instance_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), instance_layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     auto physical_device_state = GetPhysicalDeviceState(instance_data, physicalDevice);
     auto &call_state = physical_device_state->vkGetPhysicalDeviceSurfaceFormatsKHRState;
 
@@ -11326,7 +11711,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDebugReportCallbackEXT(VkInstance instance,
     instance_layer_data *instance_data = GetLayerDataPtr(get_dispatch_key(instance), instance_layer_data_map);
     VkResult res = instance_data->dispatch_table.CreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pMsgCallback);
     if (VK_SUCCESS == res) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<LayerStatsMutex> lock(global_lock);
         res = layer_create_msg_callback(instance_data->report_data, false, pCreateInfo, pAllocator, pMsgCallback);
     }
     return res;
@@ -11336,7 +11721,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDebugReportCallbackEXT(VkInstance instance, Vk
                                                          const VkAllocationCallbacks *pAllocator) {
     instance_layer_data *instance_data = GetLayerDataPtr(get_dispatch_key(instance), instance_layer_data_map);
     instance_data->dispatch_table.DestroyDebugReportCallbackEXT(instance, msgCallback, pAllocator);
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<LayerStatsMutex> lock(global_lock);
     layer_destroy_msg_callback(instance_data->report_data, msgCallback, pAllocator);
 }
 
@@ -11440,7 +11825,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplateKHR(VkDevice device
     VkResult result =
         dev_data->dispatch_table.CreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<LayerStatsMutex> lock(global_lock);
         // Shadow template createInfo for later updates
         safe_VkDescriptorUpdateTemplateCreateInfoKHR *local_create_info =
             new safe_VkDescriptorUpdateTemplateCreateInfoKHR(pCreateInfo);
@@ -11454,7 +11839,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplateKHR(VkDevice device,
                                                               VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate,
                                                               const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     dev_data->desc_template_map.erase(descriptorUpdateTemplate);
     lock.unlock();
     dev_data->dispatch_table.DestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
@@ -598,6 +598,50 @@ class PIPELINE_STATE : public BASE_NODE {
     }
 };
 
+// Memory contents checks and updates recorded into a command buffer and replayed, in recording order, at submit time
+enum CB_MEMORY_ACCESS_TYPE {
+    CB_MEMORY_ACCESS_VALIDATE,     // Report if the resource's bound memory does not hold valid contents
+    CB_MEMORY_ACCESS_SET_VALID,    // Resource's bound memory now holds valid contents
+    CB_MEMORY_ACCESS_SET_INVALID,  // Resource's bound memory contents are now undefined
+};
+
+struct CB_MEMORY_ACCESS {
+    CB_MEMORY_ACCESS_TYPE type;
+    // Exactly one of these is set
+    IMAGE_STATE *image_state;
+    BUFFER_STATE *buffer_state;
+    // API call reported by CB_MEMORY_ACCESS_VALIDATE
+    const char *func_name;
+};
+
+// Event state changes recorded into a command buffer and applied against the submitting queue
+enum CB_EVENT_UPDATE_TYPE {
+    CB_EVENT_SET_STAGE_MASK,  // vkCmdSetEvent / vkCmdResetEvent
+    CB_EVENT_VALIDATE_WAIT,   // vkCmdWaitEvents
+};
+
+struct CB_EVENT_UPDATE {
+    CB_EVENT_UPDATE_TYPE type;
+    VkEvent event;                    // Event being set or reset
+    VkPipelineStageFlags stage_mask;  // New stage mask, or srcStageMask of the wait
+    uint32_t event_count;             // Waits cover events[first_event_index, first_event_index + event_count)
+    size_t first_event_index;
+};
+
+// Query state changes recorded into a command buffer and applied against the submitting queue
+enum CB_QUERY_UPDATE_TYPE {
+    CB_QUERY_SET_STATE,       // vkCmdEndQuery / vkCmdResetQueryPool / vkCmdWriteTimestamp
+    CB_QUERY_VALIDATE_RANGE,  // vkCmdCopyQueryPoolResults
+};
+
+struct CB_QUERY_UPDATE {
+    CB_QUERY_UPDATE_TYPE type;
+    VkCommandBuffer command_buffer;  // Recording command buffer; updates from secondaries are inherited by the primary
+    QueryObject query;               // The query being set, or the first query of the range
+    uint32_t query_count;
+    bool available;
+};
+
 // Track last states that are bound per pipeline bind point (Gfx & Compute)
 struct LAST_BOUND_STATE {
     PIPELINE_STATE *pipeline_state;
@@ -666,10 +710,10 @@ struct GLOBAL_CB_NODE : public BASE_NODE {
     // execution
     std::unordered_set<VkCommandBuffer> secondaryCommandBuffers;
     // MTMTODO : Scrub these data fields and merge active sets w/ lastBound as appropriate
-    std::vector<std::function<bool()>> validate_functions;
+    std::vector<CB_MEMORY_ACCESS> memory_accesses;
     std::unordered_set<VkDeviceMemory> memObjs;
-    std::vector<std::function<bool(VkQueue)>> eventUpdates;
-    std::vector<std::function<bool(VkQueue)>> queryUpdates;
+    std::vector<CB_EVENT_UPDATE> eventUpdates;
+    std::vector<CB_QUERY_UPDATE> queryUpdates;
 };
 
 struct SEMAPHORE_WAIT {
@@ -727,6 +771,9 @@ struct CHECK_DISABLED {
     bool destroy_query_pool;
     bool get_query_pool_results;
     bool destroy_buffer;
+    bool draw_descriptor_sets;      // Skip draw-time validation of bound descriptor sets
+    bool draw_state;                // Skip draw-time validation of dynamic and pipeline state
+    bool image_layouts;             // Skip image layout validation and command buffer layout tracking
     bool shader_validation;         // Skip validation for shaders
 
     void SetAll(bool value) { std::fill(&command_buffer_state, &shader_validation + 1, value); }
@@ -816,6 +863,10 @@ bool ValidateImageSampleCount(layer_data *dev_data, IMAGE_STATE *image_state, Vk
 bool rangesIntersect(layer_data const *dev_data, MEMORY_RANGE const *range1, VkDeviceSize offset, VkDeviceSize end);
 bool ValidateBufferMemoryIsValid(layer_data *dev_data, BUFFER_STATE *buffer_state, const char *functionName);
 void SetBufferMemoryValid(layer_data *dev_data, BUFFER_STATE *buffer_state, bool valid);
+void AddDeferredImageMemoryCheck(GLOBAL_CB_NODE *cb_node, IMAGE_STATE *image_state, const char *func_name);
+void AddDeferredBufferMemoryCheck(GLOBAL_CB_NODE *cb_node, BUFFER_STATE *buffer_state, const char *func_name);
+void AddDeferredImageMemoryUpdate(GLOBAL_CB_NODE *cb_node, IMAGE_STATE *image_state, bool valid);
+void AddDeferredBufferMemoryUpdate(GLOBAL_CB_NODE *cb_node, BUFFER_STATE *buffer_state, bool valid);
 bool ValidateCmdSubpassState(const layer_data *dev_data, const GLOBAL_CB_NODE *pCB, const CMD_TYPE cmd_type);
 
 
@@ -827,7 +878,7 @@ const VkImageFormatProperties *GetImageFormatProperties(core_validation::layer_d
                                                         VkImageCreateFlags flags);
 const debug_report_data *GetReportData(const layer_data *);
 const VkPhysicalDeviceProperties *GetPhysicalDeviceProperties(layer_data *);
-const CHECK_DISABLED *GetDisables(layer_data *);
+const CHECK_DISABLED *GetDisables(layer_data const *);
 std::unordered_map<VkImage, std::unique_ptr<IMAGE_STATE>> *GetImageMap(core_validation::layer_data *);
 std::unordered_map<VkImage, std::vector<ImageSubresourcePair>> *GetImageSubresourceMap(layer_data *);
 std::unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> *GetImageLayoutMap(layer_data *);
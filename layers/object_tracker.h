@@ -20,10 +20,14 @@
  * Author: Tobin Ehlis <tobin@lunarg.com>
  */
 
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 #include "vk_enum_string_helper.h"
 #include "vk_layer_extension_utils.h"
+#include "vk_layer_stats.h"
 #include "vk_layer_table.h"
 #include "vk_layer_utils.h"
 #include "vulkan/vk_layer.h"
@@ -108,14 +112,211 @@ struct device_extension_enables{
     bool google_display_timing;
 };
 
-typedef std::unordered_map<uint64_t, OBJTRACK_NODE *> object_map_type;
+// Map from handle to OBJTRACK_NODE for one object type. Nodes are stored in slabs owned by the map and spread over shards by
+// handle hash; each shard has its own mutex, held for everything that reads or writes a node. contains() alone walks the
+// shard's bucket chains without locking, comparing only each entry's atomic copy of its handle. Slabs and outgrown bucket
+// arrays are only released with the map, so a racing walk never touches freed memory, though an erase can recycle an entry
+// under it and divert the walk. Lock-free misses are therefore confirmed under the shard lock.
+class ObjectMap {
+   public:
+    ObjectMap() {}
+    ObjectMap(const ObjectMap &) = delete;
+    ObjectMap &operator=(const ObjectMap &) = delete;
+
+    // Copies the node for handle to node if non-null. The copy stays valid however the object is destroyed meanwhile.
+    bool find(uint64_t handle, OBJTRACK_NODE *node) {
+        size_t hash = Hash(handle);
+        Shard &shard = shards[hash & (kShardCount - 1)];
+        std::lock_guard<std::mutex> lock(shard.lock);
+        BucketArray *buckets = shard.buckets.load(std::memory_order_relaxed);
+        Entry *entry = buckets ? FindEntry(buckets, hash, handle) : nullptr;
+        if (entry && node) *node = entry->node;
+        return entry != nullptr;
+    }
+
+    bool contains(uint64_t handle) {
+        size_t hash = Hash(handle);
+        Shard &shard = shards[hash & (kShardCount - 1)];
+        BucketArray *buckets = shard.buckets.load(std::memory_order_acquire);
+        if (!buckets) return false;
+        return FindEntry(buckets, hash, handle) || find(handle, nullptr);
+    }
+
+    // Copies value into a new node keyed by value.handle. Returns false, leaving the map unchanged, if the handle is present.
+    bool insert(const OBJTRACK_NODE &value) { return Insert(value, false); }
+
+    // As insert, but overwrites the node if the handle is present. Returns true if a new node was added.
+    bool insert_or_assign(const OBJTRACK_NODE &value) { return Insert(value, true); }
+
+    // Unlinks the node for handle and returns its slot to the shard's free list, copying it to removed if non-null.
+    bool erase(uint64_t handle, OBJTRACK_NODE *removed = nullptr) {
+        size_t hash = Hash(handle);
+        Shard &shard = shards[hash & (kShardCount - 1)];
+        std::lock_guard<std::mutex> lock(shard.lock);
+        BucketArray *buckets = shard.buckets.load(std::memory_order_relaxed);
+        if (!buckets) return false;
+
+        std::atomic<Entry *> *link = &buckets->heads[(hash >> kShardBits) & buckets->mask];
+        Entry *entry = link->load(std::memory_order_relaxed);
+        while (entry && entry->handle.load(std::memory_order_relaxed) != handle) {
+            link = &entry->next;
+            entry = link->load(std::memory_order_relaxed);
+        }
+        if (!entry) return false;
+        link->store(entry->next.load(std::memory_order_relaxed), std::memory_order_release);
+        if (removed) *removed = entry->node;
+        entry->free_next = shard.free_list;
+        shard.free_list = entry;
+        shard.count--;
+        return true;
+    }
+
+    // Copies out every node, for the rare walks that report or destroy objects in bulk
+    std::vector<OBJTRACK_NODE> snapshot() {
+        std::vector<OBJTRACK_NODE> nodes;
+        for (auto &shard : shards) {
+            std::lock_guard<std::mutex> lock(shard.lock);
+            BucketArray *buckets = shard.buckets.load(std::memory_order_relaxed);
+            if (!buckets) continue;
+            for (size_t i = 0; i <= buckets->mask; i++) {
+                for (Entry *entry = buckets->heads[i].load(std::memory_order_relaxed); entry;
+                     entry = entry->next.load(std::memory_order_relaxed)) {
+                    nodes.push_back(entry->node);
+                }
+            }
+        }
+        return nodes;
+    }
+
+    void clear() {
+        for (auto &shard : shards) {
+            std::lock_guard<std::mutex> lock(shard.lock);
+            BucketArray *buckets = shard.buckets.load(std::memory_order_relaxed);
+            if (!buckets) continue;
+            for (size_t i = 0; i <= buckets->mask; i++) {
+                Entry *entry = buckets->heads[i].load(std::memory_order_relaxed);
+                buckets->heads[i].store(nullptr, std::memory_order_release);
+                while (entry) {
+                    Entry *next = entry->next.load(std::memory_order_relaxed);
+                    entry->free_next = shard.free_list;
+                    shard.free_list = entry;
+                    entry = next;
+                }
+            }
+            shard.count = 0;
+        }
+    }
+
+   private:
+    bool Insert(const OBJTRACK_NODE &value, bool assign) {
+        size_t hash = Hash(value.handle);
+        Shard &shard = shards[hash & (kShardCount - 1)];
+        std::lock_guard<std::mutex> lock(shard.lock);
+        BucketArray *buckets = shard.buckets.load(std::memory_order_relaxed);
+        Entry *existing = buckets ? FindEntry(buckets, hash, value.handle) : nullptr;
+        if (existing) {
+            if (assign) existing->node = value;
+            return false;
+        }
+        if (!buckets || shard.count > buckets->mask) buckets = Grow(shard);
+
+        Entry *entry = NewEntry(shard);
+        entry->node = value;
+        entry->handle.store(value.handle, std::memory_order_relaxed);
+        std::atomic<Entry *> &head = buckets->heads[(hash >> kShardBits) & buckets->mask];
+        entry->next.store(head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        head.store(entry, std::memory_order_release);
+        shard.count++;
+        return true;
+    }
+
+    static const uint32_t kShardBits = 3;
+    static const uint32_t kShardCount = 1 << kShardBits;
+    static const size_t kSlabEntries = 256;
+    static const size_t kInitialBuckets = 32;
+
+    struct Entry {
+        std::atomic<uint64_t> handle;  // Same as node.handle; the only field read without the shard lock
+        OBJTRACK_NODE node;
+        std::atomic<Entry *> next;
+        Entry *free_next;
+    };
+
+    struct BucketArray {
+        explicit BucketArray(size_t size) : mask(size - 1), heads(new std::atomic<Entry *>[size]) {
+            for (size_t i = 0; i < size; i++) heads[i].store(nullptr, std::memory_order_relaxed);
+        }
+        size_t mask;
+        std::unique_ptr<std::atomic<Entry *>[]> heads;
+    };
+
+    struct Shard {
+        Shard() : buckets(nullptr), count(0), free_list(nullptr), slab_used(kSlabEntries) {}
+        std::mutex lock;
+        std::atomic<BucketArray *> buckets;
+        size_t count;
+        Entry *free_list;
+        size_t slab_used;
+        std::vector<std::unique_ptr<Entry[]>> slabs;
+        // The current bucket array is the last one; earlier ones are kept alive for readers that raced a Grow()
+        std::vector<std::unique_ptr<BucketArray>> bucket_arrays;
+    };
+
+    Shard shards[kShardCount];
+
+    static size_t Hash(uint64_t handle) { return static_cast<size_t>((handle * UINT64_C(0x9E3779B97F4A7C15)) >> 32); }
+
+    static Entry *FindEntry(BucketArray *buckets, size_t hash, uint64_t handle) {
+        Entry *entry = buckets->heads[(hash >> kShardBits) & buckets->mask].load(std::memory_order_acquire);
+        while (entry && entry->handle.load(std::memory_order_relaxed) != handle) {
+            entry = entry->next.load(std::memory_order_acquire);
+        }
+        return entry;
+    }
+
+    // Shard lock must be held for NewEntry and Grow
+    static Entry *NewEntry(Shard &shard) {
+        if (shard.free_list) {
+            Entry *entry = shard.free_list;
+            shard.free_list = entry->free_next;
+            return entry;
+        }
+        if (shard.slab_used == kSlabEntries) {
+            shard.slabs.emplace_back(new Entry[kSlabEntries]);
+            shard.slab_used = 0;
+        }
+        return &shard.slabs.back()[shard.slab_used++];
+    }
+
+    static BucketArray *Grow(Shard &shard) {
+        BucketArray *old_buckets = shard.buckets.load(std::memory_order_relaxed);
+        size_t size = old_buckets ? (old_buckets->mask + 1) * 2 : kInitialBuckets;
+        shard.bucket_arrays.emplace_back(new BucketArray(size));
+        BucketArray *buckets = shard.bucket_arrays.back().get();
+        if (old_buckets) {
+            // Relinking in old chain order keeps every chain a reader may be on acyclic and null-terminated
+            for (size_t i = 0; i <= old_buckets->mask; i++) {
+                Entry *entry = old_buckets->heads[i].load(std::memory_order_relaxed);
+                while (entry) {
+                    Entry *next = entry->next.load(std::memory_order_relaxed);
+                    std::atomic<Entry *> &head = buckets->heads[(Hash(entry->node.handle) >> kShardBits) & buckets->mask];
+                    entry->next.store(head.load(std::memory_order_relaxed), std::memory_order_release);
+                    head.store(entry, std::memory_order_relaxed);
+                    entry = next;
+                }
+            }
+        }
+        shard.buckets.store(buckets, std::memory_order_release);
+        return buckets;
+    }
+};
 
 struct layer_data {
     VkInstance instance;
     VkPhysicalDevice physical_device;
 
-    uint64_t num_objects[kVulkanObjectTypeMax + 1];
-    uint64_t num_total_objects;
+    std::atomic<uint64_t> num_objects[kVulkanObjectTypeMax + 1];
+    std::atomic<uint64_t> num_total_objects;
 
     debug_report_data *report_data;
     std::vector<VkDebugReportCallbackEXT> logging_callback;
@@ -129,10 +330,10 @@ struct layer_data {
 
     std::vector<VkQueueFamilyProperties> queue_family_properties;
 
-    // Vector of unordered_maps per object type to hold OBJTRACK_NODE info
-    std::vector<object_map_type> object_map;
+    // Maps per object type to hold OBJTRACK_NODE info
+    ObjectMap object_map[kVulkanObjectTypeMax + 1];
     // Special-case map for swapchain images
-    std::unordered_map<uint64_t, OBJTRACK_NODE *> swapchainImageMap;
+    ObjectMap swapchainImageMap;
     // Map of queue information structures, one per queue
     std::unordered_map<VkQueue, OT_QUEUE_INFO *> queue_info_map;
 
@@ -147,19 +348,17 @@ struct layer_data {
           num_tmp_callbacks(0),
           tmp_dbg_create_infos(nullptr),
           tmp_callbacks(nullptr),
-          object_map{},
           dispatch_table{} {
-        object_map.resize(kVulkanObjectTypeMax + 1);
         memset(&enables, 0, sizeof(enables));
     }
 };
 
 static std::unordered_map<void *, struct instance_extension_enables> instanceExtMap;
-static std::unordered_map<void *, layer_data *> layer_data_map;
+static LayerDataMap<layer_data> layer_data_map;
 static device_table_map ot_device_table_map;
 static instance_table_map ot_instance_table_map;
-static std::mutex global_lock;
-static uint64_t object_track_index = 0;
+static LayerStatsMutex global_lock("global_lock");
+static std::atomic<uint64_t> object_track_index(0);
 
 #include "vk_dispatch_table_helper.h"
 
@@ -19,9 +19,10 @@
 #define PARAMETER_NAME_H
 
 #include <cassert>
+#include <cstring>
+#include <initializer_list>
 #include <sstream>
 #include <string>
-#include <vector>
 
 /**
  * Parameter name string supporting deferred formatting for array subscripts.
@@ -40,15 +41,39 @@
  * provided to the validation function.  String formatting is then performed only when the validation function retrieves the
  * name string from the ParameterName object:
  *         validate_stype(ParameterName("pCreateInfo[%i].sType", IndexVector{ i }), pCreateInfo[i].sType);
+ *
+ * The format string is not copied and the index values are held inline, so constructing a ParameterName never allocates; the
+ * source string must outlive the object, which string literals always do.
  */
 class ParameterName {
    public:
+    /// Maximum number of index values a parameter name may carry.  Generated names nest at most three arrays deep.
+    static const size_t MaxIndexCount = 4;
+
     /// Container for index values to be used with parameter name string formatting.
-    typedef std::vector<size_t> IndexVector;
+    class IndexVector {
+       public:
+        IndexVector() : size_(0) {}
+        IndexVector(std::initializer_list<size_t> values) : size_(0) {
+            assert(values.size() <= MaxIndexCount);
+            for (size_t value : values) {
+                if (size_ < MaxIndexCount) values_[size_++] = value;
+            }
+        }
+
+        bool empty() const { return size_ == 0; }
+        size_t size() const { return size_; }
+        const size_t *begin() const { return values_; }
+        const size_t *end() const { return values_ + size_; }
+
+       private:
+        size_t values_[MaxIndexCount];
+        size_t size_;
+    };
 
     /// Format specifier for the parameter name string, to be replaced by an index value.  The parameter name string must contain
     /// one format specifier for each index value specified.
-    const std::string IndexFormatSpecifier = "%i";
+    static const char *IndexFormatSpecifier() { return "%i"; }
 
    public:
     /**
@@ -61,25 +86,7 @@ class ParameterName {
     ParameterName(const char *source) : source_(source) { assert(IsValid()); }
 
     /**
-    * Construct a ParameterName object from a std::string object, without formatting.
-    *
-    * @param source Paramater name string without format specifiers.
-    *
-    * @pre The source string must not contain the %i format specifier.
-    */
-    ParameterName(const std::string &source) : source_(source) { assert(IsValid()); }
-
-    /**
-    * Construct a ParameterName object from a std::string object, without formatting.
-    *
-    * @param source Paramater name string without format specifiers.
-    *
-    * @pre The source string must not contain the %i format specifier.
-    */
-    ParameterName(const std::string &&source) : source_(std::move(source)) { assert(IsValid()); }
-
-    /**
-    * Construct a ParameterName object from a std::string object, with formatting.
+    * Construct a ParameterName object from a string literal, with formatting.
     *
     * @param source Paramater name string with format specifiers.
     * @param args Array index values to be used for formatting.
@@ -87,61 +94,49 @@ class ParameterName {
     * @pre The number of %i format specifiers contained by the source string must match the number of elements contained
     *      by the index vector.
     */
-    ParameterName(const std::string &source, const IndexVector &args) : source_(source), args_(args) { assert(IsValid()); }
-
-    /**
-    * Construct a ParameterName object from a std::string object, with formatting.
-    *
-    * @param source Paramater name string with format specifiers.
-    * @param args Array index values to be used for formatting.
-    *
-    * @pre The number of %i format specifiers contained by the source string must match the number of elements contained
-    *      by the index vector.
-    */
-    ParameterName(const std::string &&source, const IndexVector &&args) : source_(std::move(source)), args_(std::move(args)) {
-        assert(IsValid());
-    }
+    ParameterName(const char *source, const IndexVector &args) : source_(source), args_(args) { assert(IsValid()); }
 
     /// Retrive the formatted name string.
-    std::string get_name() const { return (args_.empty()) ? source_ : Format(); }
+    std::string get_name() const { return (args_.empty()) ? std::string(source_) : Format(); }
 
    private:
     /// Replace the %i format specifiers in the source string with the values from the index vector.
     std::string Format() const {
-        std::string::size_type current = 0;
-        std::string::size_type last = 0;
+        const size_t specifier_length = strlen(IndexFormatSpecifier());
+        const char *last = source_;
         std::stringstream format;
 
         for (size_t index : args_) {
-            current = source_.find(IndexFormatSpecifier, last);
-            if (current == std::string::npos) {
+            const char *current = strstr(last, IndexFormatSpecifier());
+            if (current == nullptr) {
                 break;
             }
-            format << source_.substr(last, (current - last)) << index;
-            last = current + IndexFormatSpecifier.length();
+            format.write(last, current - last);
+            format << index;
+            last = current + specifier_length;
         }
 
-        format << source_.substr(last, std::string::npos);
+        format << last;
 
         return format.str();
     }
 
     /// Check that the number of %i format specifiers in the source string matches the number of elements in the index vector.
-    bool IsValid() {
+    bool IsValid() const {
         // Count the number of occurances of the format specifier
-        uint32_t count = 0;
-        std::string::size_type pos = source_.find(IndexFormatSpecifier);
+        size_t count = 0;
+        const char *pos = strstr(source_, IndexFormatSpecifier());
 
-        while (pos != std::string::npos) {
+        while (pos != nullptr) {
             ++count;
-            pos = source_.find(IndexFormatSpecifier, pos + 1);
+            pos = strstr(pos + 1, IndexFormatSpecifier());
         }
 
         return (count == args_.size());
     }
 
    private:
-    std::string source_;  ///< Format string.
+    const char *source_;  ///< Format string.
     IndexVector args_;    ///< Array index values for formatting.
 };
 
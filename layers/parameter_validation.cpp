@@ -45,6 +45,7 @@
 #include "vk_layer_table.h"
 #include "vk_layer_data.h"
 #include "vk_layer_logging.h"
+#include "vk_layer_stats.h"
 #include "vk_layer_extension_utils.h"
 #include "vk_layer_utils.h"
 
@@ -107,11 +108,12 @@ struct layer_data {
 };
 
 static uint32_t loader_layer_if_version = CURRENT_LOADER_LAYER_INTERFACE_VERSION;
-static std::unordered_map<void *, layer_data *> layer_data_map;
-static std::unordered_map<void *, instance_layer_data *> instance_layer_data_map;
+static LayerDataMap<layer_data> layer_data_map;
+static LayerDataMap<instance_layer_data> instance_layer_data_map;
 
 static void init_parameter_validation(instance_layer_data *my_data, const VkAllocationCallbacks *pAllocator) {
     layer_debug_actions(my_data->report_data, my_data->logging_callback, pAllocator, "lunarg_parameter_validation");
+    GetLayerStats().Init("lunarg_parameter_validation");
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL CreateDebugReportCallbackEXT(VkInstance instance,
@@ -1414,6 +1416,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
             my_data->logging_callback.pop_back();
         }
 
+        GetLayerStats().DumpJson();
         layer_debug_report_destroy_instance(my_data->report_data);
         instance_layer_data_map.erase(key);
     }
@@ -7004,9 +7007,8 @@ VKAPI_ATTR void VKAPI_CALL SetHdrMetadataEXT(VkDevice device, uint32_t swapchain
 }
 
 static inline PFN_vkVoidFunction layer_intercept_proc(const char *name) {
-    for (unsigned int i = 0; i < sizeof(procmap) / sizeof(procmap[0]); i++) {
-        if (!strcmp(name, procmap[i].name)) return procmap[i].pFunc;
-    }
+    auto entry = util_FindEntryByName(procmap, name);
+    if (entry) return entry->pFunc;
     return NULL;
 }
 
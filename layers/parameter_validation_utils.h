@@ -492,8 +492,6 @@ static bool validate_struct_pnext(debug_report_data *report_data, const char *ap
                                   const char *allowed_struct_names, const void *next, size_t allowed_type_count,
                                   const VkStructureType *allowed_types, uint32_t header_version) {
     bool skip_call = false;
-    std::unordered_set<const void *> cycle_check;
-    std::unordered_set<VkStructureType, std::hash<int>> unique_stype_check;
 
     const char disclaimer[] =
         "This warning is based on the Valid Usage documentation for version %d of the Vulkan header.  It "
@@ -513,30 +511,34 @@ static bool validate_struct_pnext(debug_report_data *report_data, const char *ap
         } else {
             const VkStructureType *start = allowed_types;
             const VkStructureType *end = allowed_types + allowed_type_count;
-            const GenericHeader *current = reinterpret_cast<const GenericHeader *>(next);
-
-            cycle_check.insert(next);
-
+            const GenericHeader *first = reinterpret_cast<const GenericHeader *>(next);
+            const GenericHeader *current = first;
 
+            // Chains are short, so cycles and duplicates are found by rescanning the visited prefix rather than by
+            // building sets, which keeps valid chains free of allocations.
             while (current != NULL) {
-                if (cycle_check.find(current->pNext) != cycle_check.end()) {
+                bool repeated_next = false;
+                bool repeated_stype = false;
+                for (const GenericHeader *visited = first;; visited = reinterpret_cast<const GenericHeader *>(visited->pNext)) {
+                    if (visited == current->pNext) repeated_next = true;
+                    if (visited == current) break;
+                    if (visited->sType == current->sType) repeated_stype = true;
+                }
+
+                if (repeated_next) {
                     std::string message = "%s: %s chain contains a cycle -- pNext pointer " PRIx64 " is repeated.";
                     skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
                                          __LINE__, INVALID_STRUCT_PNEXT, LayerName, message.c_str(), api_name,
                                          parameter_name.get_name().c_str(), reinterpret_cast<uint64_t>(next));
                     break;
-                } else {
-                    cycle_check.insert(current->pNext);
                 }
 
-                std::string type_name = string_VkStructureType(current->sType);
-                if (unique_stype_check.find(current->sType) != unique_stype_check.end()) {
+                const char *type_name = string_VkStructureType(current->sType);
+                if (repeated_stype) {
                     std::string message = "%s: %s chain contains duplicate structure types: %s appears multiple times.";
                     skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
                                          __LINE__, INVALID_STRUCT_PNEXT, LayerName, message.c_str(), api_name,
-                                         parameter_name.get_name().c_str(), type_name.c_str());
-                } else {
-                    unique_stype_check.insert(current->sType);
+                                         parameter_name.get_name().c_str(), type_name);
                 }
 
                 if (std::find(start, end, current->sType) == end) {
@@ -555,7 +557,7 @@ static bool validate_struct_pnext(debug_report_data *report_data, const char *ap
                         message += disclaimer;
                         skip_call |= log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT,
                                              0, __LINE__, INVALID_STRUCT_PNEXT, LayerName, message.c_str(), api_name,
-                                             parameter_name.get_name().c_str(), type_name.c_str(), allowed_struct_names,
+                                             parameter_name.get_name().c_str(), type_name, allowed_struct_names,
                                              header_version, parameter_name.get_name().c_str());
                     }
                 }
@@ -25,6 +25,7 @@
 #include "swapchain.h"
 #include "vk_enum_string_helper.h"
 #include "vk_layer_extension_utils.h"
+#include "vk_layer_stats.h"
 #include "vk_layer_utils.h"
 #include "vk_validation_error_messages.h"
 #include <mutex>
@@ -34,10 +35,10 @@
 
 namespace swapchain {
 
-static std::mutex global_lock;
+static LayerStatsMutex global_lock("global_lock");
 
 // The following is for logging error messages:
-static std::unordered_map<void *, layer_data *> layer_data_map;
+static LayerDataMap<layer_data> layer_data_map;
 
 static uint32_t loader_layer_if_version = CURRENT_LOADER_LAYER_INTERFACE_VERSION;
 
@@ -96,6 +97,7 @@ static void checkInstanceRegisterExtensions(const VkInstanceCreateInfo *pCreateI
 #include "vk_dispatch_table_helper.h"
 static void init_swapchain(layer_data *my_data, const VkAllocationCallbacks *pAllocator) {
     layer_debug_actions(my_data->report_data, my_data->logging_callback, pAllocator, "lunarg_swapchain");
+    GetLayerStats().Init("lunarg_swapchain");
 }
 
 static const char *presentModeStr(VkPresentModeKHR value) {
@@ -183,7 +185,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
     // Call down the call chain:
     my_data->instance_dispatch_table->DestroyInstance(instance, pAllocator);
 
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<LayerStatsMutex> lock(global_lock);
 
     // Enable the temporary callback(s) here to catch cleanup issues:
     bool callback_setup = false;
@@ -243,6 +245,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
         layer_destroy_msg_callback(my_data->report_data, callback, pAllocator);
         my_data->logging_callback.pop_back();
     }
+    GetLayerStats().DumpJson();
     layer_debug_report_destroy_instance(my_data->report_data);
 
     delete my_data->instance_dispatch_table;
@@ -252,7 +255,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
 static void PostCallRecordGetPhysicalDeviceQueueFamilyProperties(layer_data *dev_data, VkPhysicalDevice physical_device,
                                                                  uint32_t *qfp_count, bool qfp_is_null) {
     // Record the result of this query:
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<LayerStatsMutex> lock(global_lock);
     SwpPhysicalDevice *phy_data = NULL;
     {
         auto it = dev_data->physicalDeviceMap.find(physical_device);
@@ -297,7 +300,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAndroidSurfaceKHR(VkInstance instance, cons
     VkResult result = VK_SUCCESS;
     bool skip_call = false;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     SwpInstance *pInstance = NULL;
     {
         auto it = my_data->instanceMap.find(instance);
@@ -339,7 +342,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateMirSurfaceKHR(VkInstance instance, const Vk
     VkResult result = VK_SUCCESS;
     bool skip_call = false;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     SwpInstance *pInstance = NULL;
     {
         auto it = my_data->instanceMap.find(instance);
@@ -379,7 +382,7 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceMirPresentationSupportKHR(VkPhys
     VkBool32 result = VK_FALSE;
     bool skip_call = false;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     SwpPhysicalDevice *pPhysicalDevice = NULL;
     {
         auto it = my_data->physicalDeviceMap.find(physicalDevice);
@@ -408,7 +411,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateWaylandSurfaceKHR(VkInstance instance, cons
     VkResult result = VK_SUCCESS;
     bool skip_call = false;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     SwpInstance *pInstance = NULL;
     {
         auto it = my_data->instanceMap.find(instance);
@@ -449,7 +452,7 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceWaylandPresentationSupportKHR(Vk
     VkBool32 result = VK_FALSE;
     bool skip_call = false;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     SwpPhysicalDevice *pPhysicalDevice = NULL;
     {
         auto it = my_data->physicalDeviceMap.find(physicalDevice);
@@ -478,7 +481,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateWin32SurfaceKHR(VkInstance instance, const
     VkResult result = VK_SUCCESS;
     bool skip_call = false;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     SwpInstance *pInstance = NULL;
     {
         auto it = my_data->instanceMap.find(instance);
@@ -518,7 +521,7 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceWin32PresentationSupportKHR(VkPh
     VkBool32 result = VK_FALSE;
     bool skip_call = false;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     SwpPhysicalDevice *pPhysicalDevice = NULL;
     {
         auto it = my_data->physicalDeviceMap.find(physicalDevice);
@@ -546,7 +549,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateXcbSurfaceKHR(VkInstance instance, const Vk
     VkResult result = VK_SUCCESS;
     bool skip_call = false;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     SwpInstance *pInstance = NULL;
     {
         auto it = my_data->instanceMap.find(instance);
@@ -587,7 +590,7 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceXcbPresentationSupportKHR(VkPhys
     VkBool32 result = VK_FALSE;
     bool skip_call = false;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     SwpPhysicalDevice *pPhysicalDevice = NULL;
     {
         auto it = my_data->physicalDeviceMap.find(physicalDevice);
@@ -616,7 +619,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateXlibSurfaceKHR(VkInstance instance, const V
     VkResult result = VK_SUCCESS;
     bool skip_call = false;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     SwpInstance *pInstance = NULL;
     {
         auto it = my_data->instanceMap.find(instance);
@@ -657,7 +660,7 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceXlibPresentationSupportKHR(VkPhy
     VkBool32 result = VK_FALSE;
     bool skip_call = false;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     SwpPhysicalDevice *pPhysicalDevice = NULL;
     {
         auto it = my_data->physicalDeviceMap.find(physicalDevice);
@@ -685,7 +688,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPlanePropertiesKHR(VkPhys
     VkResult result = VK_SUCCESS;
     bool skip_call = false;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     SwpPhysicalDevice *pPhysicalDevice = NULL;
     {
         auto it = my_data->physicalDeviceMap.find(physicalDevice);
@@ -715,7 +718,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneSupportedDisplaysKHR(VkPhysicalDev
     VkResult result = VK_SUCCESS;
     bool skip_call = false;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     SwpPhysicalDevice *pPhysicalDevice = NULL;
     {
         auto it = my_data->physicalDeviceMap.find(physicalDevice);
@@ -756,7 +759,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneCapabilitiesKHR(VkPhysicalDevice p
     VkResult result = VK_SUCCESS;
     bool skip_call = false;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     SwpPhysicalDevice *pPhysicalDevice = NULL;
     {
         auto it = my_data->physicalDeviceMap.find(physicalDevice);
@@ -795,7 +798,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDisplayPlaneSurfaceKHR(VkInstance instance,
     VkResult result = VK_SUCCESS;
     bool skip_call = false;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     SwpInstance *pInstance = &(my_data->instanceMap[instance]);
 
     // TODO more validation checks
@@ -825,7 +828,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDisplayPlaneSurfaceKHR(VkInstance instance,
 VKAPI_ATTR void VKAPI_CALL DestroySurfaceKHR(VkInstance instance, VkSurfaceKHR surface, const VkAllocationCallbacks *pAllocator) {
     bool skip_call = false;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     SwpSurface *pSurface = NULL;
     {
         auto it = my_data->surfaceMap.find(surface);
@@ -875,7 +878,7 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDevices(VkInstance instance, uin
     // Call down the call chain:
     result = my_data->instance_dispatch_table->EnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
 
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<LayerStatsMutex> lock(global_lock);
     SwpInstance *pInstance = NULL;
     {
         auto it = my_data->instanceMap.find(instance);
@@ -918,7 +921,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice physicalDevice, con
         return result;
     }
 
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<LayerStatsMutex> lock(global_lock);
     layer_data *my_device_data = GetLayerDataPtr(get_dispatch_key(*pDevice), layer_data_map);
 
     // Setup device dispatch table
@@ -939,7 +942,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     my_data->device_dispatch_table->DestroyDevice(device, pAllocator);
 
     // Do some internal cleanup:
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<LayerStatsMutex> lock(global_lock);
     SwpDevice *pDevice = NULL;
     {
         auto it = my_data->deviceMap.find(device);
@@ -977,10 +980,11 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
 
 VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex,
                                                                   VkSurfaceKHR surface, VkBool32 *pSupported) {
+    LAYER_STATS_CALL("vkGetPhysicalDeviceSurfaceSupportKHR");
     VkResult result = VK_SUCCESS;
     bool skip_call = false;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     SwpPhysicalDevice *pPhysicalDevice = NULL;
     {
         auto it = my_data->physicalDeviceMap.find(physicalDevice);
@@ -1003,8 +1007,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevi
 
     if (!skip_call) {
         // Call down the call chain:
+        layer_stats_call.Pause();
         result = my_data->instance_dispatch_table->GetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface,
                                                                                       pSupported);
+        layer_stats_call.Resume();
         lock.lock();
 
         // Obtain this pointer again after locking:
@@ -1104,15 +1110,18 @@ static bool validateCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateI
 
 VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR *pCreateInfo,
                                                   const VkAllocationCallbacks *pAllocator, VkSwapchainKHR *pSwapchain) {
+    LAYER_STATS_CALL("vkCreateSwapchainKHR");
     VkResult result = VK_SUCCESS;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
     bool skip_call = validateCreateSwapchainKHR(device, pCreateInfo, pSwapchain);
     lock.unlock();
 
     if (!skip_call) {
         // Call down the call chain:
+        layer_stats_call.Pause();
         result = my_data->device_dispatch_table->CreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
+        layer_stats_call.Resume();
         lock.lock();
 
         if (result == VK_SUCCESS) {
@@ -1148,6 +1157,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(VkDevice device, const VkSwapc
 }
 
 VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks *pAllocator) {
+    LAYER_STATS_CALL("vkDestroySwapchainKHR");
     // TODOs:
     //
     // - Implement a check for validity language that reads: All uses of
@@ -1155,7 +1165,7 @@ VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(VkDevice device, VkSwapchainKHR s
     //   execution
     bool skip_call = false;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
 
     // Regardless of skip_call value, do some internal cleanup:
     SwpSwapchain *pSwapchain = NULL;
@@ -1177,16 +1187,19 @@ VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(VkDevice device, VkSwapchainKHR s
 
     if (!skip_call) {
         // Call down the call chain:
+        layer_stats_call.Pause();
         my_data->device_dispatch_table->DestroySwapchainKHR(device, swapchain, pAllocator);
+        layer_stats_call.Resume();
     }
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t *pSwapchainImageCount,
                                                      VkImage *pSwapchainImages) {
+    LAYER_STATS_CALL("vkGetSwapchainImagesKHR");
     VkResult result = VK_SUCCESS;
     bool skip_call = false;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<LayerStatsMutex> lock(global_lock);
 
     SwpSwapchain *pSwapchain = NULL;
     {
@@ -1215,7 +1228,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(VkDevice device, VkSwapchai
 
     if (!skip_call) {
         // Call down the call chain:
+        layer_stats_call.Pause();
         result = my_data->device_dispatch_table->GetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+        layer_stats_call.Resume();
         lock.lock();
 
         // Obtain this pointer again after locking:
@@ -1239,15 +1254,18 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(VkDevice device, VkSwapchai
 }
 
 VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue *pQueue) {
+    LAYER_STATS_CALL("vkGetDeviceQueue");
     bool skip_call = false;
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
 
     if (!skip_call) {
         // Call down the call chain:
+        layer_stats_call.Pause();
         my_data->device_dispatch_table->GetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
+        layer_stats_call.Resume();
 
         // Remember the queue's handle, and link it to the device:
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<LayerStatsMutex> lock(global_lock);
         SwpDevice *pDevice = NULL;
         {
             auto it = my_data->deviceMap.find(device);
@@ -1270,7 +1288,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDebugReportCallbackEXT(VkInstance instance,
     VkResult result =
         my_data->instance_dispatch_table->CreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pMsgCallback);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<LayerStatsMutex> lock(global_lock);
         result = layer_create_msg_callback(my_data->report_data, false, pCreateInfo, pAllocator, pMsgCallback);
     }
     return result;
@@ -1280,7 +1298,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDebugReportCallbackEXT(VkInstance instance, Vk
                                                          const VkAllocationCallbacks *pAllocator) {
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     my_data->instance_dispatch_table->DestroyDebugReportCallbackEXT(instance, msgCallback, pAllocator);
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<LayerStatsMutex> lock(global_lock);
     layer_destroy_msg_callback(my_data->report_data, msgCallback, pAllocator);
 }
 
@@ -29,6 +29,7 @@
 #include "vk_layer_utils.h"
 #include "vk_layer_table.h"
 #include "vk_layer_logging.h"
+#include "vk_layer_stats.h"
 #include "threading.h"
 #include "vk_dispatch_table_helper.h"
 #include "vk_enum_string_helper.h"
@@ -43,6 +44,7 @@ static uint32_t loader_layer_if_version = CURRENT_LOADER_LAYER_INTERFACE_VERSION
 
 static void initThreading(layer_data *my_data, const VkAllocationCallbacks *pAllocator) {
     layer_debug_actions(my_data->report_data, my_data->logging_callback, pAllocator, "google_threading");
+    GetLayerStats().Init("google_threading");
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator,
@@ -119,6 +121,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
         my_data->logging_callback.pop_back();
     }
 
+    GetLayerStats().DumpJson();
     layer_debug_report_destroy_instance(my_data->report_data);
     delete my_data->instance_dispatch_table;
     layer_data_map.erase(key);
@@ -202,9 +205,8 @@ static const VkLayerProperties layerProps = {
 };
 
 static inline PFN_vkVoidFunction layer_intercept_proc(const char *name) {
-    for (unsigned int i = 0; i < sizeof(procmap) / sizeof(procmap[0]); i++) {
-        if (!strcmp(name, procmap[i].name)) return procmap[i].pFunc;
-    }
+    auto entry = util_FindEntryByName(procmap, name);
+    if (entry) return entry->pFunc;
     return NULL;
 }
 
@@ -20,8 +20,12 @@
 
 #ifndef THREADING_H
 #define THREADING_H
+#include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 #include "vk_layer_config.h"
 #include "vk_layer_logging.h"
@@ -68,143 +72,183 @@ inline bool startMultiThread() {
 inline void finishMultiThread() { vulkan_in_use = false; }
 }  // namespace threading
 
+// Tracks which threads are using objects of one type. Objects hash onto a fixed array of stripes, each guarded by its own
+// spin flag and holding a few in-use entries inline, so the uncontended start/finish pair is two flag exchanges on a stripe
+// that unrelated objects rarely share, with no allocation. A stripe only spills to a map when many of its objects are in use
+// at once. The mutex and condition variable are touched only when a thread must wait out a conflicting use.
 template <typename T>
 class counter {
    public:
     const char *typeName;
     VkDebugReportObjectTypeEXT objectType;
-    std::unordered_map<T, object_use_data> uses;
-    std::mutex counter_lock;
-    std::condition_variable counter_condition;
-    void startWrite(debug_report_data *report_data, T object) {
-        bool skipCall = false;
-        loader_platform_thread_id tid = loader_platform_get_thread_id();
-        std::unique_lock<std::mutex> lock(counter_lock);
-        if (uses.find(object) == uses.end()) {
-            // There is no current use of the object.  Record writer thread.
-            struct object_use_data *use_data = &uses[object];
-            use_data->reader_count = 0;
-            use_data->writer_count = 1;
-            use_data->thread = tid;
-        } else {
-            struct object_use_data *use_data = &uses[object];
-            if (use_data->reader_count == 0) {
-                // There are no readers.  Two writers just collided.
-                if (use_data->thread != tid) {
-                    skipCall |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, objectType, (uint64_t)(object), 0,
-                                        THREADING_CHECKER_MULTIPLE_THREADS, "THREADING",
-                                        "THREADING ERROR : object of type %s is simultaneously used in thread %ld and thread %ld",
-                                        typeName, use_data->thread, tid);
-                    if (skipCall) {
-                        // Wait for thread-safe access to object instead of skipping call.
-                        while (uses.find(object) != uses.end()) {
-                            counter_condition.wait(lock);
-                        }
-                        // There is now no current use of the object.  Record writer thread.
-                        struct object_use_data *new_use_data = &uses[object];
-                        new_use_data->thread = tid;
-                        new_use_data->reader_count = 0;
-                        new_use_data->writer_count = 1;
-                    } else {
-                        // Continue with an unsafe use of the object.
-                        use_data->thread = tid;
-                        use_data->writer_count += 1;
-                    }
-                } else {
-                    // This is either safe multiple use in one call, or recursive use.
-                    // There is no way to make recursion safe.  Just forge ahead.
-                    use_data->writer_count += 1;
-                }
-            } else {
-                // There are readers.  This writer collided with them.
-                if (use_data->thread != tid) {
-                    skipCall |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, objectType, (uint64_t)(object), 0,
-                                        THREADING_CHECKER_MULTIPLE_THREADS, "THREADING",
-                                        "THREADING ERROR : object of type %s is simultaneously used in thread %ld and thread %ld",
-                                        typeName, use_data->thread, tid);
-                    if (skipCall) {
-                        // Wait for thread-safe access to object instead of skipping call.
-                        while (uses.find(object) != uses.end()) {
-                            counter_condition.wait(lock);
-                        }
-                        // There is now no current use of the object.  Record writer thread.
-                        struct object_use_data *new_use_data = &uses[object];
-                        new_use_data->thread = tid;
-                        new_use_data->reader_count = 0;
-                        new_use_data->writer_count = 1;
-                    } else {
-                        // Continue with an unsafe use of the object.
-                        use_data->thread = tid;
-                        use_data->writer_count += 1;
-                    }
-                } else {
-                    // This is either safe multiple use in one call, or recursive use.
-                    // There is no way to make recursion safe.  Just forge ahead.
-                    use_data->writer_count += 1;
-                }
+
+    void startWrite(debug_report_data *report_data, T object) { startUse(report_data, object, true); }
+    void finishWrite(T object) { finishUse(object, true); }
+    void startRead(debug_report_data *report_data, T object) { startUse(report_data, object, false); }
+    void finishRead(T object) { finishUse(object, false); }
+
+    counter(const char *name = "", VkDebugReportObjectTypeEXT type = VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT) {
+        typeName = name;
+        objectType = type;
+        for (auto &stripe : stripes) {
+            stripe.busy.store(false, std::memory_order_relaxed);
+            stripe.waiters.store(0, std::memory_order_relaxed);
+            for (auto &entry : stripe.inline_uses) {
+                entry.data.reader_count = 0;
+                entry.data.writer_count = 0;
             }
         }
     }
 
-    void finishWrite(T object) {
-        // Object is no longer in use
-        std::unique_lock<std::mutex> lock(counter_lock);
-        uses[object].writer_count -= 1;
-        if ((uses[object].reader_count == 0) && (uses[object].writer_count == 0)) {
-            uses.erase(object);
+   private:
+    static const uint32_t kStripeBits = 5;
+    static const uint32_t kInlineUses = 4;
+
+    struct use_entry {
+        T object;
+        object_use_data data;  // Slot is free when both counts are zero
+    };
+
+    struct use_stripe {
+        std::atomic<bool> busy;
+        std::atomic<uint32_t> waiters;
+        use_entry inline_uses[kInlineUses];
+        std::unique_ptr<std::unordered_map<T, object_use_data>> overflow;
+    };
+
+    use_stripe stripes[1 << kStripeBits];
+    std::mutex wait_lock;
+    std::condition_variable wait_condition;
+
+    use_stripe &getStripe(T object) {
+        return stripes[(((uint64_t)(object) >> 4) * UINT64_C(0x9E3779B97F4A7C15)) >> (64 - kStripeBits)];
+    }
+
+    static void lockStripe(use_stripe &stripe) {
+        while (stripe.busy.exchange(true, std::memory_order_acquire)) {
+            while (stripe.busy.load(std::memory_order_relaxed)) std::this_thread::yield();
         }
-        // Notify any waiting threads that this object may be safe to use
-        lock.unlock();
-        counter_condition.notify_all();
     }
 
-    void startRead(debug_report_data *report_data, T object) {
-        bool skipCall = false;
+    static void unlockStripe(use_stripe &stripe) { stripe.busy.store(false, std::memory_order_release); }
+
+    // Stripe must be locked by the caller for the following helpers
+    static object_use_data *findUse(use_stripe &stripe, T object) {
+        for (auto &entry : stripe.inline_uses) {
+            if ((entry.data.reader_count || entry.data.writer_count) && entry.object == object) return &entry.data;
+        }
+        if (stripe.overflow) {
+            auto it = stripe.overflow->find(object);
+            if (it != stripe.overflow->end()) return &it->second;
+        }
+        return nullptr;
+    }
+
+    static void addUse(use_stripe &stripe, T object, loader_platform_thread_id tid, bool write) {
+        object_use_data *use_data = nullptr;
+        for (auto &entry : stripe.inline_uses) {
+            if (!entry.data.reader_count && !entry.data.writer_count) {
+                entry.object = object;
+                use_data = &entry.data;
+                break;
+            }
+        }
+        if (!use_data) {
+            if (!stripe.overflow) stripe.overflow.reset(new std::unordered_map<T, object_use_data>);
+            use_data = &(*stripe.overflow)[object];
+        }
+        use_data->thread = tid;
+        use_data->reader_count = write ? 0 : 1;
+        use_data->writer_count = write ? 1 : 0;
+    }
+
+    static void releaseUse(use_stripe &stripe, T object, bool write) {
+        object_use_data *use_data = findUse(stripe, object);
+        if (!use_data) return;
+        if (write) {
+            use_data->writer_count -= 1;
+        } else {
+            use_data->reader_count -= 1;
+        }
+        if (use_data->reader_count == 0 && use_data->writer_count == 0 && stripe.overflow) {
+            // Inline slots free themselves by reaching zero; overflow entries must be erased
+            stripe.overflow->erase(object);
+        }
+    }
+
+    void startUse(debug_report_data *report_data, T object, bool write) {
         loader_platform_thread_id tid = loader_platform_get_thread_id();
-        std::unique_lock<std::mutex> lock(counter_lock);
-        if (uses.find(object) == uses.end()) {
-            // There is no current use of the object.  Record reader count
-            struct object_use_data *use_data = &uses[object];
-            use_data->reader_count = 1;
-            use_data->writer_count = 0;
-            use_data->thread = tid;
-        } else if (uses[object].writer_count > 0 && uses[object].thread != tid) {
-            // There is a writer of the object.
-            skipCall |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, objectType, (uint64_t)(object), 0,
+        use_stripe &stripe = getStripe(object);
+        lockStripe(stripe);
+        object_use_data *use_data = findUse(stripe, object);
+        if (!use_data) {
+            // There is no current use of the object.  Record this thread's use.
+            addUse(stripe, object, tid, write);
+            unlockStripe(stripe);
+            return;
+        }
+        // A writer collides with any use from another thread; a reader only with another thread's write.
+        bool collision = (use_data->thread != tid) && (write || use_data->writer_count > 0);
+        if (!collision) {
+            // This is either safe multiple use in one call, or recursive use.
+            // There is no way to make recursion safe.  Just forge ahead.
+            if (write) {
+                use_data->writer_count += 1;
+            } else {
+                use_data->reader_count += 1;
+            }
+            unlockStripe(stripe);
+            return;
+        }
+        loader_platform_thread_id other_tid = use_data->thread;
+        unlockStripe(stripe);
+
+        bool skipCall = log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, objectType, (uint64_t)(object), 0,
                                 THREADING_CHECKER_MULTIPLE_THREADS, "THREADING",
                                 "THREADING ERROR : object of type %s is simultaneously used in thread %ld and thread %ld", typeName,
-                                uses[object].thread, tid);
-            if (skipCall) {
-                // Wait for thread-safe access to object instead of skipping call.
-                while (uses.find(object) != uses.end()) {
-                    counter_condition.wait(lock);
+                                other_tid, tid);
+        if (skipCall) {
+            // Wait for thread-safe access to object instead of skipping call.
+            stripe.waiters.fetch_add(1);
+            std::unique_lock<std::mutex> lock(wait_lock);
+            while (true) {
+                lockStripe(stripe);
+                if (!findUse(stripe, object)) {
+                    // There is now no current use of the object.  Record this thread's use.
+                    addUse(stripe, object, tid, write);
+                    unlockStripe(stripe);
+                    break;
                 }
-                // There is no current use of the object.  Record reader count
-                struct object_use_data *use_data = &uses[object];
-                use_data->reader_count = 1;
-                use_data->writer_count = 0;
+                unlockStripe(stripe);
+                wait_condition.wait(lock);
+            }
+            stripe.waiters.fetch_sub(1);
+        } else {
+            // Continue with an unsafe use of the object.
+            lockStripe(stripe);
+            use_data = findUse(stripe, object);
+            if (!use_data) {
+                addUse(stripe, object, tid, write);
+            } else if (write) {
                 use_data->thread = tid;
+                use_data->writer_count += 1;
             } else {
-                uses[object].reader_count += 1;
+                use_data->reader_count += 1;
             }
-        } else {
-            // There are other readers of the object.  Increase reader count
-            uses[object].reader_count += 1;
+            unlockStripe(stripe);
         }
     }
-    void finishRead(T object) {
-        std::unique_lock<std::mutex> lock(counter_lock);
-        uses[object].reader_count -= 1;
-        if ((uses[object].reader_count == 0) && (uses[object].writer_count == 0)) {
-            uses.erase(object);
-        }
+
+    void finishUse(T object, bool write) {
+        use_stripe &stripe = getStripe(object);
+        lockStripe(stripe);
+        releaseUse(stripe, object, write);
+        unlockStripe(stripe);
         // Notify any waiting threads that this object may be safe to use
-        lock.unlock();
-        counter_condition.notify_all();
-    }
-    counter(const char *name = "", VkDebugReportObjectTypeEXT type = VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT) {
-        typeName = name;
-        objectType = type;
+        if (stripe.waiters.load() > 0) {
+            std::lock_guard<std::mutex> lock(wait_lock);
+            wait_condition.notify_all();
+        }
     }
 };
 
@@ -348,7 +392,7 @@ WRAPPER(VkDescriptorUpdateTemplateKHR)
 WRAPPER(uint64_t)
 #endif  // DISTINCT_NONDISPATCHABLE_HANDLES
 
-static std::unordered_map<void *, layer_data *> layer_data_map;
+static LayerDataMap<layer_data> layer_data_map;
 static std::mutex command_pool_lock;
 static std::unordered_map<VkCommandBuffer, VkCommandPool> command_pool_map;
 
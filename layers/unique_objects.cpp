@@ -40,6 +40,7 @@
 #include "vk_layer_data.h"
 #include "vk_layer_extension_utils.h"
 #include "vk_layer_logging.h"
+#include "vk_layer_stats.h"
 #include "vk_layer_table.h"
 #include "vk_layer_utils.h"
 #include "vk_layer_utils.h"
@@ -59,6 +60,7 @@ static uint32_t loader_layer_if_version = CURRENT_LOADER_LAYER_INTERFACE_VERSION
 
 static void initUniqueObjects(layer_data *instance_data, const VkAllocationCallbacks *pAllocator) {
     layer_debug_actions(instance_data->report_data, instance_data->logging_callback, pAllocator, "google_unique_objects");
+    GetLayerStats().Init("google_unique_objects");
 }
 
 // Handle CreateInstance Extensions
@@ -206,6 +208,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
     instance_ext_map.erase(disp_table);
     disp_table->DestroyInstance(instance, pAllocator);
 
+    // Release the IDs of surfaces, displays and other instance objects the application did not destroy
+    unique_id_table.RemoveOwner(instance_data->owner_id);
+
     // Clean up logging callback, if any
     while (instance_data->logging_callback.size() > 0) {
         VkDebugReportCallbackEXT callback = instance_data->logging_callback.back();
@@ -213,6 +218,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
         instance_data->logging_callback.pop_back();
     }
 
+    GetLayerStats().DumpJson();
     layer_debug_report_destroy_instance(instance_data->report_data);
     layer_data_map.erase(key);
 }
@@ -259,6 +265,15 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
 
     layer_debug_report_destroy_device(device);
     dev_data->device_dispatch_table->DestroyDevice(device, pAllocator);
+
+    // Release the IDs of every object still alive on this device
+    unique_id_table.RemoveOwner(dev_data->owner_id);
+    {
+        std::lock_guard<std::mutex> lock(global_lock);
+        dev_data->desc_template_map.clear();
+        dev_data->pool_descriptor_sets_map.clear();
+        dev_data->swapchain_wrapped_image_handle_map.clear();
+    }
     layer_data_map.erase(key);
 }
 
@@ -271,9 +286,8 @@ static const VkLayerProperties globalLayerProps = {"VK_LAYER_GOOGLE_unique_objec
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(VkInstance instance, const char *funcName);
 
 static inline PFN_vkVoidFunction layer_intercept_proc(const char *name) {
-    for (unsigned int i = 0; i < sizeof(procmap) / sizeof(procmap[0]); i++) {
-        if (!strcmp(name, procmap[i].name)) return procmap[i].pFunc;
-    }
+    auto entry = util_FindEntryByName(procmap, name);
+    if (entry) return entry->pFunc;
     if (0 == strcmp(name, "vk_layerGetPhysicalDeviceProcAddr")) {
         return (PFN_vkVoidFunction)GetPhysicalDeviceProcAddr;
     }
@@ -362,46 +376,26 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(VkDevice device, VkPipelin
                                                       const VkComputePipelineCreateInfo *pCreateInfos,
                                                       const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines) {
     layer_data *my_device_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    safe_VkComputePipelineCreateInfo *local_pCreateInfos = NULL;
+    ScratchArena scratch;
+    VkComputePipelineCreateInfo *local_pCreateInfos = NULL;
     if (pCreateInfos) {
-        std::lock_guard<std::mutex> lock(global_lock);
-        local_pCreateInfos = new safe_VkComputePipelineCreateInfo[createInfoCount];
+        local_pCreateInfos = scratch.Copy(pCreateInfos, createInfoCount);
+        if (!local_pCreateInfos) return VK_ERROR_OUT_OF_HOST_MEMORY;
         for (uint32_t idx0 = 0; idx0 < createInfoCount; ++idx0) {
-            local_pCreateInfos[idx0].initialize(&pCreateInfos[idx0]);
-            if (pCreateInfos[idx0].basePipelineHandle) {
-                local_pCreateInfos[idx0].basePipelineHandle =
-                    (VkPipeline)my_device_data
-                        ->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].basePipelineHandle)];
-            }
-            if (pCreateInfos[idx0].layout) {
-                local_pCreateInfos[idx0].layout =
-                    (VkPipelineLayout)
-                        my_device_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].layout)];
-            }
-            if (pCreateInfos[idx0].stage.module) {
-                local_pCreateInfos[idx0].stage.module =
-                    (VkShaderModule)
-                        my_device_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].stage.module)];
-            }
+            local_pCreateInfos[idx0].basePipelineHandle = Unwrap(pCreateInfos[idx0].basePipelineHandle);
+            local_pCreateInfos[idx0].layout = Unwrap(pCreateInfos[idx0].layout);
+            local_pCreateInfos[idx0].stage.module = Unwrap(pCreateInfos[idx0].stage.module);
         }
     }
     if (pipelineCache) {
-        std::lock_guard<std::mutex> lock(global_lock);
-        pipelineCache = (VkPipelineCache)my_device_data->unique_id_mapping[reinterpret_cast<uint64_t &>(pipelineCache)];
+        pipelineCache = Unwrap(pipelineCache);
     }
 
     VkResult result = my_device_data->device_dispatch_table->CreateComputePipelines(
-        device, pipelineCache, createInfoCount, (const VkComputePipelineCreateInfo *)local_pCreateInfos, pAllocator, pPipelines);
-    delete[] local_pCreateInfos;
-    {
-        uint64_t unique_id = 0;
-        std::lock_guard<std::mutex> lock(global_lock);
-        for (uint32_t i = 0; i < createInfoCount; ++i) {
-            if (pPipelines[i] != VK_NULL_HANDLE) {
-                unique_id = global_unique_id++;
-                my_device_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(pPipelines[i]);
-                pPipelines[i] = reinterpret_cast<VkPipeline &>(unique_id);
-            }
+        device, pipelineCache, createInfoCount, local_pCreateInfos, pAllocator, pPipelines);
+    for (uint32_t i = 0; i < createInfoCount; ++i) {
+        if (pPipelines[i] != VK_NULL_HANDLE) {
+            pPipelines[i] = WrapNew(my_device_data, pPipelines[i]);
         }
     }
     return result;
@@ -411,55 +405,36 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipeli
                                                        const VkGraphicsPipelineCreateInfo *pCreateInfos,
                                                        const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines) {
     layer_data *my_device_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    safe_VkGraphicsPipelineCreateInfo *local_pCreateInfos = NULL;
+    // Only the create infos and their stage arrays carry handles; all other state is passed through uncopied
+    ScratchArena scratch;
+    VkGraphicsPipelineCreateInfo *local_pCreateInfos = NULL;
     if (pCreateInfos) {
-        local_pCreateInfos = new safe_VkGraphicsPipelineCreateInfo[createInfoCount];
-        std::lock_guard<std::mutex> lock(global_lock);
+        local_pCreateInfos = scratch.Copy(pCreateInfos, createInfoCount);
+        if (!local_pCreateInfos) return VK_ERROR_OUT_OF_HOST_MEMORY;
         for (uint32_t idx0 = 0; idx0 < createInfoCount; ++idx0) {
-            local_pCreateInfos[idx0].initialize(&pCreateInfos[idx0]);
-            if (pCreateInfos[idx0].basePipelineHandle) {
-                local_pCreateInfos[idx0].basePipelineHandle =
-                    (VkPipeline)my_device_data
-                        ->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].basePipelineHandle)];
-            }
-            if (pCreateInfos[idx0].layout) {
-                local_pCreateInfos[idx0].layout =
-                    (VkPipelineLayout)
-                        my_device_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].layout)];
-            }
+            local_pCreateInfos[idx0].basePipelineHandle = Unwrap(pCreateInfos[idx0].basePipelineHandle);
+            local_pCreateInfos[idx0].layout = Unwrap(pCreateInfos[idx0].layout);
             if (pCreateInfos[idx0].pStages) {
+                VkPipelineShaderStageCreateInfo *local_pStages =
+                    scratch.Copy(pCreateInfos[idx0].pStages, pCreateInfos[idx0].stageCount);
+                if (!local_pStages) return VK_ERROR_OUT_OF_HOST_MEMORY;
                 for (uint32_t idx1 = 0; idx1 < pCreateInfos[idx0].stageCount; ++idx1) {
-                    if (pCreateInfos[idx0].pStages[idx1].module) {
-                        local_pCreateInfos[idx0].pStages[idx1].module =
-                            (VkShaderModule)my_device_data
-                                ->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].pStages[idx1].module)];
-                    }
+                    local_pStages[idx1].module = Unwrap(pCreateInfos[idx0].pStages[idx1].module);
                 }
+                local_pCreateInfos[idx0].pStages = local_pStages;
             }
-            if (pCreateInfos[idx0].renderPass) {
-                local_pCreateInfos[idx0].renderPass =
-                    (VkRenderPass)
-                        my_device_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].renderPass)];
-            }
+            local_pCreateInfos[idx0].renderPass = Unwrap(pCreateInfos[idx0].renderPass);
         }
     }
     if (pipelineCache) {
-        std::lock_guard<std::mutex> lock(global_lock);
-        pipelineCache = (VkPipelineCache)my_device_data->unique_id_mapping[reinterpret_cast<uint64_t &>(pipelineCache)];
+        pipelineCache = Unwrap(pipelineCache);
     }
 
     VkResult result = my_device_data->device_dispatch_table->CreateGraphicsPipelines(
-        device, pipelineCache, createInfoCount, (const VkGraphicsPipelineCreateInfo *)local_pCreateInfos, pAllocator, pPipelines);
-    delete[] local_pCreateInfos;
-    {
-        uint64_t unique_id = 0;
-        std::lock_guard<std::mutex> lock(global_lock);
-        for (uint32_t i = 0; i < createInfoCount; ++i) {
-            if (pPipelines[i] != VK_NULL_HANDLE) {
-                unique_id = global_unique_id++;
-                my_device_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(pPipelines[i]);
-                pPipelines[i] = reinterpret_cast<VkPipeline &>(unique_id);
-            }
+        device, pipelineCache, createInfoCount, local_pCreateInfos, pAllocator, pPipelines);
+    for (uint32_t i = 0; i < createInfoCount; ++i) {
+        if (pPipelines[i] != VK_NULL_HANDLE) {
+            pPipelines[i] = WrapNew(my_device_data, pPipelines[i]);
         }
     }
     return result;
@@ -497,28 +472,18 @@ VKAPI_ATTR void VKAPI_CALL DebugReportMessageEXT(VkInstance instance, VkDebugRep
 VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR *pCreateInfo,
                                                   const VkAllocationCallbacks *pAllocator, VkSwapchainKHR *pSwapchain) {
     layer_data *my_map_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    safe_VkSwapchainCreateInfoKHR *local_pCreateInfo = NULL;
+    ScratchArena scratch;
+    VkSwapchainCreateInfoKHR *local_pCreateInfo = NULL;
     if (pCreateInfo) {
-        std::lock_guard<std::mutex> lock(global_lock);
-        local_pCreateInfo = new safe_VkSwapchainCreateInfoKHR(pCreateInfo);
-        local_pCreateInfo->oldSwapchain =
-            (VkSwapchainKHR)my_map_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfo->oldSwapchain)];
-        // Need to pull surface mapping from the instance-level map
-        layer_data *instance_data = GetLayerDataPtr(get_dispatch_key(my_map_data->gpu), layer_data_map);
-        local_pCreateInfo->surface =
-            (VkSurfaceKHR)instance_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfo->surface)];
+        local_pCreateInfo = scratch.Copy(pCreateInfo, 1);
+        if (!local_pCreateInfo) return VK_ERROR_OUT_OF_HOST_MEMORY;
+        local_pCreateInfo->oldSwapchain = Unwrap(pCreateInfo->oldSwapchain);
+        local_pCreateInfo->surface = Unwrap(pCreateInfo->surface);
     }
 
-    VkResult result = my_map_data->device_dispatch_table->CreateSwapchainKHR(
-        device, (const VkSwapchainCreateInfoKHR *)local_pCreateInfo, pAllocator, pSwapchain);
-    if (local_pCreateInfo) {
-        delete local_pCreateInfo;
-    }
+    VkResult result = my_map_data->device_dispatch_table->CreateSwapchainKHR(device, local_pCreateInfo, pAllocator, pSwapchain);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
-        uint64_t unique_id = global_unique_id++;
-        my_map_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(*pSwapchain);
-        *pSwapchain = reinterpret_cast<VkSwapchainKHR &>(unique_id);
+        *pSwapchain = WrapNew(my_map_data, *pSwapchain);
     }
     return result;
 }
@@ -527,36 +492,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSharedSwapchainsKHR(VkDevice device, uint32
                                                          const VkSwapchainCreateInfoKHR *pCreateInfos,
                                                          const VkAllocationCallbacks *pAllocator, VkSwapchainKHR *pSwapchains) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    safe_VkSwapchainCreateInfoKHR *local_pCreateInfos = NULL;
-    {
-        std::lock_guard<std::mutex> lock(global_lock);
-        if (pCreateInfos) {
-            // Need to pull surface mapping from the instance-level map
-            layer_data *instance_data = GetLayerDataPtr(get_dispatch_key(dev_data->gpu), layer_data_map);
-            local_pCreateInfos = new safe_VkSwapchainCreateInfoKHR[swapchainCount];
-            for (uint32_t i = 0; i < swapchainCount; ++i) {
-                local_pCreateInfos[i].initialize(&pCreateInfos[i]);
-                if (pCreateInfos[i].surface) {
-                    local_pCreateInfos[i].surface =
-                        (VkSurfaceKHR)instance_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfos[i].surface)];
-                }
-                if (pCreateInfos[i].oldSwapchain) {
-                    local_pCreateInfos[i].oldSwapchain =
-                        (VkSwapchainKHR)
-                            dev_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfos[i].oldSwapchain)];
-                }
-            }
+    ScratchArena scratch;
+    VkSwapchainCreateInfoKHR *local_pCreateInfos = NULL;
+    if (pCreateInfos) {
+        local_pCreateInfos = scratch.Copy(pCreateInfos, swapchainCount);
+        if (!local_pCreateInfos) return VK_ERROR_OUT_OF_HOST_MEMORY;
+        for (uint32_t i = 0; i < swapchainCount; ++i) {
+            local_pCreateInfos[i].surface = Unwrap(pCreateInfos[i].surface);
+            local_pCreateInfos[i].oldSwapchain = Unwrap(pCreateInfos[i].oldSwapchain);
         }
     }
-    VkResult result = dev_data->device_dispatch_table->CreateSharedSwapchainsKHR(
-        device, swapchainCount, (const VkSwapchainCreateInfoKHR *)local_pCreateInfos, pAllocator, pSwapchains);
-    if (local_pCreateInfos) delete[] local_pCreateInfos;
+    VkResult result = dev_data->device_dispatch_table->CreateSharedSwapchainsKHR(device, swapchainCount, local_pCreateInfos,
+                                                                                 pAllocator, pSwapchains);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
         for (uint32_t i = 0; i < swapchainCount; i++) {
-            uint64_t unique_id = global_unique_id++;
-            dev_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(pSwapchains[i]);
-            pSwapchains[i] = reinterpret_cast<VkSwapchainKHR &>(unique_id);
+            pSwapchains[i] = WrapNew(dev_data, pSwapchains[i]);
         }
     }
     return result;
@@ -565,94 +515,192 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSharedSwapchainsKHR(VkDevice device, uint32
 VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t *pSwapchainImageCount,
                                                      VkImage *pSwapchainImages) {
     layer_data *my_device_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    VkSwapchainKHR wrapped_swapchain_handle = swapchain;
     if (VK_NULL_HANDLE != swapchain) {
-        std::lock_guard<std::mutex> lock(global_lock);
-        swapchain = (VkSwapchainKHR)my_device_data->unique_id_mapping[reinterpret_cast<uint64_t &>(swapchain)];
+        swapchain = Unwrap(swapchain);
     }
     VkResult result =
         my_device_data->device_dispatch_table->GetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
-    // TODO : Need to add corresponding code to delete these images
-    if (VK_SUCCESS == result) {
+    if ((VK_SUCCESS == result) || (VK_INCOMPLETE == result)) {
         if ((*pSwapchainImageCount > 0) && pSwapchainImages) {
-            uint64_t unique_id = 0;
+            // A swapchain's images never change, so each one is wrapped the first time it is returned and the same ID is
+            // handed out on later calls. The IDs are released with the swapchain.
             std::lock_guard<std::mutex> lock(global_lock);
+            auto &wrapped_swapchain_image_handles =
+                my_device_data->swapchain_wrapped_image_handle_map[reinterpret_cast<uint64_t &>(wrapped_swapchain_handle)];
+            if (wrapped_swapchain_image_handles.size() < *pSwapchainImageCount) {
+                wrapped_swapchain_image_handles.resize(*pSwapchainImageCount, VK_NULL_HANDLE);
+            }
             for (uint32_t i = 0; i < *pSwapchainImageCount; ++i) {
-                unique_id = global_unique_id++;
-                my_device_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(pSwapchainImages[i]);
-                pSwapchainImages[i] = reinterpret_cast<VkImage &>(unique_id);
+                if (wrapped_swapchain_image_handles[i] == VK_NULL_HANDLE) {
+                    wrapped_swapchain_image_handles[i] = WrapNew(my_device_data, pSwapchainImages[i]);
+                }
+                pSwapchainImages[i] = wrapped_swapchain_image_handles[i];
             }
         }
     }
     return result;
 }
 
+VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks *pAllocator) {
+    layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    std::unique_lock<std::mutex> lock(global_lock);
+    auto image_map_iter = dev_data->swapchain_wrapped_image_handle_map.find(reinterpret_cast<uint64_t &>(swapchain));
+    if (image_map_iter != dev_data->swapchain_wrapped_image_handle_map.end()) {
+        for (auto image : image_map_iter->second) {
+            UnwrapAndRelease(image);
+        }
+        dev_data->swapchain_wrapped_image_handle_map.erase(image_map_iter);
+    }
+    lock.unlock();
+    swapchain = UnwrapAndRelease(swapchain);
+    dev_data->device_dispatch_table->DestroySwapchainKHR(device, swapchain, pAllocator);
+}
+
 VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
-    safe_VkPresentInfoKHR *local_pPresentInfo = NULL;
-    {
-        std::lock_guard<std::mutex> lock(global_lock);
-        if (pPresentInfo) {
-            local_pPresentInfo = new safe_VkPresentInfoKHR(pPresentInfo);
-            if (local_pPresentInfo->pWaitSemaphores) {
-                for (uint32_t index1 = 0; index1 < local_pPresentInfo->waitSemaphoreCount; ++index1) {
-                    local_pPresentInfo->pWaitSemaphores[index1] =
-                        (VkSemaphore)dev_data
-                            ->unique_id_mapping[reinterpret_cast<const uint64_t &>(local_pPresentInfo->pWaitSemaphores[index1])];
-                }
+    // The shallow copy keeps pResults pointing at the application's array, so results land there directly
+    ScratchArena scratch;
+    VkPresentInfoKHR *local_pPresentInfo = NULL;
+    if (pPresentInfo) {
+        local_pPresentInfo = scratch.Copy(pPresentInfo, 1);
+        if (!local_pPresentInfo) return VK_ERROR_OUT_OF_HOST_MEMORY;
+        if (pPresentInfo->pWaitSemaphores) {
+            VkSemaphore *local_pWaitSemaphores = scratch.Copy(pPresentInfo->pWaitSemaphores, pPresentInfo->waitSemaphoreCount);
+            if (!local_pWaitSemaphores) return VK_ERROR_OUT_OF_HOST_MEMORY;
+            for (uint32_t index1 = 0; index1 < pPresentInfo->waitSemaphoreCount; ++index1) {
+                local_pWaitSemaphores[index1] = Unwrap(local_pWaitSemaphores[index1]);
             }
-            if (local_pPresentInfo->pSwapchains) {
-                for (uint32_t index1 = 0; index1 < local_pPresentInfo->swapchainCount; ++index1) {
-                    local_pPresentInfo->pSwapchains[index1] =
-                        (VkSwapchainKHR)dev_data
-                            ->unique_id_mapping[reinterpret_cast<const uint64_t &>(local_pPresentInfo->pSwapchains[index1])];
-                }
+            local_pPresentInfo->pWaitSemaphores = local_pWaitSemaphores;
+        }
+        if (pPresentInfo->pSwapchains) {
+            VkSwapchainKHR *local_pSwapchains = scratch.Copy(pPresentInfo->pSwapchains, pPresentInfo->swapchainCount);
+            if (!local_pSwapchains) return VK_ERROR_OUT_OF_HOST_MEMORY;
+            for (uint32_t index1 = 0; index1 < pPresentInfo->swapchainCount; ++index1) {
+                local_pSwapchains[index1] = Unwrap(local_pSwapchains[index1]);
+            }
+            local_pPresentInfo->pSwapchains = local_pSwapchains;
+        }
+    }
+    VkResult result = dev_data->device_dispatch_table->QueuePresentKHR(queue, local_pPresentInfo);
+    return result;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo *pAllocateInfo,
+                                                      VkDescriptorSet *pDescriptorSets) {
+    layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    ScratchArena scratch;
+    VkDescriptorSetAllocateInfo *local_pAllocateInfo = NULL;
+    if (pAllocateInfo) {
+        local_pAllocateInfo = scratch.Copy(pAllocateInfo, 1);
+        if (!local_pAllocateInfo) return VK_ERROR_OUT_OF_HOST_MEMORY;
+        local_pAllocateInfo->descriptorPool = Unwrap(pAllocateInfo->descriptorPool);
+        if (pAllocateInfo->pSetLayouts) {
+            VkDescriptorSetLayout *local_pSetLayouts = scratch.Copy(pAllocateInfo->pSetLayouts, pAllocateInfo->descriptorSetCount);
+            if (!local_pSetLayouts) return VK_ERROR_OUT_OF_HOST_MEMORY;
+            for (uint32_t index1 = 0; index1 < pAllocateInfo->descriptorSetCount; ++index1) {
+                local_pSetLayouts[index1] = Unwrap(local_pSetLayouts[index1]);
             }
+            local_pAllocateInfo->pSetLayouts = local_pSetLayouts;
+        }
+    }
+    VkResult result = dev_data->device_dispatch_table->AllocateDescriptorSets(device, local_pAllocateInfo, pDescriptorSets);
+    if (VK_SUCCESS == result) {
+        // Remember which pool each set came from, so resetting or destroying the pool releases its sets' IDs
+        std::lock_guard<std::mutex> lock(global_lock);
+        auto &pool_descriptor_sets =
+            dev_data->pool_descriptor_sets_map[reinterpret_cast<const uint64_t &>(pAllocateInfo->descriptorPool)];
+        for (uint32_t index0 = 0; index0 < pAllocateInfo->descriptorSetCount; index0++) {
+            pDescriptorSets[index0] = WrapNew(dev_data, pDescriptorSets[index0]);
+            pool_descriptor_sets.insert(reinterpret_cast<uint64_t &>(pDescriptorSets[index0]));
         }
     }
-    VkResult result = dev_data->device_dispatch_table->QueuePresentKHR(queue, (const VkPresentInfoKHR *)local_pPresentInfo);
+    return result;
+}
 
-    // pResults is an output array embedded in a structure. The code generator neglects to copy back from the safe_* version,
-    // so handle it as a special case here:
-    if (pPresentInfo && pPresentInfo->pResults) {
-        for (uint32_t i = 0; i < pPresentInfo->swapchainCount; i++) {
-            pPresentInfo->pResults[i] = local_pPresentInfo->pResults[i];
+VKAPI_ATTR VkResult VKAPI_CALL FreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount,
+                                                  const VkDescriptorSet *pDescriptorSets) {
+    layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    ScratchArena scratch;
+    VkDescriptorSet *local_pDescriptorSets = NULL;
+    VkDescriptorPool local_descriptor_pool = Unwrap(descriptorPool);
+    if (pDescriptorSets) {
+        local_pDescriptorSets = scratch.Copy(pDescriptorSets, descriptorSetCount);
+        if (!local_pDescriptorSets) return VK_ERROR_OUT_OF_HOST_MEMORY;
+        for (uint32_t index0 = 0; index0 < descriptorSetCount; ++index0) {
+            local_pDescriptorSets[index0] = Unwrap(local_pDescriptorSets[index0]);
+        }
+    }
+    VkResult result = dev_data->device_dispatch_table->FreeDescriptorSets(device, local_descriptor_pool, descriptorSetCount,
+                                                                          local_pDescriptorSets);
+    if ((VK_SUCCESS == result) && (pDescriptorSets)) {
+        std::lock_guard<std::mutex> lock(global_lock);
+        auto pool_iter = dev_data->pool_descriptor_sets_map.find(reinterpret_cast<uint64_t &>(descriptorPool));
+        for (uint32_t index0 = 0; index0 < descriptorSetCount; index0++) {
+            if (pool_iter != dev_data->pool_descriptor_sets_map.end()) {
+                pool_iter->second.erase(reinterpret_cast<const uint64_t &>(pDescriptorSets[index0]));
+            }
+            UnwrapAndRelease(pDescriptorSets[index0]);
         }
     }
+    return result;
+}
+
+// Release the IDs of every descriptor set allocated from a wrapped pool. Caller must hold global_lock.
+static void ReleasePoolDescriptorSets(layer_data *dev_data, VkDescriptorPool descriptorPool) {
+    auto pool_iter = dev_data->pool_descriptor_sets_map.find(reinterpret_cast<uint64_t &>(descriptorPool));
+    if (pool_iter == dev_data->pool_descriptor_sets_map.end()) return;
+    for (auto descriptor_set : pool_iter->second) {
+        unique_id_table.Remove(descriptor_set);
+    }
+    dev_data->pool_descriptor_sets_map.erase(pool_iter);
+}
 
-    if (local_pPresentInfo) delete local_pPresentInfo;
+VKAPI_ATTR VkResult VKAPI_CALL ResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
+                                                   VkDescriptorPoolResetFlags flags) {
+    layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    VkResult result = dev_data->device_dispatch_table->ResetDescriptorPool(device, Unwrap(descriptorPool), flags);
+    if (VK_SUCCESS == result) {
+        // Resetting a pool implicitly frees all of its descriptor sets
+        std::lock_guard<std::mutex> lock(global_lock);
+        ReleasePoolDescriptorSets(dev_data, descriptorPool);
+    }
     return result;
 }
 
+VKAPI_ATTR void VKAPI_CALL DestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
+                                                 const VkAllocationCallbacks *pAllocator) {
+    layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    std::unique_lock<std::mutex> lock(global_lock);
+    ReleasePoolDescriptorSets(dev_data, descriptorPool);
+    lock.unlock();
+    descriptorPool = UnwrapAndRelease(descriptorPool);
+    dev_data->device_dispatch_table->DestroyDescriptorPool(device, descriptorPool, pAllocator);
+}
+
 VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplateKHR(VkDevice device,
                                                                  const VkDescriptorUpdateTemplateCreateInfoKHR *pCreateInfo,
                                                                  const VkAllocationCallbacks *pAllocator,
                                                                  VkDescriptorUpdateTemplateKHR *pDescriptorUpdateTemplate) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     safe_VkDescriptorUpdateTemplateCreateInfoKHR *local_create_info = NULL;
-    {
-        std::lock_guard<std::mutex> lock(global_lock);
-        if (pCreateInfo) {
-            local_create_info = new safe_VkDescriptorUpdateTemplateCreateInfoKHR(pCreateInfo);
-            if (pCreateInfo->descriptorSetLayout) {
-                local_create_info->descriptorSetLayout =
-                    (VkDescriptorSetLayout)
-                        dev_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfo->descriptorSetLayout)];
-            }
-            if (pCreateInfo->pipelineLayout) {
-                local_create_info->pipelineLayout =
-                    (VkPipelineLayout)dev_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfo->pipelineLayout)];
-            }
+    if (pCreateInfo) {
+        local_create_info = new safe_VkDescriptorUpdateTemplateCreateInfoKHR(pCreateInfo);
+        if (pCreateInfo->descriptorSetLayout) {
+            local_create_info->descriptorSetLayout = Unwrap(pCreateInfo->descriptorSetLayout);
+        }
+        if (pCreateInfo->pipelineLayout) {
+            local_create_info->pipelineLayout = Unwrap(pCreateInfo->pipelineLayout);
         }
     }
     VkResult result = dev_data->device_dispatch_table->CreateDescriptorUpdateTemplateKHR(
         device, (const VkDescriptorUpdateTemplateCreateInfoKHR *)local_create_info, pAllocator, pDescriptorUpdateTemplate);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
-        uint64_t unique_id = global_unique_id++;
-        dev_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(*pDescriptorUpdateTemplate);
-        *pDescriptorUpdateTemplate = reinterpret_cast<VkDescriptorUpdateTemplateKHR &>(unique_id);
+        *pDescriptorUpdateTemplate = WrapNew(dev_data, *pDescriptorUpdateTemplate);
+        uint64_t unique_id = reinterpret_cast<uint64_t &>(*pDescriptorUpdateTemplate);
 
         // Shadow template createInfo for later updates
+        std::lock_guard<std::mutex> lock(global_lock);
         std::unique_ptr<TEMPLATE_STATE> template_state(new TEMPLATE_STATE(*pDescriptorUpdateTemplate, local_create_info));
         dev_data->desc_template_map[unique_id] = std::move(template_state);
     }
@@ -666,9 +714,8 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplateKHR(VkDevice device,
     std::unique_lock<std::mutex> lock(global_lock);
     uint64_t descriptor_update_template_id = reinterpret_cast<uint64_t &>(descriptorUpdateTemplate);
     dev_data->desc_template_map.erase(descriptor_update_template_id);
-    descriptorUpdateTemplate = (VkDescriptorUpdateTemplateKHR)dev_data->unique_id_mapping[descriptor_update_template_id];
-    dev_data->unique_id_mapping.erase(descriptor_update_template_id);
     lock.unlock();
+    descriptorUpdateTemplate = UnwrapAndRelease(descriptorUpdateTemplate);
     dev_data->device_dispatch_table->DestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
 }
 
@@ -696,10 +743,8 @@ void *BuildUnwrappedUpdateTemplateBuffer(layer_data *dev_data, uint64_t descript
                     allocation_size = std::max(allocation_size, offset + sizeof(VkDescriptorImageInfo));
 
                     VkDescriptorImageInfo *wrapped_entry = new VkDescriptorImageInfo(*image_entry);
-                    wrapped_entry->sampler = reinterpret_cast<VkSampler &>(
-                        dev_data->unique_id_mapping[reinterpret_cast<uint64_t &>(image_entry->sampler)]);
-                    wrapped_entry->imageView = reinterpret_cast<VkImageView &>(
-                        dev_data->unique_id_mapping[reinterpret_cast<uint64_t &>(image_entry->imageView)]);
+                    wrapped_entry->sampler = Unwrap(image_entry->sampler);
+                    wrapped_entry->imageView = Unwrap(image_entry->imageView);
                     template_entries.emplace_back(offset, kVulkanObjectTypeImage, reinterpret_cast<void *>(wrapped_entry));
                 } break;
 
@@ -711,8 +756,7 @@ void *BuildUnwrappedUpdateTemplateBuffer(layer_data *dev_data, uint64_t descript
                     allocation_size = std::max(allocation_size, offset + sizeof(VkDescriptorBufferInfo));
 
                     VkDescriptorBufferInfo *wrapped_entry = new VkDescriptorBufferInfo(*buffer_entry);
-                    wrapped_entry->buffer = reinterpret_cast<VkBuffer &>(
-                        dev_data->unique_id_mapping[reinterpret_cast<uint64_t &>(buffer_entry->buffer)]);
+                    wrapped_entry->buffer = Unwrap(buffer_entry->buffer);
                     template_entries.emplace_back(offset, kVulkanObjectTypeBuffer, reinterpret_cast<void *>(wrapped_entry));
                 } break;
 
@@ -721,7 +765,7 @@ void *BuildUnwrappedUpdateTemplateBuffer(layer_data *dev_data, uint64_t descript
                     auto buffer_view_handle = reinterpret_cast<uint64_t *>(update_entry);
                     allocation_size = std::max(allocation_size, offset + sizeof(VkBufferView));
 
-                    uint64_t wrapped_entry = dev_data->unique_id_mapping[reinterpret_cast<uint64_t &>(*buffer_view_handle)];
+                    uint64_t wrapped_entry = unique_id_table.Lookup(*buffer_view_handle);
                     template_entries.emplace_back(offset, kVulkanObjectTypeBufferView, reinterpret_cast<void *>(wrapped_entry));
                 } break;
                 default:
@@ -762,11 +806,8 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplateKHR(VkDevice device, V
                                                               const void *pData) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     uint64_t template_handle = reinterpret_cast<uint64_t &>(descriptorUpdateTemplate);
-    {
-        std::lock_guard<std::mutex> lock(global_lock);
-        descriptorSet = (VkDescriptorSet)dev_data->unique_id_mapping[reinterpret_cast<uint64_t &>(descriptorSet)];
-        descriptorUpdateTemplate = (VkDescriptorUpdateTemplateKHR)dev_data->unique_id_mapping[template_handle];
-    }
+    descriptorSet = Unwrap(descriptorSet);
+    descriptorUpdateTemplate = Unwrap(descriptorUpdateTemplate);
     void *unwrapped_buffer = BuildUnwrappedUpdateTemplateBuffer(dev_data, template_handle, pData);
     dev_data->device_dispatch_table->UpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate,
                                                                         unwrapped_buffer);
@@ -778,11 +819,8 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer c
                                                                VkPipelineLayout layout, uint32_t set, const void *pData) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     uint64_t template_handle = reinterpret_cast<uint64_t &>(descriptorUpdateTemplate);
-    {
-        std::lock_guard<std::mutex> lock(global_lock);
-        descriptorUpdateTemplate = (VkDescriptorUpdateTemplateKHR)dev_data->unique_id_mapping[template_handle];
-        layout = (VkPipelineLayout)dev_data->unique_id_mapping[reinterpret_cast<uint64_t &>(layout)];
-    }
+    descriptorUpdateTemplate = Unwrap(descriptorUpdateTemplate);
+    layout = Unwrap(layout);
     void *unwrapped_buffer = BuildUnwrappedUpdateTemplateBuffer(dev_data, template_handle, pData);
     dev_data->device_dispatch_table->CmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set,
                                                                          unwrapped_buffer);
@@ -794,16 +832,12 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPropertiesKHR(VkPhysicalD
                                                                      VkDisplayPropertiesKHR *pProperties) {
     layer_data *my_map_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     safe_VkDisplayPropertiesKHR *local_pProperties = NULL;
-    {
-        std::lock_guard<std::mutex> lock(global_lock);
-        if (pProperties) {
-            local_pProperties = new safe_VkDisplayPropertiesKHR[*pPropertyCount];
-            for (uint32_t idx0 = 0; idx0 < *pPropertyCount; ++idx0) {
-                local_pProperties[idx0].initialize(&pProperties[idx0]);
-                if (pProperties[idx0].display) {
-                    local_pProperties[idx0].display =
-                        (VkDisplayKHR)my_map_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(pProperties[idx0].display)];
-                }
+    if (pProperties) {
+        local_pProperties = new safe_VkDisplayPropertiesKHR[*pPropertyCount];
+        for (uint32_t idx0 = 0; idx0 < *pPropertyCount; ++idx0) {
+            local_pProperties[idx0].initialize(&pProperties[idx0]);
+            if (pProperties[idx0].display) {
+                local_pProperties[idx0].display = Unwrap(pProperties[idx0].display);
             }
         }
     }
@@ -812,11 +846,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPropertiesKHR(VkPhysicalD
         physicalDevice, pPropertyCount, (VkDisplayPropertiesKHR *)local_pProperties);
     if (result == VK_SUCCESS && pProperties) {
         for (uint32_t idx0 = 0; idx0 < *pPropertyCount; ++idx0) {
-            std::lock_guard<std::mutex> lock(global_lock);
-
-            uint64_t unique_id = global_unique_id++;
-            my_map_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(local_pProperties[idx0].display);
-            pProperties[idx0].display = reinterpret_cast<VkDisplayKHR &>(unique_id);
+            pProperties[idx0].display = WrapNew(my_map_data, local_pProperties[idx0].display);
             pProperties[idx0].displayName = local_pProperties[idx0].displayName;
             pProperties[idx0].physicalDimensions = local_pProperties[idx0].physicalDimensions;
             pProperties[idx0].physicalResolution = local_pProperties[idx0].physicalResolution;
@@ -838,11 +868,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneSupportedDisplaysKHR(VkPhysicalDev
                                                                                                 pDisplayCount, pDisplays);
     if (VK_SUCCESS == result) {
         if ((*pDisplayCount > 0) && pDisplays) {
-            std::lock_guard<std::mutex> lock(global_lock);
             for (uint32_t i = 0; i < *pDisplayCount; i++) {
-                auto it = my_map_data->unique_id_mapping.find(reinterpret_cast<const uint64_t &>(pDisplays[i]));
-                assert(it != my_map_data->unique_id_mapping.end());
-                pDisplays[i] = reinterpret_cast<VkDisplayKHR &>(it->second);
+                pDisplays[i] = Unwrap(pDisplays[i]);
+                assert(pDisplays[i] != VK_NULL_HANDLE);
             }
         }
     }
@@ -853,23 +881,16 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayModePropertiesKHR(VkPhysicalDevice phys
                                                            uint32_t *pPropertyCount, VkDisplayModePropertiesKHR *pProperties) {
     layer_data *my_map_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     VkDisplayModePropertiesKHR *local_pProperties = NULL;
-    {
-        std::lock_guard<std::mutex> lock(global_lock);
-        display = (VkDisplayKHR)my_map_data->unique_id_mapping[reinterpret_cast<uint64_t &>(display)];
-        if (pProperties) {
-            local_pProperties = new VkDisplayModePropertiesKHR[*pPropertyCount];
-        }
+    display = Unwrap(display);
+    if (pProperties) {
+        local_pProperties = new VkDisplayModePropertiesKHR[*pPropertyCount];
     }
 
     VkResult result = my_map_data->instance_dispatch_table->GetDisplayModePropertiesKHR(
         physicalDevice, display, pPropertyCount, (VkDisplayModePropertiesKHR *)local_pProperties);
     if (result == VK_SUCCESS && pProperties) {
         for (uint32_t idx0 = 0; idx0 < *pPropertyCount; ++idx0) {
-            std::lock_guard<std::mutex> lock(global_lock);
-
-            uint64_t unique_id = global_unique_id++;
-            my_map_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(local_pProperties[idx0].displayMode);
-            pProperties[idx0].displayMode = reinterpret_cast<VkDisplayModeKHR &>(unique_id);
+            pProperties[idx0].displayMode = WrapNew(my_map_data, local_pProperties[idx0].displayMode);
             pProperties[idx0].parameters.visibleRegion.width = local_pProperties[idx0].parameters.visibleRegion.width;
             pProperties[idx0].parameters.visibleRegion.height = local_pProperties[idx0].parameters.visibleRegion.height;
             pProperties[idx0].parameters.refreshRate = local_pProperties[idx0].parameters.refreshRate;
@@ -884,17 +905,11 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayModePropertiesKHR(VkPhysicalDevice phys
 VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkDisplayModeKHR mode,
                                                               uint32_t planeIndex, VkDisplayPlaneCapabilitiesKHR *pCapabilities) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
-    {
-        std::lock_guard<std::mutex> lock(global_lock);
-        auto it = dev_data->unique_id_mapping.find(reinterpret_cast<uint64_t &>(mode));
-        if (it == dev_data->unique_id_mapping.end()) {
-            uint64_t unique_id = global_unique_id++;
-            dev_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(mode);
-
-            mode = reinterpret_cast<VkDisplayModeKHR &>(unique_id);
-        } else {
-            mode = reinterpret_cast<VkDisplayModeKHR &>(it->second);
-        }
+    VkDisplayModeKHR unwrapped_mode = Unwrap(mode);
+    if (unwrapped_mode == VK_NULL_HANDLE) {
+        mode = WrapNew(dev_data, mode);
+    } else {
+        mode = unwrapped_mode;
     }
     VkResult result =
         dev_data->instance_dispatch_table->GetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
@@ -905,12 +920,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneCapabilitiesKHR(VkPhysicalDevice p
 VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectTagEXT(VkDevice device, VkDebugMarkerObjectTagInfoEXT *pTagInfo) {
     layer_data *device_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     auto local_tag_info = new safe_VkDebugMarkerObjectTagInfoEXT(pTagInfo);
-    {
-        std::lock_guard<std::mutex> lock(global_lock);
-        auto it = device_data->unique_id_mapping.find(reinterpret_cast<uint64_t &>(local_tag_info->object));
-        if (it != device_data->unique_id_mapping.end()) {
-            local_tag_info->object = it->second;
-        }
+    uint64_t unwrapped_object = unique_id_table.Lookup(local_tag_info->object);
+    if (unwrapped_object) {
+        local_tag_info->object = unwrapped_object;
     }
     VkResult result = device_data->device_dispatch_table->DebugMarkerSetObjectTagEXT(
         device, reinterpret_cast<VkDebugMarkerObjectTagInfoEXT *>(local_tag_info));
@@ -920,12 +932,9 @@ VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectTagEXT(VkDevice device, VkDeb
 VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectNameEXT(VkDevice device, VkDebugMarkerObjectNameInfoEXT *pNameInfo) {
     layer_data *device_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     auto local_name_info = new safe_VkDebugMarkerObjectNameInfoEXT(pNameInfo);
-    {
-        std::lock_guard<std::mutex> lock(global_lock);
-        auto it = device_data->unique_id_mapping.find(reinterpret_cast<uint64_t &>(local_name_info->object));
-        if (it != device_data->unique_id_mapping.end()) {
-            local_name_info->object = it->second;
-        }
+    uint64_t unwrapped_object = unique_id_table.Lookup(local_name_info->object);
+    if (unwrapped_object) {
+        local_name_info->object = unwrapped_object;
     }
     VkResult result = device_data->device_dispatch_table->DebugMarkerSetObjectNameEXT(
         device, reinterpret_cast<VkDebugMarkerObjectNameInfoEXT *>(local_name_info));
@@ -24,14 +24,185 @@
 #include "vk_layer_data.h"
 #include "vk_safe_struct.h"
 #include "vk_layer_utils.h"
+#include "vk_layer_logging.h"
+#include "vk_validation_error_messages.h"
 #include "mutex"
 
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_set>
+#include <vector>
+
 #pragma once
 
 namespace unique_objects {
 
-// All increments must be guarded by global_lock
-static uint64_t global_unique_id = 1;
+// Maps unique IDs handed to the application back to driver handles. A unique ID is one plus an index into a slot table
+// of fixed-size chunks reached through a two-level directory, so unwrapping is three dependent loads with no lock and no
+// hashing. Directories and chunks are allocated on first use and never freed while the layer is loaded, letting the table
+// grow to the full 32-bit index space. Released slots are recycled through a lock-free free list whose head carries an ABA
+// tag in its upper 32 bits. Each live slot also records the instance or device that created it, so whatever an owner
+// still holds when it is destroyed can be released in one sweep.
+class UniqueIdTable {
+   public:
+    UniqueIdTable() : high_water_(0), free_head_(0) {
+        for (uint32_t i = 0; i < kDirectoryCount; ++i) directories_[i].store(nullptr, std::memory_order_relaxed);
+    }
+    ~UniqueIdTable() {
+        for (uint32_t i = 0; i < kDirectoryCount; ++i) {
+            Directory *directory = directories_[i].load(std::memory_order_relaxed);
+            if (!directory) continue;
+            for (uint32_t j = 0; j < kDirectorySize; ++j) delete[] directory->chunks[j].load(std::memory_order_relaxed);
+            delete directory;
+        }
+    }
+
+    // Store handle for owner in a free slot and return its unique ID, or 0 once all 2^32 - 1 IDs are live
+    uint64_t Insert(uint64_t handle, uint32_t owner) {
+        uint32_t index = PopFree();
+        if (index == kNoIndex) {
+            index = high_water_.load(std::memory_order_relaxed);
+            do {
+                if (index == kNoIndex) return 0;
+            } while (!high_water_.compare_exchange_weak(index, index + 1, std::memory_order_relaxed));
+        }
+        Slot *slot = GetSlot(index);
+        // The owner is written before the handle is published, and cleared before the slot is freed, so a sweep that sees
+        // its own owner on a slot with a live handle is looking at one of its own IDs
+        slot->owner.store(owner, std::memory_order_relaxed);
+        slot->handle.store(handle, std::memory_order_release);
+        return uint64_t(index) + 1;
+    }
+
+    // Return the handle stored for unique_id, or 0 for VK_NULL_HANDLE and IDs that are not live
+    uint64_t Lookup(uint64_t unique_id) const {
+        Slot const *slot = FindSlot(unique_id);
+        return slot ? slot->handle.load(std::memory_order_acquire) : 0;
+    }
+
+    // Release unique_id and return the handle it referred to, or 0 if it was not live
+    uint64_t Remove(uint64_t unique_id) {
+        Slot *slot = FindSlot(unique_id);
+        return slot ? Release(uint32_t(unique_id - 1), slot) : 0;
+    }
+
+    // Release every live ID created by owner. Only call this once the owner's objects can no longer be used.
+    void RemoveOwner(uint32_t owner) {
+        uint32_t count = high_water_.load(std::memory_order_acquire);
+        for (uint32_t index = 0; index < count; index += kChunkSize) {
+            Slot *chunk = FindChunk(index);
+            if (!chunk) continue;
+            for (uint32_t i = 0; i < kChunkSize; ++i) {
+                if (chunk[i].owner.load(std::memory_order_relaxed) == owner) Release(index + i, &chunk[i]);
+            }
+        }
+    }
+
+   private:
+    static const uint32_t kChunkBits = 12;
+    static const uint32_t kChunkSize = 1u << kChunkBits;
+    static const uint32_t kDirectoryBits = 10;
+    static const uint32_t kDirectorySize = 1u << kDirectoryBits;
+    static const uint32_t kDirectoryCount = 1u << (32 - kChunkBits - kDirectoryBits);
+    static const uint32_t kNoIndex = 0xFFFFFFFF;
+
+    struct Slot {
+        std::atomic<uint64_t> handle;
+        std::atomic<uint32_t> next_free;  // free list link, stored as index + 1 (0 ends the list)
+        std::atomic<uint32_t> owner;      // owner tag of the live handle, 0 while the slot is free
+    };
+
+    struct Directory {
+        std::atomic<Slot *> chunks[kDirectorySize];
+    };
+
+    Slot *FindChunk(uint32_t index) const {
+        Directory *directory = directories_[index >> (kChunkBits + kDirectoryBits)].load(std::memory_order_acquire);
+        return directory ? directory->chunks[(index >> kChunkBits) & (kDirectorySize - 1)].load(std::memory_order_acquire)
+                         : nullptr;
+    }
+
+    Slot *FindSlot(uint64_t unique_id) const {
+        if (unique_id == 0 || unique_id > kNoIndex) return nullptr;
+        uint32_t index = uint32_t(unique_id - 1);
+        Slot *chunk = FindChunk(index);
+        return chunk ? &chunk[index & (kChunkSize - 1)] : nullptr;
+    }
+
+    // Publish value in target unless another thread got there first, and return whichever is there
+    template <typename T>
+    static T *Publish(std::atomic<T *> &target, T *value) {
+        T *expected = nullptr;
+        if (target.compare_exchange_strong(expected, value, std::memory_order_acq_rel)) return value;
+        return expected;
+    }
+
+    Slot *GetSlot(uint32_t index) {
+        auto &directory_ptr = directories_[index >> (kChunkBits + kDirectoryBits)];
+        Directory *directory = directory_ptr.load(std::memory_order_acquire);
+        if (!directory) {
+            Directory *new_directory = new Directory;
+            for (uint32_t i = 0; i < kDirectorySize; ++i) new_directory->chunks[i].store(nullptr, std::memory_order_relaxed);
+            directory = Publish(directory_ptr, new_directory);
+            if (directory != new_directory) delete new_directory;  // Another thread published this directory first
+        }
+        auto &chunk_ptr = directory->chunks[(index >> kChunkBits) & (kDirectorySize - 1)];
+        Slot *chunk = chunk_ptr.load(std::memory_order_acquire);
+        if (!chunk) {
+            Slot *new_chunk = new Slot[kChunkSize];
+            for (uint32_t i = 0; i < kChunkSize; ++i) {
+                new_chunk[i].handle.store(0, std::memory_order_relaxed);
+                new_chunk[i].next_free.store(0, std::memory_order_relaxed);
+                new_chunk[i].owner.store(0, std::memory_order_relaxed);
+            }
+            chunk = Publish(chunk_ptr, new_chunk);
+            if (chunk != new_chunk) delete[] new_chunk;  // Another thread published this chunk first
+        }
+        return &chunk[index & (kChunkSize - 1)];
+    }
+
+    uint64_t Release(uint32_t index, Slot *slot) {
+        uint64_t handle = slot->handle.exchange(0, std::memory_order_acq_rel);
+        if (handle) {
+            slot->owner.store(0, std::memory_order_relaxed);
+            PushFree(index, slot);
+        }
+        return handle;
+    }
+
+    uint32_t PopFree() {
+        uint64_t head = free_head_.load(std::memory_order_acquire);
+        while (uint32_t(head) != 0) {
+            uint32_t index = uint32_t(head) - 1;
+            uint64_t next = ((head >> 32) + 1) << 32 | FindSlot(uint64_t(index) + 1)->next_free.load(std::memory_order_relaxed);
+            if (free_head_.compare_exchange_weak(head, next, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return index;
+            }
+        }
+        return kNoIndex;
+    }
+
+    void PushFree(uint32_t index, Slot *slot) {
+        uint64_t head = free_head_.load(std::memory_order_relaxed);
+        uint64_t next;
+        do {
+            slot->next_free.store(uint32_t(head), std::memory_order_relaxed);
+            next = ((head >> 32) + 1) << 32 | (uint64_t(index) + 1);
+        } while (!free_head_.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    std::atomic<Directory *> directories_[kDirectoryCount];
+    std::atomic<uint32_t> high_water_;  // Slots handed out so far that have never been on the free list
+    std::atomic<uint64_t> free_head_;   // ABA tag in the upper 32 bits, free slot index + 1 in the lower 32 bits
+};
+
+// Unique IDs are process-wide so that handles from different devices never collide
+static UniqueIdTable unique_id_table;
+
+// Owner tags for UniqueIdTable, one per instance and device layer_data; 0 marks a free slot
+static std::atomic<uint32_t> next_owner_id(1);
 
 struct TEMPLATE_STATE {
     VkDescriptorUpdateTemplateKHR desc_update_template;
@@ -57,11 +228,20 @@ struct layer_data {
 
     std::unordered_map<uint64_t, std::unique_ptr<TEMPLATE_STATE>> desc_template_map;
 
+    // Wrapped descriptor sets allocated from each wrapped descriptor pool, released when the pool is reset or destroyed
+    std::unordered_map<uint64_t, std::unordered_set<uint64_t>> pool_descriptor_sets_map;
+    // Wrapped images of each wrapped swapchain, handed out again by every vkGetSwapchainImagesKHR call
+    std::unordered_map<uint64_t, std::vector<VkImage>> swapchain_wrapped_image_handle_map;
+
     bool wsi_enabled;
-    std::unordered_map<uint64_t, uint64_t> unique_id_mapping;  // Map uniqueID to actual object handle
     VkPhysicalDevice gpu;
+    uint32_t owner_id;  // Tags the unique IDs created through this instance or device
 
-    layer_data() : wsi_enabled(false), gpu(VK_NULL_HANDLE){};
+    layer_data() : wsi_enabled(false), gpu(VK_NULL_HANDLE) {
+        do {
+            owner_id = next_owner_id.fetch_add(1, std::memory_order_relaxed);
+        } while (owner_id == 0);
+    };
 };
 
 struct instance_extension_enables {
@@ -76,15 +256,139 @@ struct instance_extension_enables {
 };
 
 static std::unordered_map<void *, struct instance_extension_enables> instance_ext_map;
-static std::unordered_map<void *, layer_data *> layer_data_map;
+static LayerDataMap<layer_data> layer_data_map;
+
+// Protect desc_template_map, pool_descriptor_sets_map, swapchain_wrapped_image_handle_map and instance_ext_map accesses
+static std::mutex global_lock;
 
-static std::mutex global_lock;  // Protect map accesses and unique_id increments
+// Wrap a newly created handle for the instance or device behind owner_data, returning the unique ID handed to the
+// application
+template <typename HandleType>
+HandleType WrapNew(layer_data *owner_data, HandleType new_handle) {
+    uint64_t unique_id = unique_id_table.Insert(reinterpret_cast<uint64_t &>(new_handle), owner_data->owner_id);
+    if (unique_id == 0 && new_handle != VK_NULL_HANDLE) {
+        log_msg(owner_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT,
+                reinterpret_cast<uint64_t &>(new_handle), __LINE__, VALIDATION_ERROR_UNDEFINED, "UniqueObjects",
+                "Every unique object ID is in use; the new object is returned as VK_NULL_HANDLE.");
+    }
+    return reinterpret_cast<HandleType &>(unique_id);
+}
+
+// Return the driver handle for a wrapped handle
+template <typename HandleType>
+HandleType Unwrap(HandleType wrapped_handle) {
+    uint64_t handle = unique_id_table.Lookup(reinterpret_cast<uint64_t &>(wrapped_handle));
+    return reinterpret_cast<HandleType &>(handle);
+}
+
+// Release a wrapped handle that is being destroyed, returning its driver handle
+template <typename HandleType>
+HandleType UnwrapAndRelease(HandleType wrapped_handle) {
+    uint64_t handle = unique_id_table.Remove(reinterpret_cast<uint64_t &>(wrapped_handle));
+    return reinterpret_cast<HandleType &>(handle);
+}
 
 struct GenericHeader {
     VkStructureType sType;
     void *pNext;
 };
 
+// Per-call scratch memory for the shallow struct copies and handle arrays that are unwrapped before calling down the
+// chain. Requests are carved from inline storage on the caller's stack and spill to heap blocks only when that runs
+// out; everything is released together when the arena goes out of scope. Only trivially copyable Vulkan types are
+// stored, so nothing is ever destructed.
+class ScratchArena {
+   public:
+    ScratchArena() : used_(0), overflow_(nullptr), out_of_memory_(false) {}
+    ~ScratchArena() {
+        while (overflow_) {
+            OverflowBlock *next = overflow_->next;
+            free(overflow_);
+            overflow_ = next;
+        }
+    }
+    ScratchArena(const ScratchArena &) = delete;
+    ScratchArena &operator=(const ScratchArena &) = delete;
+
+    // Returns NULL if a heap block can't be allocated; callers must then fail the call before touching the copy
+    template <typename T>
+    T *Copy(const T *source, size_t count) {
+        T *dest = static_cast<T *>(Allocate(sizeof(T) * count));
+        if (dest && count) memcpy(dest, source, sizeof(T) * count);
+        return dest;
+    }
+
+    // Set once any Copy has failed, for callers that only check after building a whole chain
+    bool OutOfMemory() const { return out_of_memory_; }
+
+   private:
+    static const size_t kInlineSize = 4096;
+    static const size_t kAlignment = 16;
+
+    // Heap blocks are chained through a header at their start, so spilling never needs a second allocation
+    struct OverflowBlock {
+        OverflowBlock *next;
+    };
+    static const size_t kHeaderSize = (sizeof(OverflowBlock) + kAlignment - 1) & ~(kAlignment - 1);
+
+    void *Allocate(size_t size) {
+        size = (size + kAlignment - 1) & ~(kAlignment - 1);
+        if (size <= kInlineSize - used_) {
+            void *result = inline_ + used_;
+            used_ += size;
+            return result;
+        }
+        OverflowBlock *block = nullptr;
+        if (size <= SIZE_MAX - kHeaderSize) {
+            block = static_cast<OverflowBlock *>(malloc(kHeaderSize + size));
+        }
+        if (!block) {
+            out_of_memory_ = true;
+            return nullptr;
+        }
+        block->next = overflow_;
+        overflow_ = block;
+        return reinterpret_cast<unsigned char *>(block) + kHeaderSize;
+    }
+
+    alignas(kAlignment) unsigned char inline_[kInlineSize];
+    size_t used_;
+    OverflowBlock *overflow_;
+    bool out_of_memory_;
+};
+
+// A VkWriteDescriptorSet only uses the array matching its descriptorType; the others may hold stale pointers the
+// implementation must ignore, so clear them in a copy before its handles are unwrapped.
+static inline void ClearIgnoredDescriptorPointers(VkWriteDescriptorSet *write) {
+    switch (write->descriptorType) {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            write->pBufferInfo = nullptr;
+            write->pTexelBufferView = nullptr;
+            break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            write->pImageInfo = nullptr;
+            write->pTexelBufferView = nullptr;
+            break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            write->pImageInfo = nullptr;
+            write->pBufferInfo = nullptr;
+            break;
+        default:
+            write->pImageInfo = nullptr;
+            write->pBufferInfo = nullptr;
+            write->pTexelBufferView = nullptr;
+            break;
+    }
+}
+
 template <typename T>
 bool ContainsExtStruct(const T *target, VkStructureType ext_type) {
     assert(target != nullptr);
@@ -22,219 +22,243 @@
 #include <string.h>
 #include <string>
 #include <vector>
-#include <map>
 #include "vulkan/vulkan.h"
 #include "vk_format_utils.h"
 
 struct VULKAN_FORMAT_INFO {
-    size_t size;
-    uint32_t channel_count;
-    VkFormatCompatibilityClass format_class;
+    VkFormat format;  // Key of the entry, only used to check the table order at compile time
+    uint8_t size;
+    uint8_t channel_count;
+    uint8_t format_class;
 };
 
 // Disable auto-formatting for this large table
 // clang-format off
 
-// Set up data structure with number of bytes and number of channels for each Vulkan format
-const std::map<VkFormat, VULKAN_FORMAT_INFO> vk_format_table = {
-    {VK_FORMAT_UNDEFINED,                   {0, 0, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT }},
-    {VK_FORMAT_R4G4_UNORM_PACK8,            {1, 2, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT}},
-    {VK_FORMAT_R4G4B4A4_UNORM_PACK16,       {2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_B4G4R4A4_UNORM_PACK16,       {2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R5G6B5_UNORM_PACK16,         {2, 3, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_B5G6R5_UNORM_PACK16,         {2, 3, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R5G5B5A1_UNORM_PACK16,       {2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_B5G5R5A1_UNORM_PACK16,       {2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_A1R5G5B5_UNORM_PACK16,       {2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R8_UNORM,                    {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT}},
-    {VK_FORMAT_R8_SNORM,                    {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT}},
-    {VK_FORMAT_R8_USCALED,                  {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT}},
-    {VK_FORMAT_R8_SSCALED,                  {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT}},
-    {VK_FORMAT_R8_UINT,                     {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT}},
-    {VK_FORMAT_R8_SINT,                     {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT}},
-    {VK_FORMAT_R8_SRGB,                     {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT}},
-    {VK_FORMAT_R8G8_UNORM,                  {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R8G8_SNORM,                  {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R8G8_USCALED,                {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R8G8_SSCALED,                {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R8G8_UINT,                   {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R8G8_SINT,                   {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R8G8_SRGB,                   {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R8G8B8_UNORM,                {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_R8G8B8_SNORM,                {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_R8G8B8_USCALED,              {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_R8G8B8_SSCALED,              {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_R8G8B8_UINT,                 {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_R8G8B8_SINT,                 {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_R8G8B8_SRGB,                 {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_B8G8R8_UNORM,                {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_B8G8R8_SNORM,                {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_B8G8R8_USCALED,              {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_B8G8R8_SSCALED,              {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_B8G8R8_UINT,                 {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_B8G8R8_SINT,                 {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_B8G8R8_SRGB,                 {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_R8G8B8A8_UNORM,              {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R8G8B8A8_SNORM,              {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R8G8B8A8_USCALED,            {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R8G8B8A8_SSCALED,            {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R8G8B8A8_UINT,               {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R8G8B8A8_SINT,               {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R8G8B8A8_SRGB,               {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_B8G8R8A8_UNORM,              {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_B8G8R8A8_SNORM,              {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_B8G8R8A8_USCALED,            {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_B8G8R8A8_SSCALED,            {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_B8G8R8A8_UINT,               {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_B8G8R8A8_SINT,               {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_B8G8R8A8_SRGB,               {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A8B8G8R8_UNORM_PACK32,       {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A8B8G8R8_SNORM_PACK32,       {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A8B8G8R8_USCALED_PACK32,     {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A8B8G8R8_SSCALED_PACK32,     {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A8B8G8R8_UINT_PACK32,        {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A8B8G8R8_SINT_PACK32,        {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A8B8G8R8_SRGB_PACK32,        {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2R10G10B10_UNORM_PACK32,    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2R10G10B10_SNORM_PACK32,    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2R10G10B10_USCALED_PACK32,  {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2R10G10B10_SSCALED_PACK32,  {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2R10G10B10_UINT_PACK32,     {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2R10G10B10_SINT_PACK32,     {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2B10G10R10_UNORM_PACK32,    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2B10G10R10_SNORM_PACK32,    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2B10G10R10_USCALED_PACK32,  {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2B10G10R10_SSCALED_PACK32,  {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2B10G10R10_UINT_PACK32,     {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2B10G10R10_SINT_PACK32,     {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R16_UNORM,                   {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R16_SNORM,                   {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R16_USCALED,                 {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R16_SSCALED,                 {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R16_UINT,                    {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R16_SINT,                    {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R16_SFLOAT,                  {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R16G16_UNORM,                {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R16G16_SNORM,                {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R16G16_USCALED,              {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R16G16_SSCALED,              {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R16G16_UINT,                 {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R16G16_SINT,                 {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R16G16_SFLOAT,               {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R16G16B16_UNORM,             {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT}},
-    {VK_FORMAT_R16G16B16_SNORM,             {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT}},
-    {VK_FORMAT_R16G16B16_USCALED,           {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT}},
-    {VK_FORMAT_R16G16B16_SSCALED,           {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT}},
-    {VK_FORMAT_R16G16B16_UINT,              {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT}},
-    {VK_FORMAT_R16G16B16_SINT,              {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT}},
-    {VK_FORMAT_R16G16B16_SFLOAT,            {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT}},
-    {VK_FORMAT_R16G16B16A16_UNORM,          {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R16G16B16A16_SNORM,          {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R16G16B16A16_USCALED,        {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R16G16B16A16_SSCALED,        {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R16G16B16A16_UINT,           {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R16G16B16A16_SINT,           {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R16G16B16A16_SFLOAT,         {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R32_UINT,                    {4, 1, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R32_SINT,                    {4, 1, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R32_SFLOAT,                  {4, 1, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R32G32_UINT,                 {8, 2, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R32G32_SINT,                 {8, 2, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R32G32_SFLOAT,               {8, 2, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R32G32B32_UINT,              {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_96_BIT}},
-    {VK_FORMAT_R32G32B32_SINT,              {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_96_BIT}},
-    {VK_FORMAT_R32G32B32_SFLOAT,            {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_96_BIT}},
-    {VK_FORMAT_R32G32B32A32_UINT,           {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT}},
-    {VK_FORMAT_R32G32B32A32_SINT,           {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT}},
-    {VK_FORMAT_R32G32B32A32_SFLOAT,         {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT}},
-    {VK_FORMAT_R64_UINT,                    {8, 1, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R64_SINT,                    {8, 1, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R64_SFLOAT,                  {8, 1, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R64G64_UINT,                 {16, 2, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT}},
-    {VK_FORMAT_R64G64_SINT,                 {16, 2, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT}},
-    {VK_FORMAT_R64G64_SFLOAT,               {16, 2, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT}},
-    {VK_FORMAT_R64G64B64_UINT,              {24, 3, VK_FORMAT_COMPATIBILITY_CLASS_192_BIT}},
-    {VK_FORMAT_R64G64B64_SINT,              {24, 3, VK_FORMAT_COMPATIBILITY_CLASS_192_BIT}},
-    {VK_FORMAT_R64G64B64_SFLOAT,            {24, 3, VK_FORMAT_COMPATIBILITY_CLASS_192_BIT}},
-    {VK_FORMAT_R64G64B64A64_UINT,           {32, 4, VK_FORMAT_COMPATIBILITY_CLASS_256_BIT}},
-    {VK_FORMAT_R64G64B64A64_SINT,           {32, 4, VK_FORMAT_COMPATIBILITY_CLASS_256_BIT}},
-    {VK_FORMAT_R64G64B64A64_SFLOAT,         {32, 4, VK_FORMAT_COMPATIBILITY_CLASS_256_BIT}},
-    {VK_FORMAT_B10G11R11_UFLOAT_PACK32,     {4, 3, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_E5B9G9R9_UFLOAT_PACK32,      {4, 3, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_D16_UNORM,                   {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT}},
-    {VK_FORMAT_X8_D24_UNORM_PACK32,         {4, 1, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT}},
-    {VK_FORMAT_D32_SFLOAT,                  {4, 1, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT}},
-    {VK_FORMAT_S8_UINT,                     {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT}},
-    {VK_FORMAT_D16_UNORM_S8_UINT,           {3, 2, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT}},
-    {VK_FORMAT_D24_UNORM_S8_UINT,           {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT}},
-    {VK_FORMAT_D32_SFLOAT_S8_UINT,          {8, 2, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT}},
-    {VK_FORMAT_BC1_RGB_UNORM_BLOCK,         {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC1_RGB_BIT}},
-    {VK_FORMAT_BC1_RGB_SRGB_BLOCK,          {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC1_RGB_BIT}},
-    {VK_FORMAT_BC1_RGBA_UNORM_BLOCK,        {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC1_RGBA_BIT}},
-    {VK_FORMAT_BC1_RGBA_SRGB_BLOCK,         {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC1_RGBA_BIT}},
-    {VK_FORMAT_BC2_UNORM_BLOCK,             {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC2_BIT}},
-    {VK_FORMAT_BC2_SRGB_BLOCK,              {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC2_BIT}},
-    {VK_FORMAT_BC3_UNORM_BLOCK,             {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC3_BIT}},
-    {VK_FORMAT_BC3_SRGB_BLOCK,              {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC3_BIT}},
-    {VK_FORMAT_BC4_UNORM_BLOCK,             {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC4_BIT}},
-    {VK_FORMAT_BC4_SNORM_BLOCK,             {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC4_BIT}},
-    {VK_FORMAT_BC5_UNORM_BLOCK,             {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC5_BIT}},
-    {VK_FORMAT_BC5_SNORM_BLOCK,             {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC5_BIT}},
-    {VK_FORMAT_BC6H_UFLOAT_BLOCK,           {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC6H_BIT}},
-    {VK_FORMAT_BC6H_SFLOAT_BLOCK,           {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC6H_BIT}},
-    {VK_FORMAT_BC7_UNORM_BLOCK,             {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC7_BIT}},
-    {VK_FORMAT_BC7_SRGB_BLOCK,              {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC7_BIT}},
-    {VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK,     {8, 3, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_RGB_BIT}},
-    {VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK,      {8, 3, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_RGB_BIT}},
-    {VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK,   {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_RGBA_BIT}},
-    {VK_FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK,    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_RGBA_BIT}},
-    {VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK,   {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_EAC_RGBA_BIT}},
-    {VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK,    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_EAC_RGBA_BIT}},
-    {VK_FORMAT_EAC_R11_UNORM_BLOCK,         {8, 1, VK_FORMAT_COMPATIBILITY_CLASS_EAC_R_BIT}},
-    {VK_FORMAT_EAC_R11_SNORM_BLOCK,         {8, 1, VK_FORMAT_COMPATIBILITY_CLASS_EAC_R_BIT}},
-    {VK_FORMAT_EAC_R11G11_UNORM_BLOCK,      {16, 2, VK_FORMAT_COMPATIBILITY_CLASS_EAC_RG_BIT}},
-    {VK_FORMAT_EAC_R11G11_SNORM_BLOCK,      {16, 2, VK_FORMAT_COMPATIBILITY_CLASS_EAC_RG_BIT}},
-    {VK_FORMAT_ASTC_4x4_UNORM_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_4X4_BIT}},
-    {VK_FORMAT_ASTC_4x4_SRGB_BLOCK,         {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_4X4_BIT}},
-    {VK_FORMAT_ASTC_5x4_UNORM_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_5X4_BIT}},
-    {VK_FORMAT_ASTC_5x4_SRGB_BLOCK,         {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_5X4_BIT}},
-    {VK_FORMAT_ASTC_5x5_UNORM_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_5X5_BIT}},
-    {VK_FORMAT_ASTC_5x5_SRGB_BLOCK,         {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_5X5_BIT}},
-    {VK_FORMAT_ASTC_6x5_UNORM_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_6X5_BIT}},
-    {VK_FORMAT_ASTC_6x5_SRGB_BLOCK,         {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_6X5_BIT}},
-    {VK_FORMAT_ASTC_6x6_UNORM_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_6X6_BIT}},
-    {VK_FORMAT_ASTC_6x6_SRGB_BLOCK,         {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_6X6_BIT}},
-    {VK_FORMAT_ASTC_8x5_UNORM_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X5_BIT}},
-    {VK_FORMAT_ASTC_8x5_SRGB_BLOCK,         {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X5_BIT}},
-    {VK_FORMAT_ASTC_8x6_UNORM_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X6_BIT}},
-    {VK_FORMAT_ASTC_8x6_SRGB_BLOCK,         {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X6_BIT}},
-    {VK_FORMAT_ASTC_8x8_UNORM_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X8_BIT}},
-    {VK_FORMAT_ASTC_8x8_SRGB_BLOCK,         {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X8_BIT}},
-    {VK_FORMAT_ASTC_10x5_UNORM_BLOCK,       {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X5_BIT}},
-    {VK_FORMAT_ASTC_10x5_SRGB_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X5_BIT}},
-    {VK_FORMAT_ASTC_10x6_UNORM_BLOCK,       {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X6_BIT}},
-    {VK_FORMAT_ASTC_10x6_SRGB_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X6_BIT}},
-    {VK_FORMAT_ASTC_10x8_UNORM_BLOCK,       {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X8_BIT}},
-    {VK_FORMAT_ASTC_10x8_SRGB_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X8_BIT}},
-    {VK_FORMAT_ASTC_10x10_UNORM_BLOCK,      {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X10_BIT}},
-    {VK_FORMAT_ASTC_10x10_SRGB_BLOCK,       {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X10_BIT}},
-    {VK_FORMAT_ASTC_12x10_UNORM_BLOCK,      {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_12X10_BIT}},
-    {VK_FORMAT_ASTC_12x10_SRGB_BLOCK,       {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_12X10_BIT}},
-    {VK_FORMAT_ASTC_12x12_UNORM_BLOCK,      {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_12X12_BIT}},
-    {VK_FORMAT_ASTC_12x12_SRGB_BLOCK,       {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_12X12_BIT}},
-    {VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG, {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X6_BIT }},
-    {VK_FORMAT_PVRTC1_4BPP_UNORM_BLOCK_IMG, {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X6_BIT}},
-    {VK_FORMAT_PVRTC2_2BPP_UNORM_BLOCK_IMG, {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X8_BIT}},
-    {VK_FORMAT_PVRTC2_4BPP_UNORM_BLOCK_IMG, {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X8_BIT}},
-    {VK_FORMAT_PVRTC1_2BPP_SRGB_BLOCK_IMG,  {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X10_BIT}},
-    {VK_FORMAT_PVRTC1_4BPP_SRGB_BLOCK_IMG,  {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X10_BIT}},
-    {VK_FORMAT_PVRTC2_2BPP_SRGB_BLOCK_IMG,  {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_12X10_BIT}},
-    {VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG,  {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_12X10_BIT}},
+// Number of bytes, number of channels and compatibility class for each core Vulkan format, indexed by the VkFormat value
+static constexpr VULKAN_FORMAT_INFO vk_format_table[VK_FORMAT_RANGE_SIZE] = {
+    {VK_FORMAT_UNDEFINED,                    0, 0, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT},
+    {VK_FORMAT_R4G4_UNORM_PACK8,             1, 2, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT},
+    {VK_FORMAT_R4G4B4A4_UNORM_PACK16,        2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_B4G4R4A4_UNORM_PACK16,        2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_R5G6B5_UNORM_PACK16,          2, 3, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_B5G6R5_UNORM_PACK16,          2, 3, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_R5G5B5A1_UNORM_PACK16,        2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_B5G5R5A1_UNORM_PACK16,        2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_A1R5G5B5_UNORM_PACK16,        2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_R8_UNORM,                     1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT},
+    {VK_FORMAT_R8_SNORM,                     1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT},
+    {VK_FORMAT_R8_USCALED,                   1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT},
+    {VK_FORMAT_R8_SSCALED,                   1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT},
+    {VK_FORMAT_R8_UINT,                      1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT},
+    {VK_FORMAT_R8_SINT,                      1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT},
+    {VK_FORMAT_R8_SRGB,                      1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT},
+    {VK_FORMAT_R8G8_UNORM,                   2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_R8G8_SNORM,                   2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_R8G8_USCALED,                 2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_R8G8_SSCALED,                 2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_R8G8_UINT,                    2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_R8G8_SINT,                    2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_R8G8_SRGB,                    2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_R8G8B8_UNORM,                 3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},
+    {VK_FORMAT_R8G8B8_SNORM,                 3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},
+    {VK_FORMAT_R8G8B8_USCALED,               3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},
+    {VK_FORMAT_R8G8B8_SSCALED,               3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},
+    {VK_FORMAT_R8G8B8_UINT,                  3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},
+    {VK_FORMAT_R8G8B8_SINT,                  3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},
+    {VK_FORMAT_R8G8B8_SRGB,                  3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},
+    {VK_FORMAT_B8G8R8_UNORM,                 3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},
+    {VK_FORMAT_B8G8R8_SNORM,                 3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},
+    {VK_FORMAT_B8G8R8_USCALED,               3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},
+    {VK_FORMAT_B8G8R8_SSCALED,               3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},
+    {VK_FORMAT_B8G8R8_UINT,                  3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},
+    {VK_FORMAT_B8G8R8_SINT,                  3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},
+    {VK_FORMAT_B8G8R8_SRGB,                  3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},
+    {VK_FORMAT_R8G8B8A8_UNORM,               4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_R8G8B8A8_SNORM,               4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_R8G8B8A8_USCALED,             4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_R8G8B8A8_SSCALED,             4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_R8G8B8A8_UINT,                4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_R8G8B8A8_SINT,                4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_R8G8B8A8_SRGB,                4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_B8G8R8A8_UNORM,               4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_B8G8R8A8_SNORM,               4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_B8G8R8A8_USCALED,             4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_B8G8R8A8_SSCALED,             4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_B8G8R8A8_UINT,                4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_B8G8R8A8_SINT,                4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_B8G8R8A8_SRGB,                4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_A8B8G8R8_UNORM_PACK32,        4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_A8B8G8R8_SNORM_PACK32,        4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_A8B8G8R8_USCALED_PACK32,      4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_A8B8G8R8_SSCALED_PACK32,      4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_A8B8G8R8_UINT_PACK32,         4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_A8B8G8R8_SINT_PACK32,         4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_A8B8G8R8_SRGB_PACK32,         4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_A2R10G10B10_UNORM_PACK32,     4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_A2R10G10B10_SNORM_PACK32,     4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_A2R10G10B10_USCALED_PACK32,   4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_A2R10G10B10_SSCALED_PACK32,   4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_A2R10G10B10_UINT_PACK32,      4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_A2R10G10B10_SINT_PACK32,      4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_A2B10G10R10_UNORM_PACK32,     4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_A2B10G10R10_SNORM_PACK32,     4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_A2B10G10R10_USCALED_PACK32,   4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_A2B10G10R10_SSCALED_PACK32,   4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_A2B10G10R10_UINT_PACK32,      4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_A2B10G10R10_SINT_PACK32,      4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_R16_UNORM,                    2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_R16_SNORM,                    2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_R16_USCALED,                  2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_R16_SSCALED,                  2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_R16_UINT,                     2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_R16_SINT,                     2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_R16_SFLOAT,                   2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},
+    {VK_FORMAT_R16G16_UNORM,                 4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_R16G16_SNORM,                 4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_R16G16_USCALED,               4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_R16G16_SSCALED,               4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_R16G16_UINT,                  4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_R16G16_SINT,                  4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_R16G16_SFLOAT,                4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_R16G16B16_UNORM,              6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT},
+    {VK_FORMAT_R16G16B16_SNORM,              6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT},
+    {VK_FORMAT_R16G16B16_USCALED,            6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT},
+    {VK_FORMAT_R16G16B16_SSCALED,            6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT},
+    {VK_FORMAT_R16G16B16_UINT,               6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT},
+    {VK_FORMAT_R16G16B16_SINT,               6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT},
+    {VK_FORMAT_R16G16B16_SFLOAT,             6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT},
+    {VK_FORMAT_R16G16B16A16_UNORM,           8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},
+    {VK_FORMAT_R16G16B16A16_SNORM,           8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},
+    {VK_FORMAT_R16G16B16A16_USCALED,         8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},
+    {VK_FORMAT_R16G16B16A16_SSCALED,         8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},
+    {VK_FORMAT_R16G16B16A16_UINT,            8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},
+    {VK_FORMAT_R16G16B16A16_SINT,            8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},
+    {VK_FORMAT_R16G16B16A16_SFLOAT,          8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},
+    {VK_FORMAT_R32_UINT,                     4, 1, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_R32_SINT,                     4, 1, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_R32_SFLOAT,                   4, 1, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_R32G32_UINT,                  8, 2, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},
+    {VK_FORMAT_R32G32_SINT,                  8, 2, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},
+    {VK_FORMAT_R32G32_SFLOAT,                8, 2, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},
+    {VK_FORMAT_R32G32B32_UINT,              12, 3, VK_FORMAT_COMPATIBILITY_CLASS_96_BIT},
+    {VK_FORMAT_R32G32B32_SINT,              12, 3, VK_FORMAT_COMPATIBILITY_CLASS_96_BIT},
+    {VK_FORMAT_R32G32B32_SFLOAT,            12, 3, VK_FORMAT_COMPATIBILITY_CLASS_96_BIT},
+    {VK_FORMAT_R32G32B32A32_UINT,           16, 4, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT},
+    {VK_FORMAT_R32G32B32A32_SINT,           16, 4, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT},
+    {VK_FORMAT_R32G32B32A32_SFLOAT,         16, 4, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT},
+    {VK_FORMAT_R64_UINT,                     8, 1, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},
+    {VK_FORMAT_R64_SINT,                     8, 1, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},
+    {VK_FORMAT_R64_SFLOAT,                   8, 1, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},
+    {VK_FORMAT_R64G64_UINT,                 16, 2, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT},
+    {VK_FORMAT_R64G64_SINT,                 16, 2, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT},
+    {VK_FORMAT_R64G64_SFLOAT,               16, 2, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT},
+    {VK_FORMAT_R64G64B64_UINT,              24, 3, VK_FORMAT_COMPATIBILITY_CLASS_192_BIT},
+    {VK_FORMAT_R64G64B64_SINT,              24, 3, VK_FORMAT_COMPATIBILITY_CLASS_192_BIT},
+    {VK_FORMAT_R64G64B64_SFLOAT,            24, 3, VK_FORMAT_COMPATIBILITY_CLASS_192_BIT},
+    {VK_FORMAT_R64G64B64A64_UINT,           32, 4, VK_FORMAT_COMPATIBILITY_CLASS_256_BIT},
+    {VK_FORMAT_R64G64B64A64_SINT,           32, 4, VK_FORMAT_COMPATIBILITY_CLASS_256_BIT},
+    {VK_FORMAT_R64G64B64A64_SFLOAT,         32, 4, VK_FORMAT_COMPATIBILITY_CLASS_256_BIT},
+    {VK_FORMAT_B10G11R11_UFLOAT_PACK32,      4, 3, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_E5B9G9R9_UFLOAT_PACK32,       4, 3, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},
+    {VK_FORMAT_D16_UNORM,                    2, 1, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT},
+    {VK_FORMAT_X8_D24_UNORM_PACK32,          4, 1, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT},
+    {VK_FORMAT_D32_SFLOAT,                   4, 1, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT},
+    {VK_FORMAT_S8_UINT,                      1, 1, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT},
+    {VK_FORMAT_D16_UNORM_S8_UINT,            3, 2, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT},
+    {VK_FORMAT_D24_UNORM_S8_UINT,            4, 2, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT},
+    {VK_FORMAT_D32_SFLOAT_S8_UINT,           8, 2, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT},
+    {VK_FORMAT_BC1_RGB_UNORM_BLOCK,          8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC1_RGB_BIT},
+    {VK_FORMAT_BC1_RGB_SRGB_BLOCK,           8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC1_RGB_BIT},
+    {VK_FORMAT_BC1_RGBA_UNORM_BLOCK,         8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC1_RGBA_BIT},
+    {VK_FORMAT_BC1_RGBA_SRGB_BLOCK,          8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC1_RGBA_BIT},
+    {VK_FORMAT_BC2_UNORM_BLOCK,             16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC2_BIT},
+    {VK_FORMAT_BC2_SRGB_BLOCK,              16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC2_BIT},
+    {VK_FORMAT_BC3_UNORM_BLOCK,             16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC3_BIT},
+    {VK_FORMAT_BC3_SRGB_BLOCK,              16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC3_BIT},
+    {VK_FORMAT_BC4_UNORM_BLOCK,              8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC4_BIT},
+    {VK_FORMAT_BC4_SNORM_BLOCK,              8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC4_BIT},
+    {VK_FORMAT_BC5_UNORM_BLOCK,             16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC5_BIT},
+    {VK_FORMAT_BC5_SNORM_BLOCK,             16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC5_BIT},
+    {VK_FORMAT_BC6H_UFLOAT_BLOCK,           16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC6H_BIT},
+    {VK_FORMAT_BC6H_SFLOAT_BLOCK,           16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC6H_BIT},
+    {VK_FORMAT_BC7_UNORM_BLOCK,             16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC7_BIT},
+    {VK_FORMAT_BC7_SRGB_BLOCK,              16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC7_BIT},
+    {VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK,      8, 3, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_RGB_BIT},
+    {VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK,       8, 3, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_RGB_BIT},
+    {VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK,    8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_RGBA_BIT},
+    {VK_FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK,     8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_RGBA_BIT},
+    {VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK,   16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_EAC_RGBA_BIT},
+    {VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK,     8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_EAC_RGBA_BIT},
+    {VK_FORMAT_EAC_R11_UNORM_BLOCK,          8, 1, VK_FORMAT_COMPATIBILITY_CLASS_EAC_R_BIT},
+    {VK_FORMAT_EAC_R11_SNORM_BLOCK,          8, 1, VK_FORMAT_COMPATIBILITY_CLASS_EAC_R_BIT},
+    {VK_FORMAT_EAC_R11G11_UNORM_BLOCK,      16, 2, VK_FORMAT_COMPATIBILITY_CLASS_EAC_RG_BIT},
+    {VK_FORMAT_EAC_R11G11_SNORM_BLOCK,      16, 2, VK_FORMAT_COMPATIBILITY_CLASS_EAC_RG_BIT},
+    {VK_FORMAT_ASTC_4x4_UNORM_BLOCK,        16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_4X4_BIT},
+    {VK_FORMAT_ASTC_4x4_SRGB_BLOCK,         16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_4X4_BIT},
+    {VK_FORMAT_ASTC_5x4_UNORM_BLOCK,        16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_5X4_BIT},
+    {VK_FORMAT_ASTC_5x4_SRGB_BLOCK,         16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_5X4_BIT},
+    {VK_FORMAT_ASTC_5x5_UNORM_BLOCK,        16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_5X5_BIT},
+    {VK_FORMAT_ASTC_5x5_SRGB_BLOCK,         16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_5X5_BIT},
+    {VK_FORMAT_ASTC_6x5_UNORM_BLOCK,        16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_6X5_BIT},
+    {VK_FORMAT_ASTC_6x5_SRGB_BLOCK,         16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_6X5_BIT},
+    {VK_FORMAT_ASTC_6x6_UNORM_BLOCK,        16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_6X6_BIT},
+    {VK_FORMAT_ASTC_6x6_SRGB_BLOCK,         16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_6X6_BIT},
+    {VK_FORMAT_ASTC_8x5_UNORM_BLOCK,        16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X5_BIT},
+    {VK_FORMAT_ASTC_8x5_SRGB_BLOCK,         16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X5_BIT},
+    {VK_FORMAT_ASTC_8x6_UNORM_BLOCK,        16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X6_BIT},
+    {VK_FORMAT_ASTC_8x6_SRGB_BLOCK,         16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X6_BIT},
+    {VK_FORMAT_ASTC_8x8_UNORM_BLOCK,        16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X8_BIT},
+    {VK_FORMAT_ASTC_8x8_SRGB_BLOCK,         16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X8_BIT},
+    {VK_FORMAT_ASTC_10x5_UNORM_BLOCK,       16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X5_BIT},
+    {VK_FORMAT_ASTC_10x5_SRGB_BLOCK,        16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X5_BIT},
+    {VK_FORMAT_ASTC_10x6_UNORM_BLOCK,       16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X6_BIT},
+    {VK_FORMAT_ASTC_10x6_SRGB_BLOCK,        16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X6_BIT},
+    {VK_FORMAT_ASTC_10x8_UNORM_BLOCK,       16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X8_BIT},
+    {VK_FORMAT_ASTC_10x8_SRGB_BLOCK,        16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X8_BIT},
+    {VK_FORMAT_ASTC_10x10_UNORM_BLOCK,      16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X10_BIT},
+    {VK_FORMAT_ASTC_10x10_SRGB_BLOCK,       16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X10_BIT},
+    {VK_FORMAT_ASTC_12x10_UNORM_BLOCK,      16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_12X10_BIT},
+    {VK_FORMAT_ASTC_12x10_SRGB_BLOCK,       16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_12X10_BIT},
+    {VK_FORMAT_ASTC_12x12_UNORM_BLOCK,      16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_12X12_BIT},
+    {VK_FORMAT_ASTC_12x12_SRGB_BLOCK,       16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_12X12_BIT},
+};
+
+// The same information for extension formats, indexed by the offset from the first VK_IMG_format_pvrtc format
+static constexpr VULKAN_FORMAT_INFO vk_format_ext_table[] = {
+    {VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG,  8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X6_BIT},
+    {VK_FORMAT_PVRTC1_4BPP_UNORM_BLOCK_IMG,  8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X6_BIT},
+    {VK_FORMAT_PVRTC2_2BPP_UNORM_BLOCK_IMG,  8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X8_BIT},
+    {VK_FORMAT_PVRTC2_4BPP_UNORM_BLOCK_IMG,  8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X8_BIT},
+    {VK_FORMAT_PVRTC1_2BPP_SRGB_BLOCK_IMG,   8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X10_BIT},
+    {VK_FORMAT_PVRTC1_4BPP_SRGB_BLOCK_IMG,   8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X10_BIT},
+    {VK_FORMAT_PVRTC2_2BPP_SRGB_BLOCK_IMG,   8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_12X10_BIT},
+    {VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG,   8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_12X10_BIT},
 };
 
 // Renable formatting
 // clang-format on
 
+// Verify that entry i of a table describes format (first + i), so a lookup can index the table directly
+static constexpr bool FormatTableInOrder(const VULKAN_FORMAT_INFO *table, uint32_t count, uint32_t first, uint32_t i) {
+    return (i == count) ||
+           ((static_cast<uint32_t>(table[i].format) == first + i) && FormatTableInOrder(table, count, first, i + 1));
+}
+static_assert(FormatTableInOrder(vk_format_table, VK_FORMAT_RANGE_SIZE, VK_FORMAT_BEGIN_RANGE, 0),
+              "vk_format_table must list core formats in VkFormat order");
+static_assert(FormatTableInOrder(vk_format_ext_table, sizeof(vk_format_ext_table) / sizeof(vk_format_ext_table[0]),
+                                 VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG, 0),
+              "vk_format_ext_table must list extension formats in VkFormat order");
+
+// Return the table entry for a format; unknown formats get the VK_FORMAT_UNDEFINED entry
+static inline const VULKAN_FORMAT_INFO &GetFormatInfo(VkFormat format) {
+    const uint32_t index = static_cast<uint32_t>(format);
+    if (index < VK_FORMAT_RANGE_SIZE) return vk_format_table[index];
+    const uint32_t ext_index = index - static_cast<uint32_t>(VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG);
+    if (ext_index < sizeof(vk_format_ext_table) / sizeof(vk_format_ext_table[0])) return vk_format_ext_table[ext_index];
+    return vk_format_table[VK_FORMAT_UNDEFINED];
+}
+
 // Return true if format is an ETC2 or EAC compressed texture format
 VK_LAYER_EXPORT bool FormatIsCompressed_ETC2_EAC(VkFormat format) {
     bool found = false;
@@ -889,30 +913,14 @@ VK_LAYER_EXPORT VkExtent3D FormatCompressedTexelBlockExtent(VkFormat format) {
 
 // Return format class of the specified format
 VK_LAYER_EXPORT VkFormatCompatibilityClass FormatCompatibilityClass(VkFormat format) {
-    auto item = vk_format_table.find(format);
-    if (item != vk_format_table.end()) {
-        return item->second.format_class;
-    }
-    return VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT;
+    return static_cast<VkFormatCompatibilityClass>(GetFormatInfo(format).format_class);
 }
 
 // Return size, in bytes, of a pixel of the specified format
-VK_LAYER_EXPORT size_t FormatSize(VkFormat format) {
-    auto item = vk_format_table.find(format);
-    if (item != vk_format_table.end()) {
-        return item->second.size;
-    }
-    return 0;
-}
+VK_LAYER_EXPORT size_t FormatSize(VkFormat format) { return GetFormatInfo(format).size; }
 
 // Return the number of channels for a given format
-unsigned int FormatChannelCount(VkFormat format) {
-    auto item = vk_format_table.find(format);
-    if (item != vk_format_table.end()) {
-        return item->second.channel_count;
-    }
-    return 0;
-}
+unsigned int FormatChannelCount(VkFormat format) { return GetFormatInfo(format).channel_count; }
 
 // Perform a zero-tolerant modulo operation
 VK_LAYER_EXPORT VkDeviceSize SafeModulo(VkDeviceSize dividend, VkDeviceSize divisor) {
@@ -20,9 +20,172 @@
 #ifndef LAYER_DATA_H
 #define LAYER_DATA_H
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 #include "vk_layer_table.h"
 
+// Dispatch-key -> layer data map read on every intercepted call. Lookups are lock-free: the table is a small
+// open-addressed array of atomic (key, data) slots, and writers (instance/device creation and destruction) serialize
+// on a mutex and publish entries with release stores. Walks over all entries hold that mutex. Tables that are replaced
+// on growth are retired, not freed, so a reader still probing an old table never touches released memory; retired
+// tables are released with the map.
+template <typename DATA_T>
+class LayerDataMap {
+    struct Table;
+
+   public:
+    LayerDataMap() : table_(new Table(kInitialCapacity)) {}
+    ~LayerDataMap() { delete table_.load(std::memory_order_relaxed); }
+
+    LayerDataMap(const LayerDataMap &) = delete;
+    LayerDataMap &operator=(const LayerDataMap &) = delete;
+
+    // Returns the data stored for key, or nullptr
+    DATA_T *find(void *key) const {
+        const Table *table = table_.load(std::memory_order_acquire);
+        for (size_t i = table->Home(key), probes = 0; probes < table->capacity; i = (i + 1) & table->mask, ++probes) {
+            void *slot_key = table->slots[i].key.load(std::memory_order_acquire);
+            if (slot_key == key) return table->slots[i].data.load(std::memory_order_acquire);
+            if (slot_key == kEmptyKey) break;
+        }
+        return nullptr;
+    }
+
+    // Returns the data stored for key, creating and inserting a new DATA_T if there is none
+    DATA_T *get_or_create(void *key) {
+        DATA_T *data = find(key);
+        if (data) return data;
+        std::lock_guard<std::mutex> lock(write_lock_);
+        data = find(key);
+        if (!data) {
+            data = new DATA_T;
+            InsertLocked(key, data);
+        }
+        return data;
+    }
+
+    size_t erase(void *key) {
+        std::lock_guard<std::mutex> lock(write_lock_);
+        Table *table = table_.load(std::memory_order_relaxed);
+        for (size_t i = table->Home(key), probes = 0; probes < table->capacity; i = (i + 1) & table->mask, ++probes) {
+            void *slot_key = table->slots[i].key.load(std::memory_order_relaxed);
+            if (slot_key == key) {
+                table->slots[i].key.store(kTombstoneKey, std::memory_order_release);
+                table->slots[i].data.store(nullptr, std::memory_order_release);
+                --table->live;
+                return 1;
+            }
+            if (slot_key == kEmptyKey) break;
+        }
+        return 0;
+    }
+
+    // Calls func(key, data) for each entry. The writer mutex is held throughout, so entries are neither added nor erased
+    // during the walk; func must not insert into or erase from this map.
+    template <typename FUNC>
+    void for_each(FUNC func) {
+        std::lock_guard<std::mutex> lock(write_lock_);
+        const Table *table = table_.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < table->capacity; ++i) {
+            void *slot_key = table->slots[i].key.load(std::memory_order_relaxed);
+            if (slot_key == kEmptyKey || slot_key == kTombstoneKey) continue;
+            func(slot_key, table->slots[i].data.load(std::memory_order_relaxed));
+        }
+    }
+
+   private:
+    // Most applications have one instance and one to four devices, so the initial table never grows in practice
+    static const size_t kInitialCapacity = 16;
+    static void *const kEmptyKey;
+    static void *const kTombstoneKey;
+
+    struct Slot {
+        std::atomic<void *> key;
+        std::atomic<DATA_T *> data;
+    };
+
+    struct Table {
+        explicit Table(size_t capacity_) : capacity(capacity_), mask(capacity_ - 1), slots(new Slot[capacity_]) {
+            for (size_t i = 0; i < capacity; ++i) {
+                slots[i].key.store(kEmptyKey, std::memory_order_relaxed);
+                slots[i].data.store(nullptr, std::memory_order_relaxed);
+            }
+        }
+        // Dispatch keys are pointers to dispatch tables; drop the alignment bits before mixing
+        size_t Home(void *key) const { return (size_t)(((uintptr_t)key >> 4) * UINT64_C(0x9E3779B97F4A7C15) >> 32) & mask; }
+
+        size_t capacity;
+        size_t mask;
+        size_t live = 0;
+        size_t used = 0;  // live entries plus tombstones
+        std::unique_ptr<Slot[]> slots;
+        std::unique_ptr<Table> retired;  // previous table, kept alive for readers that may still be probing it
+    };
+
+    void InsertLocked(void *key, DATA_T *data) {
+        Table *table = table_.load(std::memory_order_relaxed);
+        size_t target = table->capacity;
+        for (size_t i = table->Home(key), probes = 0; probes < table->capacity; i = (i + 1) & table->mask, ++probes) {
+            void *slot_key = table->slots[i].key.load(std::memory_order_relaxed);
+            if (slot_key == kTombstoneKey) {
+                target = i;  // Reuse the first tombstone on the probe path
+                break;
+            }
+            if (slot_key == kEmptyKey) {
+                target = i;
+                ++table->used;
+                break;
+            }
+        }
+        if (target == table->capacity || table->used * 2 > table->capacity) {
+            table = Rehash(table);
+            InsertLocked(key, data);
+            return;
+        }
+        // Publish the data before the key so a reader that matches the key always sees its data
+        table->slots[target].data.store(data, std::memory_order_release);
+        table->slots[target].key.store(key, std::memory_order_release);
+        ++table->live;
+    }
+
+    Table *Rehash(Table *old_table) {
+        size_t capacity = kInitialCapacity;
+        while (capacity < (old_table->live + 1) * 4) capacity *= 2;
+        Table *table = new Table(capacity);
+        for (size_t i = 0; i < old_table->capacity; ++i) {
+            void *slot_key = old_table->slots[i].key.load(std::memory_order_relaxed);
+            if (slot_key == kEmptyKey || slot_key == kTombstoneKey) continue;
+            size_t j = table->Home(slot_key);
+            while (table->slots[j].key.load(std::memory_order_relaxed) != kEmptyKey) j = (j + 1) & table->mask;
+            table->slots[j].data.store(old_table->slots[i].data.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            table->slots[j].key.store(slot_key, std::memory_order_relaxed);
+            ++table->live;
+            ++table->used;
+        }
+        table->retired.reset(old_table);
+        table_.store(table, std::memory_order_release);
+        return table;
+    }
+
+    std::atomic<Table *> table_;
+    std::mutex write_lock_;
+};
+
+template <typename DATA_T>
+void *const LayerDataMap<DATA_T>::kEmptyKey = nullptr;
+template <typename DATA_T>
+void *const LayerDataMap<DATA_T>::kTombstoneKey = reinterpret_cast<void *>(uintptr_t(1));
+
+// For the given data key, look up the layer_data instance from given layer_data_map, creating it on first use
+template <typename DATA_T>
+DATA_T *GetLayerDataPtr(void *data_key, LayerDataMap<DATA_T> &layer_data_map) {
+    return layer_data_map.get_or_create(data_key);
+}
+
 // For the given data key, look up the layer_data instance from given layer_data_map
 template <typename DATA_T>
 DATA_T *GetLayerDataPtr(void *data_key, std::unordered_map<void *, DATA_T *> &layer_data_map) {
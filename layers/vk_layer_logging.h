@@ -29,19 +29,102 @@
 #include "vk_loader_platform.h"
 #include "vulkan/vk_layer.h"
 #include <cinttypes>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <string>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+// Defined in vk_validation_error_messages.h. Other msgCode enums reuse the same values, so log_msg() can only tell that a
+// message is a validation error, and apply the disabled_message_codes setting to it, by the type of its msgCode.
+enum UNIQUE_VALIDATION_ERROR_CODE : int;
+
+// Writes formatted log lines to a FILE on a background thread so that validating threads never block on file or console
+// I/O.  The queue is bounded; producers wait for the writer once it is full rather than dropping messages.
+class AsyncLogWriter {
+   public:
+    AsyncLogWriter(FILE *output, size_t queue_limit)
+        : output_(output), queue_limit_(queue_limit ? queue_limit : 1), stop_(false), worker_(&AsyncLogWriter::Run, this) {}
+
+    ~AsyncLogWriter() {
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            stop_ = true;
+        }
+        ready_.notify_one();
+        worker_.join();
+    }
+
+    void Push(std::string &&line) {
+        std::unique_lock<std::mutex> lock(lock_);
+        space_.wait(lock, [this] { return queue_.size() < queue_limit_; });
+        queue_.push_back(std::move(line));
+        lock.unlock();
+        ready_.notify_one();
+    }
+
+   private:
+    void Run() {
+        std::deque<std::string> batch;
+        std::unique_lock<std::mutex> lock(lock_);
+        while (true) {
+            ready_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+            if (queue_.empty()) break;
+            batch.swap(queue_);
+            lock.unlock();
+            space_.notify_all();
+            for (const auto &line : batch) fputs(line.c_str(), output_);
+            fflush(output_);
+            batch.clear();
+            lock.lock();
+        }
+    }
+
+    FILE *output_;
+    size_t queue_limit_;
+    bool stop_;
+    std::deque<std::string> queue_;
+    std::mutex lock_;
+    std::condition_variable ready_;
+    std::condition_variable space_;
+    std::thread worker_;  // Must be last so the members it uses are constructed first
+};
+
+// Number of times one msgCode was reported for one object, and the callbacks' verdict on the last delivered report
+struct debug_report_message_count {
+    uint32_t count;
+    VkFlags msg_flags;
+    bool bail;
+};
+
 typedef struct _debug_report_data {
     VkLayerDbgFunctionNode *debug_callback_list;
     VkLayerDbgFunctionNode *default_debug_callback_list;
     VkFlags active_flags;
     bool g_DEBUG_REPORT;
+    // Reports of one msgCode for one object beyond this many are dropped before formatting; 0 means no limit
+    uint32_t duplicate_message_limit;
+    // Report how often each msgCode fired when the instance is destroyed
+    bool message_summary;
+    mutable std::mutex message_count_lock;
+    mutable std::unordered_map<int32_t, std::unordered_map<uint64_t, debug_report_message_count>> message_counts;
+    // Background writers owned by LOG_MSG callbacks, released with the instance
+    std::vector<AsyncLogWriter *> async_log_writers;
+    // Validation errors disabled through the layer settings
+    std::unordered_set<int32_t> disabled_validation_errors;
 } debug_report_data;
 
+static inline bool debug_report_validation_error_disabled(const debug_report_data *debug_data,
+                                                          UNIQUE_VALIDATION_ERROR_CODE msgCode) {
+    return !debug_data->disabled_validation_errors.empty() && debug_data->disabled_validation_errors.count(msgCode) != 0;
+}
+
 template debug_report_data *GetLayerDataPtr<debug_report_data>(void *data_key,
                                                                std::unordered_map<void *, debug_report_data *> &data_map);
 
@@ -133,10 +216,8 @@ static inline debug_report_data *debug_report_create_instance(
     VkLayerInstanceDispatchTable *table, VkInstance inst, uint32_t extension_count,
     const char *const *ppEnabledExtensions)  // layer or extension name to be enabled
 {
-    debug_report_data *debug_data = (debug_report_data *)malloc(sizeof(debug_report_data));
-    if (!debug_data) return NULL;
+    debug_report_data *debug_data = new debug_report_data();
 
-    memset(debug_data, 0, sizeof(debug_report_data));
     for (uint32_t i = 0; i < extension_count; i++) {
         // TODO: Check other property fields
         if (strcmp(ppEnabledExtensions[i], VK_EXT_DEBUG_REPORT_EXTENSION_NAME) == 0) {
@@ -146,11 +227,38 @@ static inline debug_report_data *debug_report_create_instance(
     return debug_data;
 }
 
+// Summarize repeated messages through the callbacks that are still registered
+static inline void debug_report_log_message_summary(debug_report_data *debug_data) {
+    const uint32_t limit = debug_data->duplicate_message_limit;
+    for (const auto &code : debug_data->message_counts) {
+        uint64_t total = 0;
+        uint64_t suppressed = 0;
+        VkFlags msg_flags = 0;
+        for (const auto &object : code.second) {
+            total += object.second.count;
+            if (limit && object.second.count > limit) suppressed += object.second.count - limit;
+            msg_flags |= object.second.msg_flags;
+        }
+        if (!debug_data->message_summary && !suppressed) continue;
+
+        char summary[256];
+        snprintf(summary, sizeof(summary),
+                 "Message summary: msgCode %d was reported %" PRIu64 " times for %zu objects, %" PRIu64 " duplicates suppressed",
+                 code.first, total, code.second.size(), suppressed);
+        debug_report_log_msg(debug_data, msg_flags, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, 0, code.first, "DebugReport",
+                             summary);
+    }
+}
+
 static inline void layer_debug_report_destroy_instance(debug_report_data *debug_data) {
     if (debug_data) {
+        debug_report_log_message_summary(debug_data);
         RemoveAllMessageCallbacks(debug_data, &debug_data->default_debug_callback_list);
         RemoveAllMessageCallbacks(debug_data, &debug_data->debug_callback_list);
-        free(debug_data);
+        for (auto writer : debug_data->async_log_writers) {
+            delete writer;
+        }
+        delete debug_data;
     }
 }
 
@@ -306,6 +414,16 @@ static inline bool will_log_msg(debug_report_data *debug_data, VkFlags msgFlags)
     return true;
 }
 
+// Checks if a validation error will get logged, including per-code filtering from the layer settings.
+// Validation that only exists to report msgCode can be skipped entirely when this returns false.
+static inline bool will_log_msg(const debug_report_data *debug_data, VkFlags msgFlags, UNIQUE_VALIDATION_ERROR_CODE msgCode) {
+    if (!debug_data || !(debug_data->active_flags & msgFlags) || debug_report_validation_error_disabled(debug_data, msgCode)) {
+        return false;
+    }
+
+    return true;
+}
+
 #ifdef WIN32
 static inline int vasprintf(char **strp, char const *fmt, va_list ap) {
     *strp = nullptr;
@@ -321,6 +439,49 @@ static inline int vasprintf(char **strp, char const *fmt, va_list ap) {
 }
 #endif
 
+// Counts, formats and delivers a message that has passed the severity and msgCode filters
+static inline bool debug_report_vlog_msg(const debug_report_data *debug_data, VkFlags msgFlags,
+                                         VkDebugReportObjectTypeEXT objectType, uint64_t srcObject, size_t location,
+                                         int32_t msgCode, const char *pLayerPrefix, const char *format, va_list argptr) {
+    debug_report_message_count *message_count = nullptr;
+    if (debug_data->duplicate_message_limit || debug_data->message_summary) {
+        std::lock_guard<std::mutex> lock(debug_data->message_count_lock);
+        message_count = &debug_data->message_counts[msgCode][srcObject];
+        message_count->count++;
+        message_count->msg_flags |= msgFlags;
+        const uint32_t limit = debug_data->duplicate_message_limit;
+        if (limit && message_count->count > limit) {
+            // Repeat of an already reported problem: skip formatting and delivery, but keep the callbacks' last verdict
+            return message_count->bail;
+        }
+    }
+
+    char *str;
+    if (-1 == vasprintf(&str, format, argptr)) {
+        // On failure, glibc vasprintf leaves str undefined
+        str = nullptr;
+    }
+    bool result = debug_report_log_msg(debug_data, msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix,
+                                       str ? str : "Allocation failure");
+    free(str);
+
+    if (message_count) {
+        bool last_reported;
+        {
+            std::lock_guard<std::mutex> lock(debug_data->message_count_lock);
+            message_count->bail = result;
+            last_reported = (message_count->count == debug_data->duplicate_message_limit);
+        }
+        if (last_reported) {
+            char notice[128];
+            snprintf(notice, sizeof(notice), "Further reports of msgCode %d for object 0x%" PRIx64 " will be suppressed", msgCode,
+                     srcObject);
+            debug_report_log_msg(debug_data, msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix, notice);
+        }
+    }
+    return result;
+}
+
 // Output log message via DEBUG_REPORT
 // Takes format and variable arg list so that output string
 // is only computed if a message needs to be logged
@@ -328,6 +489,9 @@ static inline int vasprintf(char **strp, char const *fmt, va_list ap) {
 static inline bool log_msg(const debug_report_data *debug_data, VkFlags msgFlags, VkDebugReportObjectTypeEXT objectType,
                            uint64_t srcObject, size_t location, int32_t msgCode, const char *pLayerPrefix, const char *format, ...)
     __attribute__((format(printf, 8, 9)));
+static inline bool log_msg(const debug_report_data *debug_data, VkFlags msgFlags, VkDebugReportObjectTypeEXT objectType,
+                           uint64_t srcObject, size_t location, UNIQUE_VALIDATION_ERROR_CODE msgCode, const char *pLayerPrefix,
+                           const char *format, ...) __attribute__((format(printf, 8, 9)));
 #endif
 static inline bool log_msg(const debug_report_data *debug_data, VkFlags msgFlags, VkDebugReportObjectTypeEXT objectType,
                            uint64_t srcObject, size_t location, int32_t msgCode, const char *pLayerPrefix, const char *format,
@@ -339,15 +503,26 @@ static inline bool log_msg(const debug_report_data *debug_data, VkFlags msgFlags
 
     va_list argptr;
     va_start(argptr, format);
-    char *str;
-    if (-1 == vasprintf(&str, format, argptr)) {
-        // On failure, glibc vasprintf leaves str undefined
-        str = nullptr;
+    bool result =
+        debug_report_vlog_msg(debug_data, msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix, format, argptr);
+    va_end(argptr);
+    return result;
+}
+
+// Validation errors can also be disabled individually through the layer settings
+static inline bool log_msg(const debug_report_data *debug_data, VkFlags msgFlags, VkDebugReportObjectTypeEXT objectType,
+                           uint64_t srcObject, size_t location, UNIQUE_VALIDATION_ERROR_CODE msgCode, const char *pLayerPrefix,
+                           const char *format, ...) {
+    if (!debug_data || !(debug_data->active_flags & msgFlags) || debug_report_validation_error_disabled(debug_data, msgCode)) {
+        // Message is not wanted
+        return false;
     }
+
+    va_list argptr;
+    va_start(argptr, format);
+    bool result =
+        debug_report_vlog_msg(debug_data, msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix, format, argptr);
     va_end(argptr);
-    bool result = debug_report_log_msg(debug_data, msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix,
-                                       str ? str : "Allocation failure");
-    free(str);
     return result;
 }
 
@@ -365,6 +540,24 @@ static inline VKAPI_ATTR VkBool32 VKAPI_CALL log_callback(VkFlags msgFlags, VkDe
     return false;
 }
 
+// LOG_MSG callback used when log_async is set: formats on the reporting thread and leaves the I/O to an AsyncLogWriter
+static inline VKAPI_ATTR VkBool32 VKAPI_CALL async_log_callback(VkFlags msgFlags, VkDebugReportObjectTypeEXT objType,
+                                                                uint64_t srcObject, size_t location, int32_t msgCode,
+                                                                const char *pLayerPrefix, const char *pMsg, void *pUserData) {
+    char msg_flags[30];
+
+    print_msg_flags(msgFlags, msg_flags);
+
+    const char *line_format = "%s(%s): object: 0x%" PRIx64 " type: %d location: %lu msgCode: %d: %s\n";
+    int size = snprintf(nullptr, 0, line_format, pLayerPrefix, msg_flags, srcObject, objType, (unsigned long)location, msgCode, pMsg);
+    if (size < 0) return false;
+    std::string line(size, '\0');
+    snprintf(&line[0], size + 1, line_format, pLayerPrefix, msg_flags, srcObject, objType, (unsigned long)location, msgCode, pMsg);
+    reinterpret_cast<AsyncLogWriter *>(pUserData)->Push(std::move(line));
+
+    return false;
+}
+
 static inline VKAPI_ATTR VkBool32 VKAPI_CALL win32_debug_output_msg(VkFlags msgFlags, VkDebugReportObjectTypeEXT objType,
                                                                     uint64_t srcObject, size_t location, int32_t msgCode,
                                                                     const char *pLayerPrefix, const char *pMsg, void *pUserData) {
@@ -0,0 +1,431 @@
+/* Copyright (c) 2015-2017 The Khronos Group Inc.
+ * Copyright (c) 2015-2017 Valve Corporation
+ * Copyright (c) 2015-2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef LAYER_STATS_H
+#define LAYER_STATS_H
+
+// Opt-in per-layer call statistics.
+//
+// Each layer that includes this header gets its own LayerStats instance (see GetLayerStats()). When enabled through
+// <LayerIdentifier>.call_statistics = true in vk_layer_settings.txt, instrumented entry points record call counts,
+// inclusive and self time, and a log2 latency histogram into thread-local counters. Mutexes declared as LayerStatsMutex
+// also record how long callers waited for them. A thread's counters are folded into shared totals and freed when it exits.
+// The counters of all threads are merged when the statistics are dumped as JSON, either at vkDestroyInstance or after the
+// process receives SIGUSR1 (non-Windows). Every dump holds the totals since the layer was enabled; the first one in a
+// process truncates the output file and later ones, such as those of further instances, are appended to it.
+//
+// Instrumenting an entry point:
+//     LAYER_STATS_CALL("vkCmdDraw");
+//     ... validation ...
+//     layer_stats_call.Pause();
+//     dispatch_table.CmdDraw(...);
+//     layer_stats_call.Resume();
+
+#include "vk_layer_config.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <memory>
+#include <mutex>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+#if !defined(_WIN32)
+#include <signal.h>
+#endif
+
+// Timestamps in the cheapest monotonic unit available: the TSC on x86, nanoseconds elsewhere
+static inline uint64_t LayerStatsTicks() {
+#if defined(_MSC_VER) || defined(__i386__) || defined(__x86_64__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+class LayerStats {
+   public:
+    static const uint32_t kMaxEntryPoints = 256;
+    static const uint32_t kMaxLocks = 8;
+    static const uint32_t kHistogramBuckets = 32;  // Bucket i counts calls taking [2^i, 2^(i+1)) ticks
+
+    // Counters are only written by their owning thread; relaxed atomics let the dump read them without tearing
+    struct CallCounters {
+        std::atomic<uint64_t> calls;
+        std::atomic<uint64_t> total_ticks;
+        std::atomic<uint64_t> self_ticks;
+        std::atomic<uint64_t> histogram[kHistogramBuckets];
+    };
+    struct LockCounters {
+        std::atomic<uint64_t> acquisitions;
+        std::atomic<uint64_t> contended;
+        std::atomic<uint64_t> wait_ticks;
+    };
+    struct ThreadCounters {
+        CallCounters calls[kMaxEntryPoints];
+        LockCounters locks[kMaxLocks];
+        uint64_t *child_ticks;  // Ticks spent in nested scopes of the innermost running LayerStatsCallTimer
+    };
+
+    LayerStats() : enabled_(false), dump_requested_(false), dump_count_(0), entry_point_count_(0), lock_count_(0), retired_() {}
+
+    ~LayerStats() {
+        RemoveDumpSignalTarget();
+        for (auto counters : threads_) delete counters;
+    }
+
+    bool Enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    // Read <layer_identifier>.call_statistics and .call_statistics_file when an instance is created; later instances keep
+    // counting into the same totals
+    void Init(const char *layer_identifier) {
+        if (Enabled()) return;
+        std::string enable_key = layer_identifier;
+        std::string file_key = layer_identifier;
+        enable_key.append(".call_statistics");
+        file_key.append(".call_statistics_file");
+        if (strcmp(getLayerOption(enable_key.c_str()), "true") != 0) return;
+
+        std::lock_guard<std::mutex> lock(lock_);
+        layer_identifier_ = layer_identifier;
+        output_filename_ = getLayerOption(file_key.c_str());
+        start_ticks_ = LayerStatsTicks();
+        start_time_ = std::chrono::steady_clock::now();
+        InstallDumpSignal();
+        enabled_.store(true, std::memory_order_relaxed);
+    }
+
+    // Entry points and locks register once, typically through a function-local static
+    uint32_t RegisterEntryPoint(const char *name) {
+        return Register(name, entry_point_names_, entry_point_count_, kMaxEntryPoints);
+    }
+    uint32_t RegisterLock(const char *name) { return Register(name, lock_names_, lock_count_, kMaxLocks); }
+
+    ThreadCounters *GetThreadCounters() {
+        static thread_local ThreadCountersOwner owner;
+        if (!owner.counters) {
+            owner.stats = this;
+            owner.counters = new ThreadCounters();
+            std::lock_guard<std::mutex> lock(lock_);
+            threads_.push_back(owner.counters);
+        }
+        return owner.counters;
+    }
+
+    // Dump now if a SIGUSR1 arrived since the last check
+    void DumpIfRequested() {
+        if (dump_requested_.load(std::memory_order_relaxed) && dump_requested_.exchange(false)) DumpJson();
+    }
+
+    void DumpJson() {
+        if (!Enabled()) return;
+        std::lock_guard<std::mutex> lock(lock_);
+        FILE *output = stdout;
+        if (!output_filename_.empty() && output_filename_ != "stdout") {
+            output = fopen(output_filename_.c_str(), dump_count_ ? "a" : "w");
+            if (!output) output = stdout;
+        }
+
+        const double elapsed_ns = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time_).count());
+        const uint64_t elapsed_ticks = LayerStatsTicks() - start_ticks_;
+        const double ns_per_tick = elapsed_ticks ? elapsed_ns / elapsed_ticks : 1.0;
+
+        ++dump_count_;
+        fprintf(output, "{\n  \"layer\": \"%s\",\n  \"dump\": %u,\n  \"ns_per_tick\": %.6f,\n  \"entry_points\": [",
+                layer_identifier_.c_str(), dump_count_, ns_per_tick);
+        const char *separator = "";
+        for (uint32_t i = 0; i < entry_point_count_.load(); ++i) {
+            uint64_t calls = 0, total_ticks = 0, self_ticks = 0;
+            uint64_t histogram[kHistogramBuckets] = {};
+            for (auto counters : AllCounters()) {
+                const CallCounters &call = counters->calls[i];
+                calls += call.calls.load(std::memory_order_relaxed);
+                total_ticks += call.total_ticks.load(std::memory_order_relaxed);
+                self_ticks += call.self_ticks.load(std::memory_order_relaxed);
+                for (uint32_t bucket = 0; bucket < kHistogramBuckets; ++bucket) {
+                    histogram[bucket] += call.histogram[bucket].load(std::memory_order_relaxed);
+                }
+            }
+            if (!calls) continue;
+            fprintf(output,
+                    "%s\n    {\"name\": \"%s\", \"calls\": %" PRIu64 ", \"total_ticks\": %" PRIu64 ", \"self_ticks\": %" PRIu64
+                    ", \"histogram_log2_ticks\": [",
+                    separator, entry_point_names_[i], calls, total_ticks, self_ticks);
+            uint32_t last_bucket = kHistogramBuckets;
+            while (last_bucket > 1 && !histogram[last_bucket - 1]) --last_bucket;
+            for (uint32_t bucket = 0; bucket < last_bucket; ++bucket) {
+                fprintf(output, "%s%" PRIu64, bucket ? ", " : "", histogram[bucket]);
+            }
+            fprintf(output, "]}");
+            separator = ",";
+        }
+        fprintf(output, "\n  ],\n  \"locks\": [");
+        separator = "";
+        for (uint32_t i = 0; i < lock_count_.load(); ++i) {
+            uint64_t acquisitions = 0, contended = 0, wait_ticks = 0;
+            for (auto counters : AllCounters()) {
+                acquisitions += counters->locks[i].acquisitions.load(std::memory_order_relaxed);
+                contended += counters->locks[i].contended.load(std::memory_order_relaxed);
+                wait_ticks += counters->locks[i].wait_ticks.load(std::memory_order_relaxed);
+            }
+            fprintf(output,
+                    "%s\n    {\"name\": \"%s\", \"acquisitions\": %" PRIu64 ", \"contended\": %" PRIu64
+                    ", \"wait_ticks\": %" PRIu64 "}",
+                    separator, lock_names_[i], acquisitions, contended, wait_ticks);
+            separator = ",";
+        }
+        fprintf(output, "\n  ]\n}\n");
+        if (output != stdout) {
+            fclose(output);
+        } else {
+            fflush(output);
+        }
+    }
+
+    static void Add(std::atomic<uint64_t> &counter, uint64_t value) {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    static uint32_t HistogramBucket(uint64_t ticks) {
+        uint32_t bucket = 0;
+        while (ticks > 1 && bucket < kHistogramBuckets - 1) {
+            ticks >>= 1;
+            ++bucket;
+        }
+        return bucket;
+    }
+
+   private:
+    // Frees a thread's counters when it exits, after adding them to retired_
+    struct ThreadCountersOwner {
+        LayerStats *stats = nullptr;
+        ThreadCounters *counters = nullptr;
+        ~ThreadCountersOwner() {
+            if (counters) stats->RetireThreadCounters(counters);
+        }
+    };
+
+    void RetireThreadCounters(ThreadCounters *counters) {
+        std::lock_guard<std::mutex> lock(lock_);
+        for (uint32_t i = 0; i < kMaxEntryPoints; ++i) {
+            CallCounters &total = retired_.calls[i];
+            const CallCounters &call = counters->calls[i];
+            Add(total.calls, call.calls.load(std::memory_order_relaxed));
+            Add(total.total_ticks, call.total_ticks.load(std::memory_order_relaxed));
+            Add(total.self_ticks, call.self_ticks.load(std::memory_order_relaxed));
+            for (uint32_t bucket = 0; bucket < kHistogramBuckets; ++bucket) {
+                Add(total.histogram[bucket], call.histogram[bucket].load(std::memory_order_relaxed));
+            }
+        }
+        for (uint32_t i = 0; i < kMaxLocks; ++i) {
+            Add(retired_.locks[i].acquisitions, counters->locks[i].acquisitions.load(std::memory_order_relaxed));
+            Add(retired_.locks[i].contended, counters->locks[i].contended.load(std::memory_order_relaxed));
+            Add(retired_.locks[i].wait_ticks, counters->locks[i].wait_ticks.load(std::memory_order_relaxed));
+        }
+        threads_.erase(std::find(threads_.begin(), threads_.end(), counters));
+        delete counters;
+    }
+
+    // Counters of live threads and the totals of exited ones; lock_ must be held
+    std::vector<const ThreadCounters *> AllCounters() const {
+        std::vector<const ThreadCounters *> counters(threads_.begin(), threads_.end());
+        counters.push_back(&retired_);
+        return counters;
+    }
+
+    uint32_t Register(const char *name, const char **names, std::atomic<uint32_t> &count, uint32_t max_count) {
+        std::lock_guard<std::mutex> lock(lock_);
+        const uint32_t current = count.load();
+        for (uint32_t i = 0; i < current; ++i) {
+            if (strcmp(names[i], name) == 0) return i;
+        }
+        // Once full, further names share the last slot rather than overflowing the per-thread arrays
+        if (current == max_count) return max_count - 1;
+        names[current] = name;
+        count.store(current + 1);
+        return current;
+    }
+
+#if !defined(_WIN32)
+    // The signal handler only walks this fixed array of atomic pointers, which is async-signal-safe and can't be reallocated
+    // under it by a concurrent InstallDumpSignal. There is normally one LayerStats per layer library.
+    static const uint32_t kMaxSignalTargets = 8;
+    static std::atomic<LayerStats *> *SignalTargets() {
+        static std::atomic<LayerStats *> targets[kMaxSignalTargets];
+        return targets;
+    }
+    static std::atomic<bool> &SignalInstalled() {
+        static std::atomic<bool> installed(false);
+        return installed;
+    }
+    static struct sigaction &PreviousAction() {
+        static struct sigaction previous;
+        return previous;
+    }
+    static void OnDumpSignal(int signal_number) {
+        std::atomic<LayerStats *> *targets = SignalTargets();
+        for (uint32_t i = 0; i < kMaxSignalTargets; ++i) {
+            LayerStats *stats = targets[i].load();
+            if (stats) stats->dump_requested_.store(true);
+        }
+        // Chain to whatever handler was installed before, such as another layer's
+        const struct sigaction &previous = PreviousAction();
+        if (!(previous.sa_flags & SA_SIGINFO) && previous.sa_handler != SIG_DFL && previous.sa_handler != SIG_IGN) {
+            previous.sa_handler(signal_number);
+        }
+    }
+    void InstallDumpSignal() {
+        std::atomic<LayerStats *> *targets = SignalTargets();
+        for (uint32_t i = 0; i < kMaxSignalTargets; ++i) {
+            LayerStats *expected = nullptr;
+            if (targets[i].load() == this || targets[i].compare_exchange_strong(expected, this)) break;
+        }
+        if (!SignalInstalled().exchange(true)) {
+            struct sigaction action;
+            memset(&action, 0, sizeof(action));
+            action.sa_handler = OnDumpSignal;
+            sigemptyset(&action.sa_mask);
+            action.sa_flags = SA_RESTART;
+            sigaction(SIGUSR1, &action, &PreviousAction());
+        }
+    }
+    void RemoveDumpSignalTarget() {
+        std::atomic<LayerStats *> *targets = SignalTargets();
+        for (uint32_t i = 0; i < kMaxSignalTargets; ++i) {
+            LayerStats *expected = this;
+            targets[i].compare_exchange_strong(expected, nullptr);
+        }
+    }
+#else
+    void InstallDumpSignal() {}
+    void RemoveDumpSignalTarget() {}
+#endif
+
+    std::atomic<bool> enabled_;
+    std::atomic<bool> dump_requested_;
+    std::mutex lock_;
+    std::string layer_identifier_;
+    std::string output_filename_;
+    uint32_t dump_count_;  // Guarded by lock_
+    uint64_t start_ticks_;
+    std::chrono::steady_clock::time_point start_time_;
+    const char *entry_point_names_[kMaxEntryPoints];
+    std::atomic<uint32_t> entry_point_count_;
+    const char *lock_names_[kMaxLocks];
+    std::atomic<uint32_t> lock_count_;
+    std::vector<ThreadCounters *> threads_;
+    ThreadCounters retired_;
+};
+
+// The statistics of the layer including this header
+static inline LayerStats &GetLayerStats() {
+    static LayerStats stats;
+    return stats;
+}
+
+// Times one call of an entry point. Time spent in nested timers and between Pause() and Resume(), which bracket the call
+// down the dispatch chain, is excluded from self time so the next layers' and the driver's work is not charged here.
+class LayerStatsCallTimer {
+   public:
+    explicit LayerStatsCallTimer(uint32_t entry_point) : counters_(nullptr) {
+        LayerStats &stats = GetLayerStats();
+        if (!stats.Enabled()) return;
+        counters_ = stats.GetThreadCounters();
+        entry_point_ = entry_point;
+        child_ticks_ = 0;
+        parent_child_ticks_ = counters_->child_ticks;
+        counters_->child_ticks = &child_ticks_;
+        start_ = LayerStatsTicks();
+    }
+
+    ~LayerStatsCallTimer() {
+        if (!counters_) return;
+        const uint64_t elapsed = LayerStatsTicks() - start_;
+        LayerStats::CallCounters &call = counters_->calls[entry_point_];
+        LayerStats::Add(call.calls, 1);
+        LayerStats::Add(call.total_ticks, elapsed);
+        LayerStats::Add(call.self_ticks, elapsed > child_ticks_ ? elapsed - child_ticks_ : 0);
+        LayerStats::Add(call.histogram[LayerStats::HistogramBucket(elapsed)], 1);
+        counters_->child_ticks = parent_child_ticks_;
+        if (parent_child_ticks_) *parent_child_ticks_ += elapsed;
+        GetLayerStats().DumpIfRequested();
+    }
+
+    void Pause() {
+        if (counters_) pause_start_ = LayerStatsTicks();
+    }
+
+    void Resume() {
+        if (counters_) child_ticks_ += LayerStatsTicks() - pause_start_;
+    }
+
+   private:
+    LayerStats::ThreadCounters *counters_;
+    uint32_t entry_point_;
+    uint64_t start_;
+    uint64_t pause_start_;
+    uint64_t child_ticks_;
+    uint64_t *parent_child_ticks_;
+};
+
+// std::mutex replacement that records how often and how long lockers had to wait
+class LayerStatsMutex {
+   public:
+    explicit LayerStatsMutex(const char *name) : name_(name), id_(UINT32_MAX) {}
+
+    void lock() {
+        LayerStats &stats = GetLayerStats();
+        if (!stats.Enabled()) {
+            mutex_.lock();
+            return;
+        }
+        if (id_ == UINT32_MAX) id_ = stats.RegisterLock(name_);
+        LayerStats::LockCounters &counters = stats.GetThreadCounters()->locks[id_];
+        LayerStats::Add(counters.acquisitions, 1);
+        if (mutex_.try_lock()) return;
+        const uint64_t start = LayerStatsTicks();
+        mutex_.lock();
+        LayerStats::Add(counters.contended, 1);
+        LayerStats::Add(counters.wait_ticks, LayerStatsTicks() - start);
+    }
+
+    bool try_lock() { return mutex_.try_lock(); }
+    void unlock() { mutex_.unlock(); }
+
+   private:
+    std::mutex mutex_;
+    const char *name_;
+    std::atomic<uint32_t> id_;
+};
+
+// Time the rest of the enclosing scope as one call of the named entry point, through a timer named layer_stats_call
+#define LAYER_STATS_CALL(name)                                                                \
+    static const uint32_t layer_stats_entry_point = GetLayerStats().RegisterEntryPoint(name); \
+    LayerStatsCallTimer layer_stats_call(layer_stats_entry_point)
+
+#endif  // LAYER_STATS_H
@@ -19,6 +19,7 @@
  *
  */
 
+#include <stdlib.h>
 #include <string.h>
 #include <string>
 #include <vector>
@@ -80,6 +81,28 @@ VK_LAYER_EXPORT bool white_list(const char *item, const char *list) {
     return (white_list.find(candidate) != std::string::npos);
 }
 
+// Parse a comma-delineated list of VALIDATION_ERROR_<n> names into the report_data set of disabled validation errors.
+// Other layer msgCode enums reuse the same numbers, so bare numbers are ignored.
+static void SetDisabledMessageCodes(debug_report_data *report_data, const char *code_list) {
+    static const char validation_error_prefix[] = "VALIDATION_ERROR_";
+    const char *option = code_list;
+    while (*option) {
+        while (*option == ',' || *option == ' ') option++;
+        if (!*option) break;
+        if (strncmp(option, validation_error_prefix, sizeof(validation_error_prefix) - 1) == 0) {
+            option += sizeof(validation_error_prefix) - 1;
+            // The names are decimal with leading zeros
+            char *option_end = nullptr;
+            long code = strtol(option, &option_end, 10);
+            if (option_end != option && code >= 0 && code <= INT32_MAX) {
+                report_data->disabled_validation_errors.insert(static_cast<int32_t>(code));
+            }
+            option = option_end;
+        }
+        while (*option && *option != ',') option++;
+    }
+}
+
 // Debug callbacks get created in three ways:
 //   o  Application-defined debug callbacks
 //   o  Through settings in a vk_layer_settings.txt file
@@ -98,9 +121,19 @@ VK_LAYER_EXPORT void layer_debug_actions(debug_report_data *report_data, std::ve
     std::string report_flags_key = layer_identifier;
     std::string debug_action_key = layer_identifier;
     std::string log_filename_key = layer_identifier;
+    std::string duplicate_limit_key = layer_identifier;
+    std::string message_summary_key = layer_identifier;
+    std::string log_async_key = layer_identifier;
+    std::string log_queue_size_key = layer_identifier;
+    std::string disabled_codes_key = layer_identifier;
     report_flags_key.append(".report_flags");
     debug_action_key.append(".debug_action");
     log_filename_key.append(".log_filename");
+    duplicate_limit_key.append(".duplicate_message_limit");
+    message_summary_key.append(".message_summary");
+    log_async_key.append(".log_async");
+    log_queue_size_key.append(".log_queue_size");
+    disabled_codes_key.append(".disabled_message_codes");
 
     // Initialize layer options
     VkDebugReportFlagsEXT report_flags = GetLayerOptionFlags(report_flags_key, report_flags_option_definitions, 0);
@@ -108,6 +141,10 @@ VK_LAYER_EXPORT void layer_debug_actions(debug_report_data *report_data, std::ve
     // Flag as default if these settings are not from a vk_layer_settings.txt file
     bool default_layer_callback = (debug_action & VK_DBG_LAYER_ACTION_DEFAULT) ? true : false;
 
+    report_data->duplicate_message_limit = static_cast<uint32_t>(strtoul(getLayerOption(duplicate_limit_key.c_str()), NULL, 0));
+    report_data->message_summary = (strcmp(getLayerOption(message_summary_key.c_str()), "true") == 0);
+    SetDisabledMessageCodes(report_data, getLayerOption(disabled_codes_key.c_str()));
+
     if (debug_action & VK_DBG_LAYER_ACTION_LOG_MSG) {
         const char *log_filename = getLayerOption(log_filename_key.c_str());
         FILE *log_output = getLayerLogOutput(log_filename, layer_identifier);
@@ -115,8 +152,16 @@ VK_LAYER_EXPORT void layer_debug_actions(debug_report_data *report_data, std::ve
         memset(&dbgCreateInfo, 0, sizeof(dbgCreateInfo));
         dbgCreateInfo.sType = VK_STRUCTURE_TYPE_DEBUG_REPORT_CREATE_INFO_EXT;
         dbgCreateInfo.flags = report_flags;
-        dbgCreateInfo.pfnCallback = log_callback;
-        dbgCreateInfo.pUserData = (void *)log_output;
+        if (strcmp(getLayerOption(log_async_key.c_str()), "true") == 0) {
+            size_t queue_size = strtoul(getLayerOption(log_queue_size_key.c_str()), NULL, 0);
+            AsyncLogWriter *writer = new AsyncLogWriter(log_output, queue_size ? queue_size : 1024);
+            report_data->async_log_writers.push_back(writer);
+            dbgCreateInfo.pfnCallback = async_log_callback;
+            dbgCreateInfo.pUserData = (void *)writer;
+        } else {
+            dbgCreateInfo.pfnCallback = log_callback;
+            dbgCreateInfo.pUserData = (void *)log_output;
+        }
         layer_create_msg_callback(report_data, default_layer_callback, &dbgCreateInfo, pAllocator, &callback);
         logging_callback.push_back(callback);
     }
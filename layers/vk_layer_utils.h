@@ -65,3 +65,16 @@ static inline int u_ffs(int val) {
 #ifdef __cplusplus
 }
 #endif
+
+#ifdef __cplusplus
+#include <algorithm>
+#include <string.h>
+
+// Find name in a table of {name, ...} entries sorted in strcmp() order, such as the generated procmap intercept tables
+template <typename Entry, size_t N>
+const Entry *util_FindEntryByName(const Entry (&table)[N], const char *name) {
+    const Entry *entry =
+        std::lower_bound(table, table + N, name, [](const Entry &entry, const char *key) { return strcmp(entry.name, key) < 0; });
+    return (entry != table + N && !strcmp(entry->name, name)) ? entry : nullptr;
+}
+#endif
@@ -32,7 +32,7 @@
 //  Corresponding validation error message for each enum is given in the mapping table below
 //  When a given error occurs, these enum values should be passed to the as the messageCode
 //  parameter to the PFN_vkDebugReportCallbackEXT function
-enum UNIQUE_VALIDATION_ERROR_CODE {
+enum UNIQUE_VALIDATION_ERROR_CODE : int {
     VALIDATION_ERROR_UNDEFINED = -1,
     VALIDATION_ERROR_00000 = 0,
     VALIDATION_ERROR_00001 = 1,
@@ -145,7 +145,7 @@ class ValidationHeader:
         with open(self.filename, "r") as infile:
             for line in infile:
                 line = line.strip()
-                if 'enum UNIQUE_VALIDATION_ERROR_CODE {' in line:
+                if line.startswith('enum UNIQUE_VALIDATION_ERROR_CODE'):
                     grab_enums = True
                     continue
                 if grab_enums:
@@ -22,6 +22,7 @@
  */
 #include "vk_layer_data.h"
 #include "vk_layer_extension_utils.h"
+#include "vk_layer_stats.h"
 #include "vk_layer_table.h"
 #include <assert.h>
 #include <stdlib.h>
@@ -63,9 +64,9 @@ struct layer_data {
     int frame;
 };
 
-static std::unordered_map<void *, layer_data *> layer_data_map;
+static LayerDataMap<layer_data> layer_data_map;
 
-template layer_data *GetLayerDataPtr<layer_data>(void *data_key, std::unordered_map<void *, layer_data *> &data_map);
+template layer_data *GetLayerDataPtr<layer_data>(void *data_key, LayerDataMap<layer_data> &data_map);
 
 VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateDevice(VkPhysicalDevice gpu, const VkDeviceCreateInfo *pCreateInfo,
                                                               const VkAllocationCallbacks *pAllocator, VkDevice *pDevice) {
@@ -145,6 +146,7 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstance
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(*pInstance), layer_data_map);
     my_data->instance_dispatch_table = new VkLayerInstanceDispatchTable;
     layer_init_instance_dispatch_table(*pInstance, my_data->instance_dispatch_table, fpGetInstanceProcAddr);
+    GetLayerStats().Init("lunarg_monitor");
 
     return result;
 }
@@ -155,10 +157,12 @@ VK_LAYER_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyInstance(VkInstance instance
     VkLayerInstanceDispatchTable *pTable = my_data->instance_dispatch_table;
     pTable->DestroyInstance(instance, pAllocator);
     delete pTable;
+    GetLayerStats().DumpJson();
     layer_data_map.erase(key);
 }
 
 VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo) {
+    LAYER_STATS_CALL("vkQueuePresentKHR");
     layer_data *my_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
 
     time_t now;
@@ -187,7 +191,9 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkQueuePresentKHR(VkQueue queue,
     }
     my_data->frame++;
 
+    layer_stats_call.Pause();
     VkResult result = my_data->pfnQueuePresentKHR(queue, pPresentInfo);
+    layer_stats_call.Resume();
     return result;
 }
 
@@ -40,6 +40,7 @@ using namespace std;
 #include "vk_layer_config.h"
 #include "vk_layer_table.h"
 #include "vk_layer_extension_utils.h"
+#include "vk_layer_stats.h"
 #include "vk_layer_utils.h"
 
 #include "screenshot_parsing.h"
@@ -930,6 +931,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     initInstanceTable(*pInstance, fpGetInstanceProcAddr);
 
     init_screenshot();
+    GetLayerStats().Init("lunarg_screenshot");
 
     return result;
 }
@@ -1019,6 +1021,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     VkLayerDispatchTable *pDisp = devMap->device_dispatch_table;
     pDisp->DestroyDevice(device, pAllocator);
 
+    // Without a DestroyInstance hook, the call statistics are dumped here
+    GetLayerStats().DumpJson();
+
     local_free_getenv(vk_screenshot_format);
     loader_platform_thread_lock_mutex(&globalLock);
     delete pDisp;
@@ -1094,6 +1099,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(VkDevice device, VkCommandPool com
 
 VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR *pCreateInfo,
                                                   const VkAllocationCallbacks *pAllocator, VkSwapchainKHR *pSwapchain) {
+    LAYER_STATS_CALL("vkCreateSwapchainKHR");
     DeviceMapStruct *devMap = get_dev_info(device);
     assert(devMap);
     VkLayerDispatchTable *pDisp = devMap->device_dispatch_table;
@@ -1102,7 +1108,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(VkDevice device, const VkSwapc
     // transfer src bit to be on.
     VkSwapchainCreateInfoKHR myCreateInfo = *pCreateInfo;
     myCreateInfo.imageUsage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    layer_stats_call.Pause();
     VkResult result = pDisp->CreateSwapchainKHR(device, &myCreateInfo, pAllocator, pSwapchain);
+    layer_stats_call.Resume();
 
     // Save the swapchain in a map of we are taking screenshots.
     loader_platform_thread_lock_mutex(&globalLock);
@@ -1132,10 +1140,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(VkDevice device, const VkSwapc
 
 VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t *pCount,
                                                      VkImage *pSwapchainImages) {
+    LAYER_STATS_CALL("vkGetSwapchainImagesKHR");
     DeviceMapStruct *devMap = get_dev_info(device);
     assert(devMap);
     VkLayerDispatchTable *pDisp = devMap->device_dispatch_table;
+    layer_stats_call.Pause();
     VkResult result = pDisp->GetSwapchainImagesKHR(device, swapchain, pCount, pSwapchainImages);
+    layer_stats_call.Resume();
 
     // Save the swapchain images in a map if we are taking screenshots
     loader_platform_thread_lock_mutex(&globalLock);
@@ -1175,6 +1186,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(VkDevice device, VkSwapchai
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo) {
+    LAYER_STATS_CALL("vkQueuePresentKHR");
     static int frameNumber = 0;
     if (frameNumber == 10) {
         fflush(stdout); /* *((int*)0)=0; */
@@ -1182,7 +1194,9 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInf
     DeviceMapStruct *devMap = get_dev_info((VkDevice)queue);
     assert(devMap);
     VkLayerDispatchTable *pDisp = devMap->device_dispatch_table;
+    layer_stats_call.Pause();
     VkResult result = pDisp->QueuePresentKHR(queue, pPresentInfo);
+    layer_stats_call.Resume();
     loader_platform_thread_lock_mutex(&globalLock);
 
     if (!screenshotFramesReceived) {
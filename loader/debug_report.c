@@ -112,6 +112,15 @@ VkBool32 util_DebugReportMessage(const struct loader_instance *inst, VkFlags msg
     return bail;
 }
 
+bool util_DebugReportWantsMessage(const struct loader_instance *inst, VkFlags msgFlags) {
+    for (const VkLayerDbgFunctionNode *pTrav = inst->DbgFunctionHead; pTrav; pTrav = pTrav->pNext) {
+        if (pTrav->msgFlags & msgFlags) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void util_DestroyDebugReportCallback(struct loader_instance *inst, VkDebugReportCallbackEXT callback,
                                      const VkAllocationCallbacks *pAllocator) {
     VkLayerDbgFunctionNode *pTrav = inst->DbgFunctionHead;
@@ -136,3 +136,6 @@ void util_DestroyDebugReportCallbacks(struct loader_instance *inst, const VkAllo
 
 VkBool32 util_DebugReportMessage(const struct loader_instance *inst, VkFlags msgFlags, VkDebugReportObjectTypeEXT objectType,
                                  uint64_t srcObject, size_t location, int32_t msgCode, const char *pLayerPrefix, const char *pMsg);
+
+// Whether any callback registered on inst would receive a message with msgFlags
+bool util_DebugReportWantsMessage(const struct loader_instance *inst, VkFlags msgFlags);
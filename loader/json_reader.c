@@ -0,0 +1,419 @@
+/*
+ * Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <string.h>
+
+#include "json_reader.h"
+
+// What the reader consumed last, which decides what may come next
+enum json_reader_state {
+    JSON_READER_STATE_START = 0,  // Nothing yet, or the opening brace or bracket
+    JSON_READER_STATE_VALUE,      // A complete value
+    JSON_READER_STATE_COMMA,      // A comma between array elements or object members
+    JSON_READER_STATE_COLON,      // The colon after an object key
+};
+
+// Manifests nest only a few levels deep; this just bounds the recursion in skip
+#define JSON_READER_MAX_DEPTH 64
+
+static inline bool json_reader_at_end(const struct json_reader *reader) {
+    return reader->pos >= reader->end || *reader->pos == '\0';
+}
+
+static inline bool json_reader_fail(struct json_reader *reader) {
+    reader->failed = true;
+    return false;
+}
+
+// Like cJSON, treat every control character as whitespace
+static void json_reader_skip_whitespace(struct json_reader *reader) {
+    while (!json_reader_at_end(reader) && (unsigned char)*reader->pos <= ' ') {
+        reader->pos++;
+    }
+}
+
+static inline char json_reader_char(const struct json_reader *reader) { return json_reader_at_end(reader) ? '\0' : *reader->pos; }
+
+static int json_reader_hex_value(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static bool json_reader_read_hex4(struct json_reader *reader, unsigned *code) {
+    *code = 0;
+    for (int i = 0; i < 4; i++) {
+        int digit = json_reader_at_end(reader) ? -1 : json_reader_hex_value(*reader->pos);
+        if (digit < 0) {
+            return json_reader_fail(reader);
+        }
+        *code = (*code << 4) | (unsigned)digit;
+        reader->pos++;
+    }
+    return true;
+}
+
+// Append bytes to dst if they fit whole; *used counts bytes written so far.
+// The first sequence that doesn't fit shrinks *dst_size to what is used, so a
+// truncated string is always a prefix of the full one.
+static void json_reader_append(char *dst, size_t *dst_size, size_t *used, const char *bytes, size_t count) {
+    if (dst == NULL) {
+        return;
+    }
+    if (*used + count < *dst_size) {
+        memcpy(dst + *used, bytes, count);
+        *used += count;
+    } else if (*dst_size > 0) {
+        *dst_size = *used + 1;
+    }
+}
+
+// Consume a string, starting at its opening quote, unescaping it into dst if
+// dst is not NULL
+static bool json_reader_scan_string(struct json_reader *reader, char *dst, size_t dst_size) {
+    size_t used = 0;
+
+    reader->pos++;
+    for (;;) {
+        if (json_reader_at_end(reader)) {
+            return json_reader_fail(reader);
+        }
+        char c = *reader->pos++;
+        if (c == '"') {
+            break;
+        }
+        if (c != '\\') {
+            json_reader_append(dst, &dst_size, &used, &c, 1);
+            continue;
+        }
+        if (json_reader_at_end(reader)) {
+            return json_reader_fail(reader);
+        }
+        c = *reader->pos++;
+        switch (c) {
+            case 'b':
+                c = '\b';
+                break;
+            case 'f':
+                c = '\f';
+                break;
+            case 'n':
+                c = '\n';
+                break;
+            case 'r':
+                c = '\r';
+                break;
+            case 't':
+                c = '\t';
+                break;
+            case 'u': {
+                unsigned code;
+                if (!json_reader_read_hex4(reader, &code)) {
+                    return false;
+                }
+                // A high surrogate must be followed by an escaped low surrogate
+                if (code >= 0xD800 && code <= 0xDBFF) {
+                    unsigned low;
+                    if (reader->end - reader->pos < 2 || reader->pos[0] != '\\' || reader->pos[1] != 'u') {
+                        return json_reader_fail(reader);
+                    }
+                    reader->pos += 2;
+                    if (!json_reader_read_hex4(reader, &low) || low < 0xDC00 || low > 0xDFFF) {
+                        return json_reader_fail(reader);
+                    }
+                    code = 0x10000 + (((code & 0x3FF) << 10) | (low & 0x3FF));
+                }
+                char utf8[4];
+                size_t count;
+                if (code < 0x80) {
+                    utf8[0] = (char)code;
+                    count = 1;
+                } else if (code < 0x800) {
+                    utf8[0] = (char)(0xC0 | (code >> 6));
+                    utf8[1] = (char)(0x80 | (code & 0x3F));
+                    count = 2;
+                } else if (code < 0x10000) {
+                    utf8[0] = (char)(0xE0 | (code >> 12));
+                    utf8[1] = (char)(0x80 | ((code >> 6) & 0x3F));
+                    utf8[2] = (char)(0x80 | (code & 0x3F));
+                    count = 3;
+                } else {
+                    utf8[0] = (char)(0xF0 | (code >> 18));
+                    utf8[1] = (char)(0x80 | ((code >> 12) & 0x3F));
+                    utf8[2] = (char)(0x80 | ((code >> 6) & 0x3F));
+                    utf8[3] = (char)(0x80 | (code & 0x3F));
+                    count = 4;
+                }
+                json_reader_append(dst, &dst_size, &used, utf8, count);
+                continue;
+            }
+            default:
+                // '"', '\\' and '/' stand for themselves
+                break;
+        }
+        json_reader_append(dst, &dst_size, &used, &c, 1);
+    }
+    if (dst != NULL && dst_size > 0) {
+        dst[used] = '\0';
+    }
+    reader->state = JSON_READER_STATE_VALUE;
+    return true;
+}
+
+// Consume a number or literal, returning where its text starts
+static bool json_reader_scan_scalar(struct json_reader *reader, const char **text, size_t *len) {
+    const char *start = reader->pos;
+    char c = json_reader_char(reader);
+
+    if (c == '-' || (c >= '0' && c <= '9')) {
+        while (!json_reader_at_end(reader) && strchr("+-0123456789.eE", *reader->pos) != NULL) {
+            reader->pos++;
+        }
+    } else {
+        static const char *const literals[] = {"true", "false", "null"};
+        size_t i;
+        for (i = 0; i < sizeof(literals) / sizeof(literals[0]); i++) {
+            size_t literal_len = strlen(literals[i]);
+            if ((size_t)(reader->end - reader->pos) >= literal_len && !strncmp(reader->pos, literals[i], literal_len)) {
+                reader->pos += literal_len;
+                break;
+            }
+        }
+        if (i == sizeof(literals) / sizeof(literals[0])) {
+            return json_reader_fail(reader);
+        }
+    }
+    *text = start;
+    *len = (size_t)(reader->pos - start);
+    reader->state = JSON_READER_STATE_VALUE;
+    return true;
+}
+
+static bool json_reader_skip_value(struct json_reader *reader, int depth) {
+    if (depth > JSON_READER_MAX_DEPTH) {
+        return json_reader_fail(reader);
+    }
+    switch (json_reader_peek(reader)) {
+        case JSON_READER_OBJECT: {
+            const char *key;
+            size_t key_len;
+            json_reader_begin_object(reader);
+            while (json_reader_next_member(reader, &key, &key_len)) {
+                if (!json_reader_skip_value(reader, depth + 1)) {
+                    return false;
+                }
+            }
+            break;
+        }
+        case JSON_READER_ARRAY:
+            json_reader_begin_array(reader);
+            while (json_reader_next_element(reader)) {
+                if (!json_reader_skip_value(reader, depth + 1)) {
+                    return false;
+                }
+            }
+            break;
+        case JSON_READER_STRING:
+            json_reader_scan_string(reader, NULL, 0);
+            break;
+        case JSON_READER_NUMBER:
+        case JSON_READER_LITERAL: {
+            const char *text;
+            size_t len;
+            json_reader_scan_scalar(reader, &text, &len);
+            break;
+        }
+        default:
+            return json_reader_fail(reader);
+    }
+    return !reader->failed;
+}
+
+void json_reader_init(struct json_reader *reader, const char *text, size_t len) {
+    reader->pos = text;
+    reader->end = text + len;
+    reader->state = JSON_READER_STATE_START;
+    reader->failed = false;
+}
+
+bool json_reader_validate(const char *text, size_t len) {
+    struct json_reader reader;
+    json_reader_init(&reader, text, len);
+    return json_reader_skip(&reader);
+}
+
+enum json_reader_type json_reader_peek(struct json_reader *reader) {
+    if (reader->failed) {
+        return JSON_READER_INVALID;
+    }
+    json_reader_skip_whitespace(reader);
+    switch (json_reader_char(reader)) {
+        case '{':
+            return JSON_READER_OBJECT;
+        case '[':
+            return JSON_READER_ARRAY;
+        case '"':
+            return JSON_READER_STRING;
+        case '-':
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':
+            return JSON_READER_NUMBER;
+        case 't':
+        case 'f':
+        case 'n':
+            return JSON_READER_LITERAL;
+        default:
+            return JSON_READER_INVALID;
+    }
+}
+
+bool json_reader_skip(struct json_reader *reader) { return json_reader_skip_value(reader, 0); }
+
+bool json_reader_begin_object(struct json_reader *reader) {
+    if (json_reader_peek(reader) != JSON_READER_OBJECT) {
+        return json_reader_fail(reader);
+    }
+    reader->pos++;
+    reader->state = JSON_READER_STATE_START;
+    return true;
+}
+
+bool json_reader_begin_array(struct json_reader *reader) {
+    if (json_reader_peek(reader) != JSON_READER_ARRAY) {
+        return json_reader_fail(reader);
+    }
+    reader->pos++;
+    reader->state = JSON_READER_STATE_START;
+    return true;
+}
+
+// Consume the closing character or the separating comma of a container
+static bool json_reader_next_in_container(struct json_reader *reader, char close) {
+    if (reader->failed) {
+        return false;
+    }
+    json_reader_skip_whitespace(reader);
+    if (reader->state != JSON_READER_STATE_START && reader->state != JSON_READER_STATE_VALUE) {
+        // The previous member or element was never consumed
+        return json_reader_fail(reader);
+    }
+    if (json_reader_char(reader) == close) {
+        reader->pos++;
+        reader->state = JSON_READER_STATE_VALUE;
+        return false;
+    }
+    if (reader->state == JSON_READER_STATE_VALUE) {
+        if (json_reader_char(reader) != ',') {
+            return json_reader_fail(reader);
+        }
+        reader->pos++;
+        json_reader_skip_whitespace(reader);
+        // A comma must be followed by another member or element
+        if (json_reader_char(reader) == close) {
+            return json_reader_fail(reader);
+        }
+    }
+    reader->state = JSON_READER_STATE_COMMA;
+    return true;
+}
+
+bool json_reader_next_member(struct json_reader *reader, const char **key, size_t *key_len) {
+    if (!json_reader_next_in_container(reader, '}')) {
+        return false;
+    }
+    if (json_reader_char(reader) != '"') {
+        return json_reader_fail(reader);
+    }
+    const char *start = reader->pos + 1;
+    if (!json_reader_scan_string(reader, NULL, 0)) {
+        return false;
+    }
+    *key = start;
+    *key_len = (size_t)(reader->pos - 1 - start);
+
+    json_reader_skip_whitespace(reader);
+    if (json_reader_char(reader) != ':') {
+        return json_reader_fail(reader);
+    }
+    reader->pos++;
+    reader->state = JSON_READER_STATE_COLON;
+    return true;
+}
+
+bool json_reader_next_element(struct json_reader *reader) { return json_reader_next_in_container(reader, ']'); }
+
+unsigned json_reader_count_elements(const struct json_reader *reader) {
+    struct json_reader counter = *reader;
+    unsigned count = 0;
+
+    if (!json_reader_begin_array(&counter)) {
+        return 0;
+    }
+    while (json_reader_next_element(&counter) && json_reader_skip(&counter)) {
+        count++;
+    }
+    return count;
+}
+
+bool json_reader_key_equals(const char *key, size_t key_len, const char *name) {
+    return strncmp(key, name, key_len) == 0 && name[key_len] == '\0';
+}
+
+void json_reader_copy_key(const char *key, size_t key_len, char *dst, size_t dst_size) {
+    if (dst_size == 0) {
+        return;
+    }
+    if (key_len > dst_size - 1) {
+        key_len = dst_size - 1;
+    }
+    memcpy(dst, key, key_len);
+    dst[key_len] = '\0';
+}
+
+bool json_reader_read_string(struct json_reader *reader, char *dst, size_t dst_size) {
+    const char *text;
+    size_t len;
+
+    if (dst_size > 0) {
+        dst[0] = '\0';
+    }
+    switch (json_reader_peek(reader)) {
+        case JSON_READER_STRING:
+            return json_reader_scan_string(reader, dst, dst_size);
+        case JSON_READER_NUMBER:
+        case JSON_READER_LITERAL:
+            if (!json_reader_scan_scalar(reader, &text, &len)) {
+                return false;
+            }
+            json_reader_copy_key(text, len, dst, dst_size);
+            return true;
+        default:
+            json_reader_skip(reader);
+            return false;
+    }
+}
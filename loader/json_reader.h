@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// A pull parser for the loader's JSON manifests.
+//
+// The reader walks the manifest text in place and never allocates or writes to
+// it.  Objects and arrays are iterated member by member; for each value the
+// caller either reads it, skips it, or copies the reader to come back to the
+// value later (a copy is just a position in the text).  Strings are unescaped
+// straight into caller-provided buffers, so the loader can fill in its fixed
+// size property fields without building a tree first.
+//
+// Matching cJSON, which the loader used before, anything after the first
+// complete value is ignored.
+
+enum json_reader_type {
+    JSON_READER_INVALID = 0,
+    JSON_READER_OBJECT,
+    JSON_READER_ARRAY,
+    JSON_READER_STRING,
+    JSON_READER_NUMBER,
+    JSON_READER_LITERAL,  // true, false or null
+};
+
+struct json_reader {
+    const char *pos;
+    const char *end;
+    int state;
+    bool failed;
+};
+
+// Start reading the JSON value at the beginning of text
+void json_reader_init(struct json_reader *reader, const char *text, size_t len);
+
+// Check that text holds a well-formed JSON value
+bool json_reader_validate(const char *text, size_t len);
+
+// Type of the next value, without consuming it
+enum json_reader_type json_reader_peek(struct json_reader *reader);
+
+// Skip over the next value
+bool json_reader_skip(struct json_reader *reader);
+
+// Enter the object or array that is the next value
+bool json_reader_begin_object(struct json_reader *reader);
+bool json_reader_begin_array(struct json_reader *reader);
+
+// Advance to the next member of the current object.  key points at the raw,
+// still escaped, key text, which is not NUL-terminated.  Returns false once
+// the closing brace has been consumed or on error.  The member's value must
+// be read or skipped before the next call.
+bool json_reader_next_member(struct json_reader *reader, const char **key, size_t *key_len);
+
+// Advance to the next element of the current array, with the same rules as
+// json_reader_next_member().
+bool json_reader_next_element(struct json_reader *reader);
+
+// Number of elements in the array that is the next value, without consuming it
+unsigned json_reader_count_elements(const struct json_reader *reader);
+
+// Compare a key returned by json_reader_next_member() against name
+bool json_reader_key_equals(const char *key, size_t key_len, const char *name);
+
+// Copy a key returned by json_reader_next_member() into dst, truncating to fit
+void json_reader_copy_key(const char *key, size_t key_len, char *dst, size_t dst_size);
+
+// Consume the next value and copy it into dst, NUL-terminated and truncated to
+// fit.  Strings are unescaped; numbers and literals are copied as written.
+// Returns false, after skipping it, if the value is an object or array.
+bool json_reader_read_string(struct json_reader *reader, char *dst, size_t dst_size);
@@ -32,7 +32,10 @@
 #include <string.h>
 #include <stddef.h>
 
+#include <time.h>
+
 #include <sys/types.h>
+#include <sys/stat.h>
 #if defined(_WIN32)
 #include "dirent_on_windows.h"
 #else  // _WIN32
@@ -44,7 +47,8 @@
 #include "debug_report.h"
 #include "wsi.h"
 #include "vulkan/vk_icd.h"
-#include "cJSON.h"
+#include "json_reader.h"
+#include "log_trace.h"
 #include "murmurhash.h"
 
 // This is a CMake generated file with #defines for any functions/includes
@@ -85,6 +89,8 @@ uint32_t g_loader_log_msgs = 0;
 // additionally CreateDevice and DestroyDevice needs to be locked
 loader_platform_thread_mutex loader_lock;
 loader_platform_thread_mutex loader_json_lock;
+loader_platform_thread_mutex loader_manifest_cache_lock;
+loader_platform_thread_mutex loader_dev_ext_cache_lock;
 
 const char *std_validation_str = "VK_LAYER_LUNARG_standard_validation";
 
@@ -295,6 +301,21 @@ void loader_log(const struct loader_instance *inst, VkFlags msg_type, int32_t ms
     va_list ap;
     int ret;
 
+    // Work out who wants the message before formatting it, since most
+    // messages are dropped
+    bool to_callbacks = inst != NULL && util_DebugReportWantsMessage(inst, msg_type);
+    bool to_stderr = (msg_type & g_loader_log_msgs) != 0;
+
+    if (g_loader_trace_enabled) {
+        va_start(ap, format);
+        loader_trace_message(msg_type, msg_code, format, ap);
+        va_end(ap);
+    }
+
+    if (!to_callbacks && !to_stderr) {
+        return;
+    }
+
     va_start(ap, format);
     ret = vsnprintf(msg, sizeof(msg), format, ap);
     if ((ret >= (int)sizeof(msg)) || ret < 0) {
@@ -302,18 +323,17 @@ void loader_log(const struct loader_instance *inst, VkFlags msg_type, int32_t ms
     }
     va_end(ap);
 
-    if (inst) {
+    if (to_callbacks) {
         util_DebugReportMessage(inst, msg_type, VK_DEBUG_REPORT_OBJECT_TYPE_INSTANCE_EXT, (uint64_t)(uintptr_t)inst, 0, msg_code,
                                 "loader", msg);
     }
 
-    if (!(msg_type & g_loader_log_msgs)) {
+    if (!to_stderr) {
         return;
     }
 
     cmd_line_msg[0] = '\0';
 
-    va_start(ap, format);
     if ((msg_type & LOADER_INFO_BIT) != 0) {
         strncat(cmd_line_msg, "INFO", cmd_line_size);
         cmd_line_size -= 4;
@@ -624,6 +644,7 @@ static struct loader_layer_properties *loader_get_next_layer_property(const stru
                        "layer list");
             return NULL;
         }
+        memset((uint8_t *)layer_list->list + layer_list->capacity, 0, layer_list->capacity);
         layer_list->capacity *= 2;
     }
 
@@ -647,6 +668,7 @@ void loader_delete_layer_properties(const struct loader_instance *inst, struct l
             loader_instance_heap_free(inst, dev_ext_list->list->entrypoints);
         }
         loader_destroy_generic_list(inst, (struct loader_generic_list *)dev_ext_list);
+        loader_instance_heap_free(inst, layer_list->list[i].intercepted_functions);
     }
     layer_list->count = 0;
 
@@ -793,6 +815,221 @@ VkResult loader_add_device_extensions(const struct loader_instance *inst,
     return VK_SUCCESS;
 }
 
+// Process-wide cache of the device extensions each ICD reports for its
+// physical devices, so that applications creating many instances only
+// enumerate them once.  Physical device handles belong to a single ICD
+// instance, so entries are keyed by ICD library and by the device's position
+// in the ICD's list, and are checked against the device's properties before
+// use.  The whole cache is dropped when an instance is created with a
+// different set of ICDs than the instance before it.
+struct loader_dev_ext_cache_entry {
+    char *lib_name;
+    uint32_t icd_phys_dev_index;
+    uint32_t vendor_id;
+    uint32_t device_id;
+    uint32_t driver_version;
+    uint8_t pipeline_cache_uuid[VK_UUID_SIZE];
+    uint32_t ext_count;
+    VkExtensionProperties *ext_props;
+};
+
+static struct {
+    uint32_t icd_set_hash;  // hash of the library names of the last ICD scan
+    uint32_t count;
+    uint32_t capacity;
+    struct loader_dev_ext_cache_entry *entries;
+} loader_dev_ext_cache;
+
+static void loader_dev_ext_cache_clear(void) {
+    for (uint32_t i = 0; i < loader_dev_ext_cache.count; i++) {
+        free(loader_dev_ext_cache.entries[i].lib_name);
+        free(loader_dev_ext_cache.entries[i].ext_props);
+    }
+    loader_dev_ext_cache.count = 0;
+}
+
+// Drop the cached device extensions if icd_tramp_list names different ICDs
+// than the previous scan
+static void loader_dev_ext_cache_check_icds(const struct loader_instance *inst,
+                                            const struct loader_icd_tramp_list *icd_tramp_list) {
+    uint32_t hash = icd_tramp_list->count;
+
+    for (uint32_t i = 0; i < icd_tramp_list->count; i++) {
+        const char *lib_name = icd_tramp_list->scanned_list[i].lib_name;
+        hash = murmurhash(lib_name, strlen(lib_name), hash);
+    }
+
+    loader_platform_thread_lock_mutex(&loader_dev_ext_cache_lock);
+    if (hash != loader_dev_ext_cache.icd_set_hash) {
+        if (loader_dev_ext_cache.count > 0) {
+            loader_log(inst, VK_DEBUG_REPORT_DEBUG_BIT_EXT, 0, "ICD list changed, dropping %d cached device extension lists",
+                       loader_dev_ext_cache.count);
+        }
+        loader_dev_ext_cache_clear();
+        loader_dev_ext_cache.icd_set_hash = hash;
+    }
+    loader_platform_thread_unlock_mutex(&loader_dev_ext_cache_lock);
+}
+
+// Called with loader_dev_ext_cache_lock held
+static struct loader_dev_ext_cache_entry *loader_dev_ext_cache_find(const char *lib_name, uint32_t icd_phys_dev_index) {
+    for (uint32_t i = 0; i < loader_dev_ext_cache.count; i++) {
+        struct loader_dev_ext_cache_entry *entry = &loader_dev_ext_cache.entries[i];
+        if (entry->icd_phys_dev_index == icd_phys_dev_index && !strcmp(entry->lib_name, lib_name)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static bool loader_dev_ext_cache_entry_matches(const struct loader_dev_ext_cache_entry *entry,
+                                               const VkPhysicalDeviceProperties *props) {
+    return entry->vendor_id == props->vendorID && entry->device_id == props->deviceID &&
+           entry->driver_version == props->driverVersion &&
+           !memcmp(entry->pipeline_cache_uuid, props->pipelineCacheUUID, VK_UUID_SIZE);
+}
+
+// Store a device's extensions in the cache, taking ownership of ext_props.
+// Called with loader_dev_ext_cache_lock held.
+static void loader_dev_ext_cache_store(const char *lib_name, uint32_t icd_phys_dev_index, const VkPhysicalDeviceProperties *props,
+                                       uint32_t ext_count, VkExtensionProperties *ext_props) {
+    struct loader_dev_ext_cache_entry *entry = loader_dev_ext_cache_find(lib_name, icd_phys_dev_index);
+
+    if (NULL == entry) {
+        if (loader_dev_ext_cache.count == loader_dev_ext_cache.capacity) {
+            uint32_t capacity = loader_dev_ext_cache.capacity ? loader_dev_ext_cache.capacity * 2 : 8;
+            void *entries = realloc(loader_dev_ext_cache.entries, capacity * sizeof(struct loader_dev_ext_cache_entry));
+            if (NULL == entries) {
+                free(ext_props);
+                return;
+            }
+            loader_dev_ext_cache.entries = entries;
+            loader_dev_ext_cache.capacity = capacity;
+        }
+        entry = &loader_dev_ext_cache.entries[loader_dev_ext_cache.count];
+        entry->lib_name = malloc(strlen(lib_name) + 1);
+        if (NULL == entry->lib_name) {
+            free(ext_props);
+            return;
+        }
+        strcpy(entry->lib_name, lib_name);
+        entry->icd_phys_dev_index = icd_phys_dev_index;
+        loader_dev_ext_cache.count++;
+    } else {
+        free(entry->ext_props);
+    }
+
+    entry->vendor_id = props->vendorID;
+    entry->device_id = props->deviceID;
+    entry->driver_version = props->driverVersion;
+    memcpy(entry->pipeline_cache_uuid, props->pipelineCacheUUID, VK_UUID_SIZE);
+    entry->ext_count = ext_count;
+    entry->ext_props = ext_props;
+}
+
+// Give a physical device its own copy of its extension list.  Called with
+// loader_dev_ext_cache_lock held.
+static VkResult loader_set_icd_device_extensions(const struct loader_instance *inst,
+                                                 struct loader_physical_device_term *phys_dev_term, uint32_t ext_count,
+                                                 const VkExtensionProperties *ext_props) {
+    VkExtensionProperties *copy = NULL;
+
+    if (ext_count > 0) {
+        copy = loader_instance_heap_alloc(inst, ext_count * sizeof(VkExtensionProperties), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == copy) {
+            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                       "loader_get_icd_device_extensions: Failed to allocate space"
+                       " for device extension properties.");
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        memcpy(copy, ext_props, ext_count * sizeof(VkExtensionProperties));
+    }
+    phys_dev_term->icd_ext_count = ext_count;
+    phys_dev_term->icd_ext_props = copy;
+    phys_dev_term->icd_exts_known = true;
+    return VK_SUCCESS;
+}
+
+// Get the device extensions the ICD reports for a physical device.  They are
+// enumerated once per device and kept with the physical device; instances
+// after the first one take them from the process-wide cache.
+VkResult loader_get_icd_device_extensions(const struct loader_instance *inst, struct loader_physical_device_term *phys_dev_term,
+                                          uint32_t *count, const VkExtensionProperties **props) {
+    struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
+    const char *lib_name = icd_term->scanned_icd->lib_name;
+    VkPhysicalDeviceProperties dev_props;
+    bool have_dev_props = false;
+    struct loader_dev_ext_cache_entry *entry;
+    VkExtensionProperties *ext_props = NULL;
+    uint32_t ext_count = 0;
+    VkResult res = VK_SUCCESS;
+
+    loader_platform_thread_lock_mutex(&loader_dev_ext_cache_lock);
+    if (phys_dev_term->icd_exts_known) {
+        goto out;
+    }
+
+    // Without the device's properties there is nothing to check a cached
+    // list against, so such devices always go to the ICD
+    if (NULL != icd_term->dispatch.GetPhysicalDeviceProperties) {
+        icd_term->dispatch.GetPhysicalDeviceProperties(phys_dev_term->phys_dev, &dev_props);
+        have_dev_props = true;
+
+        entry = loader_dev_ext_cache_find(lib_name, phys_dev_term->icd_phys_dev_index);
+        if (NULL != entry && loader_dev_ext_cache_entry_matches(entry, &dev_props)) {
+            res = loader_set_icd_device_extensions(inst, phys_dev_term, entry->ext_count, entry->ext_props);
+            goto out;
+        }
+    }
+    loader_platform_thread_unlock_mutex(&loader_dev_ext_cache_lock);
+
+    res = icd_term->dispatch.EnumerateDeviceExtensionProperties(phys_dev_term->phys_dev, NULL, &ext_count, NULL);
+    if (res == VK_SUCCESS && ext_count > 0) {
+        ext_props = malloc(ext_count * sizeof(VkExtensionProperties));
+        if (NULL == ext_props) {
+            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                       "loader_get_icd_device_extensions: Failed to allocate space"
+                       " for device extension properties.");
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        res = icd_term->dispatch.EnumerateDeviceExtensionProperties(phys_dev_term->phys_dev, NULL, &ext_count, ext_props);
+    }
+    if (res != VK_SUCCESS) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "loader_get_icd_device_extensions: Error getting physical "
+                   "device extension info from library %s",
+                   lib_name);
+        free(ext_props);
+        return res;
+    }
+
+    loader_platform_thread_lock_mutex(&loader_dev_ext_cache_lock);
+    // Another thread may have filled in the same physical device meanwhile
+    if (!phys_dev_term->icd_exts_known) {
+        res = loader_set_icd_device_extensions(inst, phys_dev_term, ext_count, ext_props);
+    }
+    if (have_dev_props) {
+        loader_dev_ext_cache_store(lib_name, phys_dev_term->icd_phys_dev_index, &dev_props, ext_count, ext_props);
+    } else {
+        free(ext_props);
+    }
+
+out:
+    if (res == VK_SUCCESS) {
+        *count = phys_dev_term->icd_ext_count;
+        *props = phys_dev_term->icd_ext_props;
+    }
+    loader_platform_thread_unlock_mutex(&loader_dev_ext_cache_lock);
+    return res;
+}
+
+void loader_free_phys_dev_term(const struct loader_instance *inst, struct loader_physical_device_term *phys_dev_term) {
+    if (NULL != phys_dev_term) {
+        loader_instance_heap_free(inst, phys_dev_term->icd_ext_props);
+        loader_instance_heap_free(inst, phys_dev_term);
+    }
+}
+
 VkResult loader_init_generic_list(const struct loader_instance *inst, struct loader_generic_list *list_info, size_t element_size) {
     size_t capacity = 32 * element_size;
     list_info->count = 0;
@@ -896,7 +1133,7 @@ VkResult loader_add_to_dev_ext_list(const struct loader_instance *inst, struct l
         ext_list->capacity *= 2;
     }
 
-    memcpy(&ext_list->list[idx].props, props, sizeof(struct loader_dev_ext_props));
+    memcpy(&ext_list->list[idx].props, props, sizeof(VkExtensionProperties));
     ext_list->list[idx].entrypoint_count = entry_count;
     ext_list->list[idx].entrypoints =
         loader_instance_heap_alloc(inst, sizeof(char *) * entry_count, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
@@ -1112,6 +1349,9 @@ VkResult loader_get_icd_loader_instance_extensions(const struct loader_instance
 
     // traverse scanned icd list adding non-duplicate extensions to the list
     for (uint32_t i = 0; i < icd_tramp_list->count; i++) {
+        if (!loader_scanned_icd_load(inst, &icd_tramp_list->scanned_list[i])) {
+            continue;
+        }
         res = loader_init_generic_list(inst, (struct loader_generic_list *)&icd_exts, sizeof(VkExtensionProperties));
         if (VK_SUCCESS != res) {
             goto out;
@@ -1186,6 +1426,7 @@ void loader_destroy_logical_device(const struct loader_instance *inst, struct lo
     if (NULL != dev->activated_layer_list.list) {
         loader_deactivate_layers(inst, dev, &dev->activated_layer_list);
     }
+    loader_device_heap_free(dev, dev->chain_layers);
     loader_device_heap_free(dev, dev);
 }
 
@@ -1323,7 +1564,9 @@ bool loader_get_icd_interface_version(PFN_vkNegotiateLoaderICDInterfaceVersion f
 void loader_scanned_icd_clear(const struct loader_instance *inst, struct loader_icd_tramp_list *icd_tramp_list) {
     if (icd_tramp_list->capacity == 0) return;
     for (uint32_t i = 0; i < icd_tramp_list->count; i++) {
-        loader_platform_close_library(icd_tramp_list->scanned_list[i].handle);
+        if (NULL != icd_tramp_list->scanned_list[i].handle) {
+            loader_platform_close_library(icd_tramp_list->scanned_list[i].handle);
+        }
         loader_instance_heap_free(inst, icd_tramp_list->scanned_list[i].lib_name);
     }
     loader_instance_heap_free(inst, icd_tramp_list->scanned_list);
@@ -1348,22 +1591,73 @@ static VkResult loader_scanned_icd_init(const struct loader_instance *inst, stru
 
 static VkResult loader_scanned_icd_add(const struct loader_instance *inst, struct loader_icd_tramp_list *icd_tramp_list,
                                        const char *filename, uint32_t api_version) {
+    struct loader_scanned_icd *new_scanned_icd;
+    VkResult res = VK_SUCCESS;
+
+    // check for enough capacity
+    if ((icd_tramp_list->count * sizeof(struct loader_scanned_icd)) >= icd_tramp_list->capacity) {
+        icd_tramp_list->scanned_list =
+            loader_instance_heap_realloc(inst, icd_tramp_list->scanned_list, icd_tramp_list->capacity, icd_tramp_list->capacity * 2,
+                                         VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == icd_tramp_list->scanned_list) {
+            res = VK_ERROR_OUT_OF_HOST_MEMORY;
+            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                       "loader_scanned_icd_add: Realloc failed on icd library"
+                       " list for ICD %s",
+                       filename);
+            goto out;
+        }
+        // double capacity
+        icd_tramp_list->capacity *= 2;
+    }
+
+    new_scanned_icd = &(icd_tramp_list->scanned_list[icd_tramp_list->count]);
+    memset(new_scanned_icd, 0, sizeof(struct loader_scanned_icd));
+    new_scanned_icd->api_version = api_version;
+
+    new_scanned_icd->lib_name = (char *)loader_instance_heap_alloc(inst, strlen(filename) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL == new_scanned_icd->lib_name) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_scanned_icd_add: Out of memory can't add ICD %s", filename);
+        res = VK_ERROR_OUT_OF_HOST_MEMORY;
+        goto out;
+    }
+    strcpy(new_scanned_icd->lib_name, filename);
+    icd_tramp_list->count++;
+
+out:
+
+    return res;
+}
+
+// Open a scanned ICD library and settle on an interface version with it.  This
+// is deferred until the ICD is first needed, so scanning only reads manifests.
+// Only the negotiation entry points are resolved here; the rest of the ICD's
+// dispatch table is filled in by loader_icd_init_entries once it has a
+// VkInstance.
+//
+// \returns
+// true if the ICD is usable.  A failure is logged once and the ICD is skipped
+// from then on.
+bool loader_scanned_icd_load(const struct loader_instance *inst, struct loader_scanned_icd *scanned_icd) {
     loader_platform_dl_handle handle;
     PFN_vkCreateInstance fp_create_inst;
     PFN_vkEnumerateInstanceExtensionProperties fp_get_inst_ext_props;
     PFN_vkGetInstanceProcAddr fp_get_proc_addr;
     PFN_GetPhysicalDeviceProcAddr fp_get_phys_dev_proc_addr = NULL;
     PFN_vkNegotiateLoaderICDInterfaceVersion fp_negotiate_icd_version;
-    struct loader_scanned_icd *new_scanned_icd;
+    const char *filename = scanned_icd->lib_name;
     uint32_t interface_vers;
-    VkResult res = VK_SUCCESS;
 
-    // TODO implement smarter opening/closing of libraries. For now this
-    // function leaves libraries open and the scanned_icd_clear closes them
+    if (scanned_icd->load_attempted) {
+        return NULL != scanned_icd->handle;
+    }
+    scanned_icd->load_attempted = true;
+
+    // The library stays open until loader_scanned_icd_clear
     handle = loader_platform_open_library(filename);
     if (NULL == handle) {
-        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, loader_platform_open_library_error(filename));
-        goto out;
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "%s", loader_platform_open_library_error(filename));
+        return false;
     }
 
     // Get and settle on an ICD interface version
@@ -1371,10 +1665,10 @@ static VkResult loader_scanned_icd_add(const struct loader_instance *inst, struc
 
     if (!loader_get_icd_interface_version(fp_negotiate_icd_version, &interface_vers)) {
         loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                   "loader_scanned_icd_add: ICD %s doesn't support interface"
+                   "loader_scanned_icd_load: ICD %s doesn't support interface"
                    " version compatible with loader, skip this ICD.",
                    filename);
-        goto out;
+        goto fail;
     }
 
     fp_get_proc_addr = loader_platform_get_proc_address(handle, "vk_icdGetInstanceProcAddr");
@@ -1384,14 +1678,14 @@ static VkResult loader_scanned_icd_add(const struct loader_instance *inst, struc
         fp_get_proc_addr = loader_platform_get_proc_address(handle, "vkGetInstanceProcAddr");
         if (NULL == fp_get_proc_addr) {
             loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "loader_scanned_icd_add: Attempt to retrieve either "
+                       "loader_scanned_icd_load: Attempt to retrieve either "
                        "\'vkGetInstanceProcAddr\' or "
                        "\'vk_icdGetInstanceProcAddr\' from ICD %s failed.",
                        filename);
-            goto out;
+            goto fail;
         } else {
             loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
-                       "loader_scanned_icd_add: Using deprecated ICD "
+                       "loader_scanned_icd_load: Using deprecated ICD "
                        "interface of \'vkGetInstanceProcAddr\' instead of "
                        "\'vk_icdGetInstanceProcAddr\' for ICD %s",
                        filename);
@@ -1399,20 +1693,20 @@ static VkResult loader_scanned_icd_add(const struct loader_instance *inst, struc
         fp_create_inst = loader_platform_get_proc_address(handle, "vkCreateInstance");
         if (NULL == fp_create_inst) {
             loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "loader_scanned_icd_add:  Failed querying "
+                       "loader_scanned_icd_load:  Failed querying "
                        "\'vkCreateInstance\' via dlsym/loadlibrary for "
                        "ICD %s",
                        filename);
-            goto out;
+            goto fail;
         }
         fp_get_inst_ext_props = loader_platform_get_proc_address(handle, "vkEnumerateInstanceExtensionProperties");
         if (NULL == fp_get_inst_ext_props) {
             loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "loader_scanned_icd_add: Could not get \'vkEnumerate"
+                       "loader_scanned_icd_load: Could not get \'vkEnumerate"
                        "InstanceExtensionProperties\' via dlsym/loadlibrary "
                        "for ICD %s",
                        filename);
-            goto out;
+            goto fail;
         }
     } else {
         // Use newer interface version 1 or later
@@ -1423,63 +1717,36 @@ static VkResult loader_scanned_icd_add(const struct loader_instance *inst, struc
         fp_create_inst = (PFN_vkCreateInstance)fp_get_proc_addr(NULL, "vkCreateInstance");
         if (NULL == fp_create_inst) {
             loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "loader_scanned_icd_add: Could not get "
+                       "loader_scanned_icd_load: Could not get "
                        "\'vkCreateInstance\' via \'vk_icdGetInstanceProcAddr\'"
                        " for ICD %s",
                        filename);
-            goto out;
+            goto fail;
         }
         fp_get_inst_ext_props =
             (PFN_vkEnumerateInstanceExtensionProperties)fp_get_proc_addr(NULL, "vkEnumerateInstanceExtensionProperties");
         if (NULL == fp_get_inst_ext_props) {
             loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "loader_scanned_icd_add: Could not get \'vkEnumerate"
+                       "loader_scanned_icd_load: Could not get \'vkEnumerate"
                        "InstanceExtensionProperties\' via "
                        "\'vk_icdGetInstanceProcAddr\' for ICD %s",
                        filename);
-            goto out;
+            goto fail;
         }
         fp_get_phys_dev_proc_addr = loader_platform_get_proc_address(handle, "vk_icdGetPhysicalDeviceProcAddr");
     }
 
-    // check for enough capacity
-    if ((icd_tramp_list->count * sizeof(struct loader_scanned_icd)) >= icd_tramp_list->capacity) {
-        icd_tramp_list->scanned_list =
-            loader_instance_heap_realloc(inst, icd_tramp_list->scanned_list, icd_tramp_list->capacity, icd_tramp_list->capacity * 2,
-                                         VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (NULL == icd_tramp_list->scanned_list) {
-            res = VK_ERROR_OUT_OF_HOST_MEMORY;
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "loader_scanned_icd_add: Realloc failed on icd library"
-                       " list for ICD %s",
-                       filename);
-            goto out;
-        }
-        // double capacity
-        icd_tramp_list->capacity *= 2;
-    }
-
-    new_scanned_icd = &(icd_tramp_list->scanned_list[icd_tramp_list->count]);
-    new_scanned_icd->handle = handle;
-    new_scanned_icd->api_version = api_version;
-    new_scanned_icd->GetInstanceProcAddr = fp_get_proc_addr;
-    new_scanned_icd->GetPhysicalDeviceProcAddr = fp_get_phys_dev_proc_addr;
-    new_scanned_icd->EnumerateInstanceExtensionProperties = fp_get_inst_ext_props;
-    new_scanned_icd->CreateInstance = fp_create_inst;
-    new_scanned_icd->interface_version = interface_vers;
-
-    new_scanned_icd->lib_name = (char *)loader_instance_heap_alloc(inst, strlen(filename) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-    if (NULL == new_scanned_icd->lib_name) {
-        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_scanned_icd_add: Out of memory can't add ICD %s", filename);
-        res = VK_ERROR_OUT_OF_HOST_MEMORY;
-        goto out;
-    }
-    strcpy(new_scanned_icd->lib_name, filename);
-    icd_tramp_list->count++;
-
-out:
+    scanned_icd->handle = handle;
+    scanned_icd->GetInstanceProcAddr = fp_get_proc_addr;
+    scanned_icd->GetPhysicalDeviceProcAddr = fp_get_phys_dev_proc_addr;
+    scanned_icd->EnumerateInstanceExtensionProperties = fp_get_inst_ext_props;
+    scanned_icd->CreateInstance = fp_create_inst;
+    scanned_icd->interface_version = interface_vers;
+    return true;
 
-    return res;
+fail:
+    loader_platform_close_library(handle);
+    return false;
 }
 
 static void loader_debug_init(void) {
@@ -1528,21 +1795,23 @@ static void loader_debug_init(void) {
     }
 
     loader_free_getenv(orig, NULL);
+
+    env = loader_getenv("VK_LOADER_TRACE", NULL);
+    if (env != NULL && env[0] != '\0') {
+        loader_trace_init(env);
+    }
+    loader_free_getenv(env, NULL);
 }
 
 void loader_initialize(void) {
     // initialize mutexs
     loader_platform_thread_create_mutex(&loader_lock);
     loader_platform_thread_create_mutex(&loader_json_lock);
+    loader_platform_thread_create_mutex(&loader_manifest_cache_lock);
+    loader_platform_thread_create_mutex(&loader_dev_ext_cache_lock);
 
     // initialize logging
     loader_debug_init();
-
-    // initial cJSON to use alloc callbacks
-    cJSON_Hooks alloc_fns = {
-        .malloc_fn = loader_instance_tls_heap_alloc, .free_fn = loader_instance_tls_heap_free,
-    };
-    cJSON_InitHooks(&alloc_fns);
 }
 
 struct loader_manifest_files {
@@ -1610,69 +1879,799 @@ static void loader_get_fullpath(const char *file, const char *dirs, size_t out_s
     (void)snprintf(out_fullpath, out_size, "%s", file);
 }
 
-// Read a JSON file into a buffer.
+// Manifest cache
 //
-// @return -  A pointer to a cJSON object representing the JSON parse tree.
-//            This returned buffer should be freed by caller.
-static VkResult loader_get_json(const struct loader_instance *inst, const char *filename, cJSON **json) {
-    FILE *file = NULL;
-    char *json_buf;
-    size_t len;
-    VkResult res = VK_SUCCESS;
+// Every layer or extension enumeration and vkCreateInstance rescans the ICD and
+// layer manifest directories and rereads every manifest.  The loader keeps the
+// ".json" listing of each manifest directory and the text of each manifest
+// for the life of the process, revalidated with a stat() of the directory or
+// file, so a repeat enumeration only costs a few stat calls.  Only text that
+// is well-formed JSON is cached.  Entries whose mtime is within a second of
+// when they were read are never trusted, since a second write in the same
+// timestamp tick would go unnoticed.
+//
+// If VK_LOADER_MANIFEST_CACHE is set, the listings and manifest text are
+// also kept in an index under $XDG_CACHE_HOME/vulkan (or $HOME/.cache/vulkan)
+// so a new process can skip reading manifests that have not changed.
+struct loader_file_stamp {
+    int64_t mtime_sec;
+    int64_t mtime_nsec;
+    uint64_t size;
+};
 
-    if (NULL == json) {
-        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_get_json: Received invalid JSON file");
-        res = VK_ERROR_INITIALIZATION_FAILED;
-        goto out;
+struct loader_manifest_cache_file {
+    char *path;
+    struct loader_file_stamp stamp;
+    bool trusted;
+    char *text;
+    bool checked;  // Text read from the on-disk index is validated on first use
+};
+
+struct loader_manifest_cache_dir {
+    char *path;
+    struct loader_file_stamp stamp;
+    bool trusted;
+    uint32_t count;
+    char **names;  // Directory entries ending in ".json", in readdir order
+};
+
+static struct {
+    bool initialized;
+    bool index_enabled;
+    bool index_dirty;
+    char *index_path;
+    uint32_t file_count;
+    uint32_t file_capacity;
+    struct loader_manifest_cache_file *files;
+    uint32_t dir_count;
+    uint32_t dir_capacity;
+    struct loader_manifest_cache_dir *dirs;
+} loader_manifest_cache;
+
+#define LOADER_MANIFEST_INDEX_MAGIC "VK_LOADER_MANIFEST_CACHE 1\n"
+#define LOADER_MANIFEST_INDEX_MAX_STRING (16 * 1024 * 1024)
+
+static bool loader_get_file_stamp(const char *path, struct loader_file_stamp *stamp) {
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        return false;
     }
+    stamp->mtime_sec = (int64_t)st.st_mtime;
+#if defined(__linux__)
+    stamp->mtime_nsec = (int64_t)st.st_mtim.tv_nsec;
+#elif defined(__APPLE__)
+    stamp->mtime_nsec = (int64_t)st.st_mtimespec.tv_nsec;
+#else
+    stamp->mtime_nsec = 0;
+#endif
+    stamp->size = (uint64_t)st.st_size;
+    return true;
+}
 
-    *json = NULL;
+static inline bool loader_file_stamp_equal(const struct loader_file_stamp *a, const struct loader_file_stamp *b) {
+    return a->mtime_sec == b->mtime_sec && a->mtime_nsec == b->mtime_nsec && a->size == b->size;
+}
+
+static inline bool loader_file_stamp_is_stable(const struct loader_file_stamp *stamp) {
+    return stamp->mtime_sec < (int64_t)time(NULL) - 1;
+}
+
+static char *loader_manifest_cache_strdup(const char *str) {
+    char *copy = malloc(strlen(str) + 1);
+    if (copy != NULL) {
+        strcpy(copy, str);
+    }
+    return copy;
+}
+
+static void loader_manifest_cache_free_names(struct loader_manifest_cache_dir *dir) {
+    for (uint32_t i = 0; i < dir->count; i++) {
+        free(dir->names[i]);
+    }
+    free(dir->names);
+    dir->names = NULL;
+    dir->count = 0;
+}
 
-    file = fopen(filename, "rb");
+static struct loader_manifest_cache_file *loader_manifest_cache_find_file(const char *path) {
+    for (uint32_t i = 0; i < loader_manifest_cache.file_count; i++) {
+        if (!strcmp(loader_manifest_cache.files[i].path, path)) {
+            return &loader_manifest_cache.files[i];
+        }
+    }
+    return NULL;
+}
+
+static struct loader_manifest_cache_dir *loader_manifest_cache_find_dir(const char *path) {
+    for (uint32_t i = 0; i < loader_manifest_cache.dir_count; i++) {
+        if (!strcmp(loader_manifest_cache.dirs[i].path, path)) {
+            return &loader_manifest_cache.dirs[i];
+        }
+    }
+    return NULL;
+}
+
+static struct loader_manifest_cache_file *loader_manifest_cache_add_file(const char *path) {
+    struct loader_manifest_cache_file *entry = loader_manifest_cache_find_file(path);
+    if (entry != NULL) {
+        return entry;
+    }
+    if (loader_manifest_cache.file_count == loader_manifest_cache.file_capacity) {
+        uint32_t capacity = loader_manifest_cache.file_capacity ? loader_manifest_cache.file_capacity * 2 : 64;
+        void *files = realloc(loader_manifest_cache.files, capacity * sizeof(struct loader_manifest_cache_file));
+        if (files == NULL) {
+            return NULL;
+        }
+        loader_manifest_cache.files = files;
+        loader_manifest_cache.file_capacity = capacity;
+    }
+    entry = &loader_manifest_cache.files[loader_manifest_cache.file_count];
+    memset(entry, 0, sizeof(*entry));
+    entry->path = loader_manifest_cache_strdup(path);
+    if (entry->path == NULL) {
+        return NULL;
+    }
+    loader_manifest_cache.file_count++;
+    return entry;
+}
+
+static struct loader_manifest_cache_dir *loader_manifest_cache_add_dir(const char *path) {
+    struct loader_manifest_cache_dir *entry = loader_manifest_cache_find_dir(path);
+    if (entry != NULL) {
+        return entry;
+    }
+    if (loader_manifest_cache.dir_count == loader_manifest_cache.dir_capacity) {
+        uint32_t capacity = loader_manifest_cache.dir_capacity ? loader_manifest_cache.dir_capacity * 2 : 16;
+        void *dirs = realloc(loader_manifest_cache.dirs, capacity * sizeof(struct loader_manifest_cache_dir));
+        if (dirs == NULL) {
+            return NULL;
+        }
+        loader_manifest_cache.dirs = dirs;
+        loader_manifest_cache.dir_capacity = capacity;
+    }
+    entry = &loader_manifest_cache.dirs[loader_manifest_cache.dir_count];
+    memset(entry, 0, sizeof(*entry));
+    entry->path = loader_manifest_cache_strdup(path);
+    if (entry->path == NULL) {
+        return NULL;
+    }
+    loader_manifest_cache.dir_count++;
+    return entry;
+}
+
+#if !defined(_WIN32)
+// Read a length-prefixed string ("<len>\n<bytes>\n") from the on-disk index
+static char *loader_manifest_index_read_string(FILE *file, size_t len) {
+    if (len > LOADER_MANIFEST_INDEX_MAX_STRING) {
+        return NULL;
+    }
+    char *str = malloc(len + 1);
+    if (str == NULL) {
+        return NULL;
+    }
+    if (fread(str, 1, len, file) != len || fgetc(file) != '\n') {
+        free(str);
+        return NULL;
+    }
+    str[len] = '\0';
+    return str;
+}
+
+// Load the on-disk index.  Entries are still validated against a fresh stat()
+// before use, so a stale or truncated index only costs the entries it lost.
+static void loader_manifest_index_read(const struct loader_instance *inst) {
+    FILE *file = fopen(loader_manifest_cache.index_path, "rb");
+    char magic[sizeof(LOADER_MANIFEST_INDEX_MAGIC)];
+    char kind;
+    long long sec, nsec;
+    unsigned long long size, len;
+    unsigned long count;
+
+    if (file == NULL) {
+        return;
+    }
+    if (fread(magic, 1, sizeof(magic) - 1, file) != sizeof(magic) - 1 ||
+        strncmp(magic, LOADER_MANIFEST_INDEX_MAGIC, sizeof(magic) - 1)) {
+        loader_log(inst, VK_DEBUG_REPORT_DEBUG_BIT_EXT, 0, "Ignoring manifest cache %s with unknown format",
+                   loader_manifest_cache.index_path);
+        fclose(file);
+        return;
+    }
+
+    while (fscanf(file, "%c", &kind) == 1) {
+        struct loader_file_stamp stamp;
+        char *path;
+
+        if (kind == 'D') {
+            if (fscanf(file, " %lld %lld %llu %lu %llu", &sec, &nsec, &size, &count, &len) != 5 || fgetc(file) != '\n') break;
+        } else if (kind == 'F') {
+            if (fscanf(file, " %lld %lld %llu %llu", &sec, &nsec, &size, &len) != 4 || fgetc(file) != '\n') break;
+        } else {
+            break;
+        }
+        stamp.mtime_sec = (int64_t)sec;
+        stamp.mtime_nsec = (int64_t)nsec;
+        stamp.size = (uint64_t)size;
+        path = loader_manifest_index_read_string(file, (size_t)len);
+        if (path == NULL) break;
+
+        if (kind == 'D') {
+            struct loader_manifest_cache_dir *dir = loader_manifest_cache_add_dir(path);
+            free(path);
+            if (dir == NULL || count > LOADER_MANIFEST_INDEX_MAX_STRING / sizeof(char *)) break;
+            loader_manifest_cache_free_names(dir);
+            dir->trusted = false;
+            dir->names = calloc(count ? count : 1, sizeof(char *));
+            if (dir->names == NULL) break;
+            for (; dir->count < count; dir->count++) {
+                if (fscanf(file, "%llu", &len) != 1 || fgetc(file) != '\n') break;
+                dir->names[dir->count] = loader_manifest_index_read_string(file, (size_t)len);
+                if (dir->names[dir->count] == NULL) break;
+            }
+            if (dir->count != count) {
+                loader_manifest_cache_free_names(dir);
+                break;
+            }
+            dir->stamp = stamp;
+            dir->trusted = true;
+        } else {
+            struct loader_manifest_cache_file *entry = loader_manifest_cache_add_file(path);
+            free(path);
+            if (entry == NULL) break;
+            char *text = loader_manifest_index_read_string(file, (size_t)size);
+            if (text == NULL) break;
+            free(entry->text);
+            entry->text = text;
+            entry->stamp = stamp;
+            entry->trusted = true;
+            entry->checked = false;
+        }
+    }
+    fclose(file);
+}
+
+// Write the on-disk index to a temporary file and rename it into place, so a
+// concurrent reader only ever sees a complete index
+static void loader_manifest_index_write(const struct loader_instance *inst) {
+    size_t tmp_len = strlen(loader_manifest_cache.index_path) + 32;
+    char *tmp_path = loader_stack_alloc(tmp_len);
+    FILE *file;
+    bool ok;
+
+    (void)snprintf(tmp_path, tmp_len, "%s.%ld.tmp", loader_manifest_cache.index_path, (long)getpid());
+    file = fopen(tmp_path, "wb");
+    if (file == NULL) {
+        loader_log(inst, VK_DEBUG_REPORT_DEBUG_BIT_EXT, 0, "Unable to write manifest cache %s", tmp_path);
+        return;
+    }
+    ok = fputs(LOADER_MANIFEST_INDEX_MAGIC, file) >= 0;
+    for (uint32_t i = 0; ok && i < loader_manifest_cache.dir_count; i++) {
+        const struct loader_manifest_cache_dir *dir = &loader_manifest_cache.dirs[i];
+        if (!dir->trusted) continue;
+        ok = fprintf(file, "D %lld %lld %llu %lu %llu\n%s\n", (long long)dir->stamp.mtime_sec, (long long)dir->stamp.mtime_nsec,
+                     (unsigned long long)dir->stamp.size, (unsigned long)dir->count, (unsigned long long)strlen(dir->path),
+                     dir->path) >= 0;
+        for (uint32_t n = 0; ok && n < dir->count; n++) {
+            ok = fprintf(file, "%llu\n%s\n", (unsigned long long)strlen(dir->names[n]), dir->names[n]) >= 0;
+        }
+    }
+    for (uint32_t i = 0; ok && i < loader_manifest_cache.file_count; i++) {
+        const struct loader_manifest_cache_file *entry = &loader_manifest_cache.files[i];
+        if (!entry->trusted || entry->text == NULL) continue;
+        ok = fprintf(file, "F %lld %lld %llu %llu\n%s\n", (long long)entry->stamp.mtime_sec, (long long)entry->stamp.mtime_nsec,
+                     (unsigned long long)entry->stamp.size, (unsigned long long)strlen(entry->path), entry->path) >= 0 &&
+             fwrite(entry->text, 1, (size_t)entry->stamp.size, file) == entry->stamp.size && fputc('\n', file) != EOF;
+    }
+    if (fclose(file) != 0) {
+        ok = false;
+    }
+    if (!ok || rename(tmp_path, loader_manifest_cache.index_path) != 0) {
+        loader_log(inst, VK_DEBUG_REPORT_DEBUG_BIT_EXT, 0, "Unable to write manifest cache %s", loader_manifest_cache.index_path);
+        remove(tmp_path);
+    }
+}
+#endif  // !_WIN32
+
+// Called with loader_manifest_cache_lock held
+static void loader_manifest_cache_init(const struct loader_instance *inst) {
+    if (loader_manifest_cache.initialized) {
+        return;
+    }
+    loader_manifest_cache.initialized = true;
+
+#if !defined(_WIN32)
+    if (geteuid() != getuid() || getegid() != getgid()) {
+        // Don't let setuid apps read or write a cache under the user's home
+        return;
+    }
+    char *enable = loader_secure_getenv("VK_LOADER_MANIFEST_CACHE", inst);
+    bool enabled = enable != NULL && enable[0] != '\0' && strcmp(enable, "0");
+    loader_free_getenv(enable, inst);
+    if (!enabled) {
+        return;
+    }
+
+    char *xdgcachehome = loader_secure_getenv("XDG_CACHE_HOME", inst);
+    char *home = loader_secure_getenv("HOME", inst);
+    const char *base = (xdgcachehome != NULL && xdgcachehome[0] != '\0') ? xdgcachehome : home;
+    const char *base_suffix = (base == home) ? "/.cache" : "";
+    if (base != NULL && base[0] != '\0') {
+        size_t len = strlen(base) + strlen(base_suffix) + sizeof("/vulkan/loader_manifest_cache");
+        loader_manifest_cache.index_path = malloc(len);
+        if (loader_manifest_cache.index_path != NULL) {
+            (void)snprintf(loader_manifest_cache.index_path, len, "%s%s", base, base_suffix);
+            mkdir(loader_manifest_cache.index_path, 0700);
+            strcat(loader_manifest_cache.index_path, "/vulkan");
+            mkdir(loader_manifest_cache.index_path, 0700);
+            strcat(loader_manifest_cache.index_path, "/loader_manifest_cache");
+            loader_manifest_cache.index_enabled = true;
+            loader_manifest_index_read(inst);
+        }
+    }
+    loader_free_getenv(home, inst);
+    loader_free_getenv(xdgcachehome, inst);
+#else
+    (void)inst;
+#endif
+}
+
+// Get the ".json" entries of a manifest directory, listing it again only if its
+// mtime has changed.  Called with loader_manifest_cache_lock held; the returned
+// listing is only valid until the lock is released.
+static struct loader_manifest_cache_dir *loader_manifest_cache_get_dir(const struct loader_instance *inst, const char *path) {
+    struct loader_manifest_cache_dir *entry;
+    struct loader_file_stamp stamp;
+    uint32_t count = 0, capacity = 16;
+    char **names;
+    struct dirent *dent;
+    DIR *sysdir;
+
+    loader_manifest_cache_init(inst);
+    if (!loader_get_file_stamp(path, &stamp)) {
+        return NULL;
+    }
+    entry = loader_manifest_cache_find_dir(path);
+    if (entry != NULL && entry->trusted && loader_file_stamp_equal(&entry->stamp, &stamp)) {
+        return entry;
+    }
+
+    sysdir = opendir(path);
+    if (sysdir == NULL) {
+        return NULL;
+    }
+    names = malloc(capacity * sizeof(char *));
+    while (names != NULL && (dent = readdir(sysdir)) != NULL) {
+        size_t nlen = strlen(dent->d_name);
+        if (nlen < 5 || strcmp(dent->d_name + nlen - 5, ".json")) {
+            continue;
+        }
+        if (count == capacity) {
+            char **grown = realloc(names, capacity * 2 * sizeof(char *));
+            if (grown == NULL) {
+                goto fail;
+            }
+            names = grown;
+            capacity *= 2;
+        }
+        names[count] = loader_manifest_cache_strdup(dent->d_name);
+        if (names[count] == NULL) {
+            goto fail;
+        }
+        count++;
+    }
+    closedir(sysdir);
+    sysdir = NULL;
+
+    if (names == NULL || (entry = loader_manifest_cache_add_dir(path)) == NULL) {
+        goto fail;
+    }
+    loader_manifest_cache_free_names(entry);
+    entry->names = names;
+    entry->count = count;
+    entry->stamp = stamp;
+    entry->trusted = loader_file_stamp_is_stable(&stamp);
+    if (entry->trusted) {
+        loader_manifest_cache.index_dirty = true;
+    }
+    return entry;
+
+fail:
+    loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+               "loader_manifest_cache_get_dir: Failed to allocate space for "
+               "manifest directory %s listing",
+               path);
+    if (sysdir != NULL) {
+        closedir(sysdir);
+    }
+    if (names != NULL) {
+        for (uint32_t i = 0; i < count; i++) {
+            free(names[i]);
+        }
+        free(names);
+    }
+    return NULL;
+}
+
+// Persist any newly trusted cache entries to the on-disk index, if enabled
+static void loader_manifest_cache_flush(const struct loader_instance *inst) {
+    loader_platform_thread_lock_mutex(&loader_manifest_cache_lock);
+#if !defined(_WIN32)
+    if (loader_manifest_cache.index_enabled && loader_manifest_cache.index_dirty) {
+        loader_manifest_index_write(inst);
+        loader_manifest_cache.index_dirty = false;
+    }
+#else
+    (void)inst;
+#endif
+    loader_platform_thread_unlock_mutex(&loader_manifest_cache_lock);
+}
+
+// Outcome of reading and validating one manifest.  Loading does no logging and
+// touches no instance state, so it can run on a prefetch worker thread; the
+// scanning thread reports any failure when it consumes the result.
+enum loader_json_load_status {
+    LOADER_JSON_LOAD_PENDING = 0,
+    LOADER_JSON_LOAD_OK,
+    LOADER_JSON_LOAD_OPEN_FAILED,
+    LOADER_JSON_LOAD_ALLOC_FAILED,
+    LOADER_JSON_LOAD_READ_FAILED,
+    LOADER_JSON_LOAD_PARSE_FAILED,
+};
+
+struct loader_json_load {
+    const char *filename;
+    enum loader_json_load_status status;
+    size_t len;
+    char *text;  // NUL-terminated copy of the manifest, owned by this load
+    bool claimed;
+    bool done;
+};
+
+// Read a manifest and check that it is well-formed JSON, or copy it out of the
+// manifest cache if the file's mtime and size have not changed since it was
+// last read.  The file I/O and validation happen outside
+// loader_manifest_cache_lock so loads can overlap.  The cache must already be
+// initialized.  Returns true if the file was read.
+static bool loader_load_json(struct loader_json_load *load) {
+    FILE *file = NULL;
+    char *json_buf = NULL;
+    size_t len = 0;
+    struct loader_file_stamp stamp;
+    struct loader_manifest_cache_file *entry = NULL;
+    bool have_stamp;
+
+    load->text = NULL;
+
+    have_stamp = loader_get_file_stamp(load->filename, &stamp);
+    if (have_stamp) {
+        loader_platform_thread_lock_mutex(&loader_manifest_cache_lock);
+        entry = loader_manifest_cache_find_file(load->filename);
+        if (entry != NULL && entry->trusted && loader_file_stamp_equal(&entry->stamp, &stamp)) {
+            if (!entry->checked) {
+                entry->trusted = json_reader_validate(entry->text, (size_t)entry->stamp.size);
+                entry->checked = true;
+            }
+            if (entry->trusted) {
+                load->len = (size_t)entry->stamp.size;
+                load->text = (char *)malloc(load->len + 1);
+                if (load->text != NULL) {
+                    memcpy(load->text, entry->text, load->len + 1);
+                    load->status = LOADER_JSON_LOAD_OK;
+                } else {
+                    load->status = LOADER_JSON_LOAD_ALLOC_FAILED;
+                }
+                loader_platform_thread_unlock_mutex(&loader_manifest_cache_lock);
+                return false;
+            }
+        }
+        loader_platform_thread_unlock_mutex(&loader_manifest_cache_lock);
+    }
+
+    file = fopen(load->filename, "rb");
     if (!file) {
-        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_get_json: Failed to open JSON file %s", filename);
-        res = VK_ERROR_INITIALIZATION_FAILED;
-        goto out;
+        load->status = LOADER_JSON_LOAD_OPEN_FAILED;
+        return true;
     }
     fseek(file, 0, SEEK_END);
     len = ftell(file);
     fseek(file, 0, SEEK_SET);
-    json_buf = (char *)loader_stack_alloc(len + 1);
+    load->len = len;
+    json_buf = (char *)malloc(len + 1);
     if (json_buf == NULL) {
-        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                   "loader_get_json: Failed to allocate space for "
-                   "JSON file %s buffer of length %d",
-                   filename, len);
-        res = VK_ERROR_OUT_OF_HOST_MEMORY;
+        load->status = LOADER_JSON_LOAD_ALLOC_FAILED;
         goto out;
     }
     if (fread(json_buf, sizeof(char), len, file) != len) {
-        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_get_json: Failed to read JSON file %s.", filename);
-        res = VK_ERROR_INITIALIZATION_FAILED;
+        load->status = LOADER_JSON_LOAD_READ_FAILED;
         goto out;
     }
     json_buf[len] = '\0';
 
-    // Parse text from file
-    *json = cJSON_Parse(json_buf);
-    if (*json == NULL) {
-        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                   "loader_get_json: Failed to parse JSON file %s, "
-                   "this is usually because something ran out of "
-                   "memory.",
-                   filename);
-        res = VK_ERROR_OUT_OF_HOST_MEMORY;
+    if (!json_reader_validate(json_buf, len)) {
+        load->status = LOADER_JSON_LOAD_PARSE_FAILED;
+        goto out;
+    }
+    load->status = LOADER_JSON_LOAD_OK;
+    load->text = json_buf;
+    json_buf = NULL;
+    if (!have_stamp) {
         goto out;
     }
 
+    loader_platform_thread_lock_mutex(&loader_manifest_cache_lock);
+    entry = loader_manifest_cache_add_file(load->filename);
+    if (entry != NULL) {
+        char *copy = (char *)malloc(len + 1);
+        if (copy != NULL) {
+            memcpy(copy, load->text, len + 1);
+            free(entry->text);
+            entry->text = copy;
+            entry->stamp = stamp;
+            entry->checked = true;
+            // A write between the stat() and the read would leave the sizes mismatched
+            entry->trusted = loader_file_stamp_is_stable(&stamp) && stamp.size == len;
+            if (loader_manifest_cache.index_enabled) {
+                loader_manifest_cache.index_dirty |= entry->trusted;
+            }
+        }
+    }
+    loader_platform_thread_unlock_mutex(&loader_manifest_cache_lock);
+
 out:
     if (NULL != file) {
         fclose(file);
     }
+    free(json_buf);
+    return true;
+}
+
+// Hand the text loaded by loader_load_json() to the caller, logging any failure
+static VkResult loader_finish_json(const struct loader_instance *inst, struct loader_json_load *load, char **json,
+                                   size_t *json_len) {
+    VkResult res = VK_SUCCESS;
 
+    *json = NULL;
+    *json_len = 0;
+    switch (load->status) {
+        case LOADER_JSON_LOAD_OK:
+            *json = load->text;
+            *json_len = load->len;
+            load->text = NULL;
+            break;
+        case LOADER_JSON_LOAD_PARSE_FAILED:
+            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_get_json: Failed to parse JSON file %s.", load->filename);
+            res = VK_ERROR_INITIALIZATION_FAILED;
+            break;
+        case LOADER_JSON_LOAD_ALLOC_FAILED:
+            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                       "loader_get_json: Failed to allocate space for "
+                       "JSON file %s buffer of length %d",
+                       load->filename, load->len);
+            res = VK_ERROR_OUT_OF_HOST_MEMORY;
+            break;
+        case LOADER_JSON_LOAD_READ_FAILED:
+            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_get_json: Failed to read JSON file %s.", load->filename);
+            res = VK_ERROR_INITIALIZATION_FAILED;
+            break;
+        default:
+            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_get_json: Failed to open JSON file %s", load->filename);
+            res = VK_ERROR_INITIALIZATION_FAILED;
+            break;
+    }
     return res;
 }
 
+// Parallel manifest prefetch
+//
+// Reading and validating manifests is independent per file, and on network-mounted
+// home directories each read is a round trip.  A scan sets up a prefetch over
+// its manifest lists with loader_prefetch_json() and then walks them in
+// search-path order as before, so layer and ICD ordering and all logging are
+// unchanged.  The first time the scanning thread has to go to disk for a
+// manifest it starts a small pool of workers, which read and validate the
+// remaining files ahead of it.  A scan served entirely from the manifest cache
+// never starts a thread.  Workers only use the system allocator, never the
+// application's allocation callbacks.
+//
+// Setting VK_LOADER_DISABLE_PARALLEL_SCAN to a non-zero value turns this off.
+#define LOADER_PREFETCH_MAX_WORKERS 3
+
+struct loader_json_prefetch {
+    loader_platform_thread_mutex lock;
+    loader_platform_thread_cond loaded;
+    uint32_t next;  // First index a worker may claim
+    uint32_t count;
+    struct loader_json_load *loads;
+    uint32_t worker_count;
+    loader_platform_thread workers[LOADER_PREFETCH_MAX_WORKERS];
+};
+
+static LOADER_PLATFORM_THREAD_FUNCTION(loader_json_prefetch_worker, arg) {
+    struct loader_json_prefetch *prefetch = (struct loader_json_prefetch *)arg;
+
+    loader_platform_thread_lock_mutex(&prefetch->lock);
+    for (;;) {
+        while (prefetch->next < prefetch->count && prefetch->loads[prefetch->next].claimed) {
+            prefetch->next++;
+        }
+        if (prefetch->next >= prefetch->count) {
+            break;
+        }
+        struct loader_json_load *load = &prefetch->loads[prefetch->next++];
+        load->claimed = true;
+        loader_platform_thread_unlock_mutex(&prefetch->lock);
+
+        loader_load_json(load);
+
+        loader_platform_thread_lock_mutex(&prefetch->lock);
+        load->done = true;
+        loader_platform_thread_cond_broadcast(&prefetch->loaded);
+    }
+    loader_platform_thread_unlock_mutex(&prefetch->lock);
+    return LOADER_PLATFORM_THREAD_RETURN;
+}
+
+// Set up a prefetch over the given manifest lists, indexed across the lists in
+// order.  Returns NULL if prefetching doesn't apply, in which case files are
+// loaded as the scan reaches them.
+static struct loader_json_prefetch *loader_prefetch_json(const struct loader_instance *inst,
+                                                         const struct loader_manifest_files *lists, uint32_t list_count) {
+    struct loader_json_prefetch *prefetch;
+    uint32_t count = 0;
+
+    char *disable = loader_getenv("VK_LOADER_DISABLE_PARALLEL_SCAN", inst);
+    bool disabled = disable != NULL && disable[0] != '\0' && strcmp(disable, "0");
+    loader_free_getenv(disable, inst);
+    if (disabled) {
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < list_count; i++) {
+        count += lists[i].count;
+    }
+    if (count < 2) {
+        return NULL;
+    }
+    prefetch = loader_instance_heap_alloc(inst, sizeof(struct loader_json_prefetch) + sizeof(struct loader_json_load) * count,
+                                          VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    if (prefetch == NULL) {
+        return NULL;
+    }
+    memset(prefetch, 0, sizeof(struct loader_json_prefetch) + sizeof(struct loader_json_load) * count);
+    prefetch->count = count;
+    prefetch->loads = (struct loader_json_load *)(prefetch + 1);
+    for (uint32_t i = 0, index = 0; i < list_count; i++) {
+        for (uint32_t j = 0; j < lists[i].count; j++, index++) {
+            prefetch->loads[index].filename = lists[i].filename_list[j];
+            // Nothing to load for entries the scan will skip
+            prefetch->loads[index].claimed = prefetch->loads[index].filename == NULL;
+        }
+    }
+    loader_platform_thread_create_mutex(&prefetch->lock);
+    loader_platform_thread_init_cond(&prefetch->loaded);
+
+    // Workers must not be the first to touch the cache, it reads the environment
+    loader_platform_thread_lock_mutex(&loader_manifest_cache_lock);
+    loader_manifest_cache_init(inst);
+    loader_platform_thread_unlock_mutex(&loader_manifest_cache_lock);
+
+    return prefetch;
+}
+
+// Get the load for an index, loading it here unless a worker already claimed it.
+static struct loader_json_load *loader_prefetch_json_take(struct loader_json_prefetch *prefetch, uint32_t index) {
+    struct loader_json_load *load = &prefetch->loads[index];
+
+    loader_platform_thread_lock_mutex(&prefetch->lock);
+    if (load->claimed) {
+        while (!load->done) {
+            loader_platform_thread_cond_wait(&prefetch->loaded, &prefetch->lock);
+        }
+        loader_platform_thread_unlock_mutex(&prefetch->lock);
+        return load;
+    }
+    load->claimed = true;
+    loader_platform_thread_unlock_mutex(&prefetch->lock);
+
+    if (loader_load_json(load) && prefetch->worker_count == 0) {
+        // If no worker can be started the scan just carries on by itself
+        while (prefetch->worker_count < LOADER_PREFETCH_MAX_WORKERS && index + 1 + prefetch->worker_count < prefetch->count) {
+            if (!loader_platform_thread_create(&prefetch->workers[prefetch->worker_count], loader_json_prefetch_worker,
+                                               prefetch)) {
+                break;
+            }
+            prefetch->worker_count++;
+        }
+    }
+    load->done = true;
+    return load;
+}
+
+// Stop and join the workers and release any results the scan didn't consume
+static void loader_free_json_prefetch(const struct loader_instance *inst, struct loader_json_prefetch *prefetch) {
+    if (prefetch == NULL) {
+        return;
+    }
+    loader_platform_thread_lock_mutex(&prefetch->lock);
+    prefetch->next = prefetch->count;
+    loader_platform_thread_unlock_mutex(&prefetch->lock);
+    for (uint32_t i = 0; i < prefetch->worker_count; i++) {
+        loader_platform_thread_join(prefetch->workers[i]);
+    }
+    for (uint32_t i = 0; i < prefetch->count; i++) {
+        free(prefetch->loads[i].text);
+    }
+    loader_platform_thread_delete_cond(&prefetch->loaded);
+    loader_platform_thread_delete_mutex(&prefetch->lock);
+    loader_instance_heap_free(inst, prefetch);
+}
+
+// Read a JSON file into a buffer.
+//
+// Manifests are served from the manifest cache when the file's mtime and size
+// have not changed since it was last read.  When the scan has a prefetch,
+// index is the file's position in it.
+//
+// @return -  The NUL-terminated text of the manifest, already checked to be
+//            well-formed JSON, to be read with a json_reader.
+//            This returned buffer should be freed by caller with free().
+static VkResult loader_get_json(const struct loader_instance *inst, const char *filename, struct loader_json_prefetch *prefetch,
+                                uint32_t index, char **json, size_t *json_len) {
+    struct loader_json_load load;
+
+    if (NULL == json) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_get_json: Received invalid JSON file");
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    if (prefetch != NULL) {
+        return loader_finish_json(inst, loader_prefetch_json_take(prefetch, index), json, json_len);
+    }
+
+    loader_platform_thread_lock_mutex(&loader_manifest_cache_lock);
+    loader_manifest_cache_init(inst);
+    loader_platform_thread_unlock_mutex(&loader_manifest_cache_lock);
+
+    memset(&load, 0, sizeof(load));
+    load.filename = filename;
+    loader_load_json(&load);
+    return loader_finish_json(inst, &load, json, json_len);
+}
+
+static int loader_compare_names(const void *a, const void *b) {
+    return strcmp(*(const char *const *)a, *(const char *const *)b);
+}
+
+// Copy names into a single allocation holding a NULL-terminated pointer array
+// followed by the strings.  The array is sorted so it can be searched with
+// loader_compare_entry_name.
+static char **loader_alloc_name_array(const struct loader_instance *inst, char *const *names, uint32_t count) {
+    size_t size = sizeof(char *) * (count + 1);
+    char **array;
+    char *str;
+
+    for (uint32_t i = 0; i < count; i++) {
+        size += strlen(names[i]) + 1;
+    }
+    array = loader_instance_heap_alloc(inst, size, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL == array) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "loader_alloc_name_array: Failed to allocate space "
+                   "for %d names",
+                   count);
+        return NULL;
+    }
+    str = (char *)&array[count + 1];
+    for (uint32_t i = 0; i < count; i++) {
+        array[i] = str;
+        strcpy(str, names[i]);
+        str += strlen(str) + 1;
+    }
+    array[count] = NULL;
+    qsort(array, count, sizeof(char *), loader_compare_names);
+    return array;
+}
+
 // Do a deep copy of the loader_layer_properties structure.
 VkResult loader_copy_layer_properties(const struct loader_instance *inst, struct loader_layer_properties *dst,
                                       struct loader_layer_properties *src) {
@@ -1730,6 +2729,13 @@ VkResult loader_copy_layer_properties(const struct loader_instance *inst, struct
         }
     }
 
+    if (NULL != src->intercepted_functions) {
+        dst->intercepted_functions = loader_alloc_name_array(inst, src->intercepted_functions, src->intercepted_function_count);
+        if (NULL == dst->intercepted_functions) {
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+    }
+
     return VK_SUCCESS;
 }
 
@@ -1865,96 +2871,231 @@ static void loader_add_layer_property_meta(const struct loader_instance *inst, u
             // Error already triggered in loader_get_next_layer_property.
             return;
         }
-        loader_init_std_validation_props(props);
+        loader_init_std_validation_props(props);
+    }
+}
+
+// This structure is used to store the json file version
+// in a more manageable way.
+typedef struct {
+    uint16_t major;
+    uint16_t minor;
+    uint16_t patch;
+} layer_json_version;
+
+// Find the named members of the JSON object that is the next value of reader,
+// consuming the object.  For each name, values[i] is left positioned at the
+// value of the first member with that name and found[i] says whether there
+// was one.
+static bool loader_json_find_members(struct json_reader *reader, const char *const *names, uint32_t count,
+                                     struct json_reader *values, bool *found) {
+    const char *key;
+    size_t key_len;
+
+    memset(found, 0, sizeof(bool) * count);
+    if (!json_reader_begin_object(reader)) {
+        return false;
+    }
+    while (json_reader_next_member(reader, &key, &key_len)) {
+        for (uint32_t i = 0; i < count; i++) {
+            if (!found[i] && json_reader_key_equals(key, key_len, names[i])) {
+                values[i] = *reader;
+                found[i] = true;
+                break;
+            }
+        }
+        json_reader_skip(reader);
+    }
+    return !reader->failed;
+}
+
+// Read an environment variable object such as "disable_environment", whose
+// first member names the variable and gives its value
+static bool loader_read_json_env_var(struct json_reader *reader, struct loader_name_value *env_var) {
+    const char *key;
+    size_t key_len;
+
+    if (!json_reader_begin_object(reader) || !json_reader_next_member(reader, &key, &key_len)) {
+        return false;
+    }
+    json_reader_copy_key(key, key_len, env_var->name, sizeof(env_var->name));
+    return json_reader_read_string(reader, env_var->value, sizeof(env_var->value));
+}
+
+// Members of an "instance_extensions" or "device_extensions" array element
+enum loader_json_ext_member {
+    JSON_EXT_NAME = 0,
+    JSON_EXT_SPEC_VERSION,
+    JSON_EXT_ENTRYPOINTS,
+    JSON_EXT_MEMBER_COUNT,
+};
+
+static const char *const loader_json_ext_members[JSON_EXT_MEMBER_COUNT] = {"name", "spec_version", "entrypoints"};
+
+// Read the name and spec_version of an extensions array element.  Returns
+// false if the element has no name.
+static bool loader_read_json_ext_props(struct json_reader *ext_item, struct json_reader *values, VkExtensionProperties *ext_prop) {
+    bool found[JSON_EXT_MEMBER_COUNT];
+    char spec_version[64];
+
+    if (!loader_json_find_members(ext_item, loader_json_ext_members, JSON_EXT_MEMBER_COUNT, values, found) ||
+        !found[JSON_EXT_NAME] ||
+        !json_reader_read_string(&values[JSON_EXT_NAME], ext_prop->extensionName, sizeof(ext_prop->extensionName))) {
+        return false;
+    }
+    ext_prop->specVersion = 0;
+    if (found[JSON_EXT_SPEC_VERSION] &&
+        json_reader_read_string(&values[JSON_EXT_SPEC_VERSION], spec_version, sizeof(spec_version))) {
+        ext_prop->specVersion = atoi(spec_version);
+    }
+    if (!found[JSON_EXT_ENTRYPOINTS]) {
+        json_reader_init(&values[JSON_EXT_ENTRYPOINTS], NULL, 0);
+    }
+    return true;
+}
+
+// device_extensions element
+//   {
+//     name
+//     spec_version
+//     entrypoints (optional)
+//   }
+static void loader_read_json_device_extension(const struct loader_instance *inst, struct loader_layer_properties *props,
+                                              struct json_reader *ext_item) {
+    struct json_reader values[JSON_EXT_MEMBER_COUNT];
+    VkExtensionProperties ext_prop;
+    char **entry_array = NULL;
+    uint32_t entry_count = 0;
+
+    if (!loader_read_json_ext_props(ext_item, values, &ext_prop)) {
+        return;
+    }
+    struct json_reader *entrypoints = &values[JSON_EXT_ENTRYPOINTS];
+    if (json_reader_peek(entrypoints) == JSON_READER_ARRAY) {
+        uint32_t max_count = json_reader_count_elements(entrypoints);
+        if (max_count > 0) {
+            // Entry point names are function names, well short of the extension name limit
+            entry_array = (char **)loader_stack_alloc(sizeof(char *) * max_count);
+            char *names = (char *)loader_stack_alloc(VK_MAX_EXTENSION_NAME_SIZE * max_count);
+            json_reader_begin_array(entrypoints);
+            while (entry_count < max_count && json_reader_next_element(entrypoints)) {
+                entry_array[entry_count] = &names[VK_MAX_EXTENSION_NAME_SIZE * entry_count];
+                if (json_reader_read_string(entrypoints, entry_array[entry_count], VK_MAX_EXTENSION_NAME_SIZE)) {
+                    entry_count++;
+                }
+            }
+        }
     }
+    loader_add_to_dev_ext_list(inst, &props->device_extension_list, &ext_prop, entry_count, entry_array);
 }
 
-// This structure is used to store the json file version
-// in a more manageable way.
-typedef struct {
-    uint16_t major;
-    uint16_t minor;
-    uint16_t patch;
-} layer_json_version;
+// Members of a "layer" object that the loader reads
+enum loader_json_layer_member {
+    JSON_LAYER_NAME = 0,
+    JSON_LAYER_TYPE,
+    JSON_LAYER_LIBRARY_PATH,
+    JSON_LAYER_API_VERSION,
+    JSON_LAYER_IMPLEMENTATION_VERSION,
+    JSON_LAYER_DESCRIPTION,
+    JSON_LAYER_DISABLE_ENVIRONMENT,
+    JSON_LAYER_FUNCTIONS,
+    JSON_LAYER_INSTANCE_EXTENSIONS,
+    JSON_LAYER_DEVICE_EXTENSIONS,
+    JSON_LAYER_ENABLE_ENVIRONMENT,
+    JSON_LAYER_INTERCEPTED_FUNCTIONS,
+    JSON_LAYER_MEMBER_COUNT,
+};
+
+static const char *const loader_json_layer_members[JSON_LAYER_MEMBER_COUNT] = {
+    "name", "type", "library_path", "api_version", "implementation_version", "description", "disable_environment",
+    "functions", "instance_extensions", "device_extensions", "enable_environment", "intercepted_functions"};
+
+// Members of a layer's "functions" object
+enum loader_json_function_member {
+    JSON_FUNCTION_NEGOTIATE = 0,
+    JSON_FUNCTION_GIPA,
+    JSON_FUNCTION_GDPA,
+    JSON_FUNCTION_MEMBER_COUNT,
+};
+
+static const char *const loader_json_function_members[JSON_FUNCTION_MEMBER_COUNT] = {
+    "vkNegotiateLoaderLayerInterfaceVersion", "vkGetInstanceProcAddr", "vkGetDeviceProcAddr"};
 
+// Read one "layer" object, the next value of layer_node, into a new entry of
+// layer_instance_list.  Values are unescaped straight from the manifest text
+// into the layer properties.
 static void loader_read_json_layer(const struct loader_instance *inst, struct loader_layer_list *layer_instance_list,
-                                   cJSON *layer_node, layer_json_version version, cJSON *item, cJSON *disable_environment,
-                                   bool is_implicit, char *filename) {
-    char *temp;
-    char *name, *type, *library_path, *api_version;
-    char *implementation_version, *description;
-    cJSON *ext_item;
-    VkExtensionProperties ext_prop;
+                                   struct json_reader *layer_node, layer_json_version version, bool is_implicit, char *filename) {
+    struct json_reader values[JSON_LAYER_MEMBER_COUNT];
+    bool found[JSON_LAYER_MEMBER_COUNT];
+    char name[VK_MAX_EXTENSION_NAME_SIZE];
+    char type[64];
+    char library_path[MAX_STRING_SIZE];
+    char api_version[64];
+    char implementation_version[64];
+    char description[VK_MAX_DESCRIPTION_SIZE];
+    struct {
+        uint32_t member;
+        char *value;
+        size_t size;
+    } required[] = {
+        {JSON_LAYER_NAME, name, sizeof(name)},
+        {JSON_LAYER_TYPE, type, sizeof(type)},
+        {JSON_LAYER_LIBRARY_PATH, library_path, sizeof(library_path)},
+        {JSON_LAYER_API_VERSION, api_version, sizeof(api_version)},
+        {JSON_LAYER_IMPLEMENTATION_VERSION, implementation_version, sizeof(implementation_version)},
+        {JSON_LAYER_DESCRIPTION, description, sizeof(description)},
+    };
 
-// The following are required in the "layer" object:
-// (required) "name"
-// (required) "type"
-// (required) “library_path”
-// (required) “api_version”
-// (required) “implementation_version”
-// (required) “description”
-// (required for implicit layers) “disable_environment”
-#define GET_JSON_OBJECT(node, var)                                         \
-    {                                                                      \
-        var = cJSON_GetObjectItem(node, #var);                             \
-        if (var == NULL) {                                                 \
-            layer_node = layer_node->next;                                 \
-            loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,           \
-                       "Didn't find required layer object %s in manifest " \
-                       "JSON file, skipping this layer",                   \
-                       #var);                                              \
-            return;                                                        \
-        }                                                                  \
-    }
-#define GET_JSON_ITEM(node, var)                                               \
-    {                                                                          \
-        item = cJSON_GetObjectItem(node, #var);                                \
-        if (item == NULL) {                                                    \
-            layer_node = layer_node->next;                                     \
-            loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,               \
-                       "Didn't find required layer value %s in manifest JSON " \
-                       "file, skipping this layer",                            \
-                       #var);                                                  \
-            return;                                                            \
-        }                                                                      \
-        temp = cJSON_Print(item);                                              \
-        if (temp == NULL) {                                                    \
-            layer_node = layer_node->next;                                     \
-            loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,               \
-                       "Problem accessing layer value %s in manifest JSON "    \
-                       "file, skipping this layer",                            \
-                       #var);                                                  \
-            return;                                                            \
-        }                                                                      \
-        temp[strlen(temp) - 1] = '\0';                                         \
-        var = loader_stack_alloc(strlen(temp) + 1);                            \
-        strcpy(var, &temp[1]);                                                 \
-        cJSON_Free(temp);                                                      \
-    }
-    GET_JSON_ITEM(layer_node, name)
-    GET_JSON_ITEM(layer_node, type)
-    GET_JSON_ITEM(layer_node, library_path)
-    GET_JSON_ITEM(layer_node, api_version)
-    GET_JSON_ITEM(layer_node, implementation_version)
-    GET_JSON_ITEM(layer_node, description)
-    if (is_implicit) {
-        GET_JSON_OBJECT(layer_node, disable_environment)
+    if (!loader_json_find_members(layer_node, loader_json_layer_members, JSON_LAYER_MEMBER_COUNT, values, found)) {
+        loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
+                   "Layer object in manifest JSON file %s is not a JSON object, "
+                   "skipping this layer",
+                   filename);
+        return;
+    }
+
+    // The following are required in the "layer" object:
+    // (required) "name"
+    // (required) "type"
+    // (required) “library_path”
+    // (required) “api_version”
+    // (required) “implementation_version”
+    // (required) “description”
+    // (required for implicit layers) “disable_environment”
+    for (uint32_t i = 0; i < sizeof(required) / sizeof(required[0]); i++) {
+        if (!found[required[i].member]) {
+            loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
+                       "Didn't find required layer value %s in manifest JSON "
+                       "file, skipping this layer",
+                       loader_json_layer_members[required[i].member]);
+            return;
+        }
+        if (!json_reader_read_string(&values[required[i].member], required[i].value, required[i].size)) {
+            loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
+                       "Problem accessing layer value %s in manifest JSON "
+                       "file, skipping this layer",
+                       loader_json_layer_members[required[i].member]);
+            return;
+        }
+    }
+    if (is_implicit && !found[JSON_LAYER_DISABLE_ENVIRONMENT]) {
+        loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
+                   "Didn't find required layer object disable_environment in manifest "
+                   "JSON file, skipping this layer");
+        return;
     }
-#undef GET_JSON_ITEM
-#undef GET_JSON_OBJECT
 
     // Add list entry
     struct loader_layer_properties *props = NULL;
     if (!strcmp(type, "DEVICE")) {
         loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0, "Device layers are deprecated skipping this layer");
-        layer_node = layer_node->next;
         return;
     }
     // Allow either GLOBAL or INSTANCE type interchangeably to handle
     // layers that must work with older loaders
     if (!strcmp(type, "INSTANCE") || !strcmp(type, "GLOBAL")) {
         if (layer_instance_list == NULL) {
-            layer_node = layer_node->next;
             return;
         }
         props = loader_get_next_layer_property(inst, layer_instance_list);
@@ -1966,7 +3107,6 @@ static void loader_read_json_layer(const struct loader_instance *inst, struct lo
     }
 
     if (props == NULL) {
-        layer_node = layer_node->next;
         return;
     }
 
@@ -1990,69 +3130,37 @@ static void loader_read_json_layer(const struct loader_instance *inst, struct lo
     strncpy((char *)props->info.description, description, sizeof(props->info.description));
     props->info.description[sizeof(props->info.description) - 1] = '\0';
     if (is_implicit) {
-        if (!disable_environment || !disable_environment->child) {
+        if (!loader_read_json_env_var(&values[JSON_LAYER_DISABLE_ENVIRONMENT], &props->disable_env_var)) {
             loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
                        "Didn't find required layer child value disable_environment"
                        "in manifest JSON file, skipping this layer");
-            layer_node = layer_node->next;
             return;
         }
-        strncpy(props->disable_env_var.name, disable_environment->child->string, sizeof(props->disable_env_var.name));
-        props->disable_env_var.name[sizeof(props->disable_env_var.name) - 1] = '\0';
-        strncpy(props->disable_env_var.value, disable_environment->child->valuestring, sizeof(props->disable_env_var.value));
-        props->disable_env_var.value[sizeof(props->disable_env_var.value) - 1] = '\0';
-    }
-
-// Now get all optional items and objects and put in list:
-// functions
-// instance_extensions
-// device_extensions
-// enable_environment (implicit layers only)
-#define GET_JSON_OBJECT(node, var) \
-    { var = cJSON_GetObjectItem(node, #var); }
-#define GET_JSON_ITEM(node, var)                            \
-    {                                                       \
-        item = cJSON_GetObjectItem(node, #var);             \
-        if (item != NULL) {                                 \
-            temp = cJSON_Print(item);                       \
-            if (temp != NULL) {                             \
-                temp[strlen(temp) - 1] = '\0';              \
-                var = loader_stack_alloc(strlen(temp) + 1); \
-                strcpy(var, &temp[1]);                      \
-                cJSON_Free(temp);                           \
-            }                                               \
-        }                                                   \
-    }
-
-    cJSON *instance_extensions, *device_extensions, *functions, *enable_environment;
-    cJSON *entrypoints = NULL;
-    char *vkGetInstanceProcAddr = NULL;
-    char *vkGetDeviceProcAddr = NULL;
-    char *vkNegotiateLoaderLayerInterfaceVersion = NULL;
-    char *spec_version = NULL;
-    char **entry_array = NULL;
-    entrypoints = NULL;
-    int i, j;
+    }
+
+    // Now get all optional items and objects and put in list:
+    // functions
+    // instance_extensions
+    // device_extensions
+    // enable_environment (implicit layers only)
 
     // Layer interface functions
     //    vkGetInstanceProcAddr
     //    vkGetDeviceProcAddr
     //    vkNegotiateLoaderLayerInterfaceVersion (starting with JSON file 1.1.0)
-    GET_JSON_OBJECT(layer_node, functions)
-    if (functions != NULL) {
-        if (version.major > 1 || version.minor >= 1) {
-            GET_JSON_ITEM(functions, vkNegotiateLoaderLayerInterfaceVersion)
-            if (vkNegotiateLoaderLayerInterfaceVersion != NULL)
-                strncpy(props->functions.str_negotiate_interface, vkNegotiateLoaderLayerInterfaceVersion,
-                        sizeof(props->functions.str_negotiate_interface));
-            props->functions.str_negotiate_interface[sizeof(props->functions.str_negotiate_interface) - 1] = '\0';
-        } else {
-            props->functions.str_negotiate_interface[0] = '\0';
-        }
-        GET_JSON_ITEM(functions, vkGetInstanceProcAddr)
-        GET_JSON_ITEM(functions, vkGetDeviceProcAddr)
-        if (vkGetInstanceProcAddr != NULL) {
-            strncpy(props->functions.str_gipa, vkGetInstanceProcAddr, sizeof(props->functions.str_gipa));
+    if (found[JSON_LAYER_FUNCTIONS]) {
+        struct json_reader functions[JSON_FUNCTION_MEMBER_COUNT];
+        bool found_function[JSON_FUNCTION_MEMBER_COUNT];
+        if (!loader_json_find_members(&values[JSON_LAYER_FUNCTIONS], loader_json_function_members, JSON_FUNCTION_MEMBER_COUNT,
+                                      functions, found_function)) {
+            memset(found_function, 0, sizeof(found_function));
+        }
+        if ((version.major > 1 || version.minor >= 1) && found_function[JSON_FUNCTION_NEGOTIATE]) {
+            json_reader_read_string(&functions[JSON_FUNCTION_NEGOTIATE], props->functions.str_negotiate_interface,
+                                    sizeof(props->functions.str_negotiate_interface));
+        }
+        if (found_function[JSON_FUNCTION_GIPA] &&
+            json_reader_read_string(&functions[JSON_FUNCTION_GIPA], props->functions.str_gipa, sizeof(props->functions.str_gipa))) {
             if (version.major > 1 || version.minor >= 1) {
                 loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
                            "Indicating layer-specific vkGetInstanceProcAddr "
@@ -2063,9 +3171,8 @@ static void loader_read_json_layer(const struct loader_instance *inst, struct lo
                            "layer");
             }
         }
-        props->functions.str_gipa[sizeof(props->functions.str_gipa) - 1] = '\0';
-        if (vkGetDeviceProcAddr != NULL) {
-            strncpy(props->functions.str_gdpa, vkGetDeviceProcAddr, sizeof(props->functions.str_gdpa));
+        if (found_function[JSON_FUNCTION_GDPA] &&
+            json_reader_read_string(&functions[JSON_FUNCTION_GDPA], props->functions.str_gdpa, sizeof(props->functions.str_gdpa))) {
             if (version.major > 1 || version.minor >= 1) {
                 loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
                            "Indicating layer-specific vkGetDeviceProcAddr "
@@ -2076,7 +3183,6 @@ static void loader_read_json_layer(const struct loader_instance *inst, struct lo
                            "layer");
             }
         }
-        props->functions.str_gdpa[sizeof(props->functions.str_gdpa) - 1] = '\0';
     }
 
     // instance_extensions
@@ -2084,21 +3190,13 @@ static void loader_read_json_layer(const struct loader_instance *inst, struct lo
     //     name
     //     spec_version
     //   }
-    GET_JSON_OBJECT(layer_node, instance_extensions)
-    if (instance_extensions != NULL) {
-        int count = cJSON_GetArraySize(instance_extensions);
-        for (i = 0; i < count; i++) {
-            ext_item = cJSON_GetArrayItem(instance_extensions, i);
-            GET_JSON_ITEM(ext_item, name)
-            if (name != NULL) {
-                strncpy(ext_prop.extensionName, name, sizeof(ext_prop.extensionName));
-                ext_prop.extensionName[sizeof(ext_prop.extensionName) - 1] = '\0';
-            }
-            GET_JSON_ITEM(ext_item, spec_version)
-            if (NULL != spec_version) {
-                ext_prop.specVersion = atoi(spec_version);
-            } else {
-                ext_prop.specVersion = 0;
+    if (found[JSON_LAYER_INSTANCE_EXTENSIONS] && json_reader_begin_array(&values[JSON_LAYER_INSTANCE_EXTENSIONS])) {
+        struct json_reader *ext_item = &values[JSON_LAYER_INSTANCE_EXTENSIONS];
+        while (json_reader_next_element(ext_item)) {
+            struct json_reader ext_values[JSON_EXT_MEMBER_COUNT];
+            VkExtensionProperties ext_prop;
+            if (!loader_read_json_ext_props(ext_item, ext_values, &ext_prop)) {
+                continue;
             }
             bool ext_unsupported = wsi_unsupported_instance_extension(&ext_prop);
             if (!ext_unsupported) {
@@ -2113,68 +3211,48 @@ static void loader_read_json_layer(const struct loader_instance *inst, struct lo
     //     spec_version
     //     entrypoints
     //   }
-    GET_JSON_OBJECT(layer_node, device_extensions)
-    if (device_extensions != NULL) {
-        int count = cJSON_GetArraySize(device_extensions);
-        for (i = 0; i < count; i++) {
-            ext_item = cJSON_GetArrayItem(device_extensions, i);
-            GET_JSON_ITEM(ext_item, name)
-            GET_JSON_ITEM(ext_item, spec_version)
-            if (name != NULL) {
-                strncpy(ext_prop.extensionName, name, sizeof(ext_prop.extensionName));
-                ext_prop.extensionName[sizeof(ext_prop.extensionName) - 1] = '\0';
-            }
-            if (NULL != spec_version) {
-                ext_prop.specVersion = atoi(spec_version);
-            } else {
-                ext_prop.specVersion = 0;
-            }
-            // entrypoints = cJSON_GetObjectItem(ext_item, "entrypoints");
-            GET_JSON_OBJECT(ext_item, entrypoints)
-            int entry_count;
-            if (entrypoints == NULL) {
-                loader_add_to_dev_ext_list(inst, &props->device_extension_list, &ext_prop, 0, NULL);
-                continue;
-            }
-            entry_count = cJSON_GetArraySize(entrypoints);
-            if (entry_count) {
-                entry_array = (char **)loader_stack_alloc(sizeof(char *) * entry_count);
-            }
-            for (j = 0; j < entry_count; j++) {
-                ext_item = cJSON_GetArrayItem(entrypoints, j);
-                if (ext_item != NULL) {
-                    temp = cJSON_Print(ext_item);
-                    if (NULL == temp) {
-                        entry_array[j] = NULL;
-                        continue;
-                    }
-                    temp[strlen(temp) - 1] = '\0';
-                    entry_array[j] = loader_stack_alloc(strlen(temp) + 1);
-                    strcpy(entry_array[j], &temp[1]);
-                    cJSON_Free(temp);
-                }
-            }
-            loader_add_to_dev_ext_list(inst, &props->device_extension_list, &ext_prop, entry_count, entry_array);
+    if (found[JSON_LAYER_DEVICE_EXTENSIONS] && json_reader_begin_array(&values[JSON_LAYER_DEVICE_EXTENSIONS])) {
+        struct json_reader *ext_item = &values[JSON_LAYER_DEVICE_EXTENSIONS];
+        while (json_reader_next_element(ext_item)) {
+            loader_read_json_device_extension(inst, props, ext_item);
         }
     }
-    if (is_implicit) {
-        GET_JSON_OBJECT(layer_node, enable_environment)
 
-        // enable_environment is optional
-        if (enable_environment) {
-            strncpy(props->enable_env_var.name, enable_environment->child->string, sizeof(props->enable_env_var.name));
-            props->enable_env_var.name[sizeof(props->enable_env_var.name) - 1] = '\0';
-            strncpy(props->enable_env_var.value, enable_environment->child->valuestring, sizeof(props->enable_env_var.value));
-            props->enable_env_var.value[sizeof(props->enable_env_var.value) - 1] = '\0';
+    // enable_environment is optional
+    if (is_implicit && found[JSON_LAYER_ENABLE_ENVIRONMENT]) {
+        loader_read_json_env_var(&values[JSON_LAYER_ENABLE_ENVIRONMENT], &props->enable_env_var);
+    }
+
+    // intercepted_functions (starting with JSON file 1.1.1)
+    //   array of device command names
+    if (found[JSON_LAYER_INTERCEPTED_FUNCTIONS]) {
+        struct json_reader *functions = &values[JSON_LAYER_INTERCEPTED_FUNCTIONS];
+        if (version.major == 1 && (version.minor == 0 || (version.minor == 1 && version.patch == 0))) {
+            loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
+                       "Layer %s lists intercepted_functions, which needs JSON "
+                       "file version 1.1.1 or newer.  Ignoring the list.",
+                       name);
+        } else if (json_reader_peek(functions) == JSON_READER_ARRAY) {
+            uint32_t max_count = json_reader_count_elements(functions);
+            uint32_t count = 0;
+            char **function_array = (char **)loader_stack_alloc(sizeof(char *) * (max_count + 1));
+            char *function_names = (char *)loader_stack_alloc(VK_MAX_EXTENSION_NAME_SIZE * (max_count + 1));
+            json_reader_begin_array(functions);
+            while (count < max_count && json_reader_next_element(functions)) {
+                function_array[count] = &function_names[VK_MAX_EXTENSION_NAME_SIZE * count];
+                if (json_reader_read_string(functions, function_array[count], VK_MAX_EXTENSION_NAME_SIZE)) {
+                    count++;
+                }
+            }
+            props->intercepted_functions = loader_alloc_name_array(inst, function_array, count);
+            props->intercepted_function_count = (NULL != props->intercepted_functions) ? count : 0;
         }
     }
-#undef GET_JSON_ITEM
-#undef GET_JSON_OBJECT
 }
 
 static inline bool is_valid_layer_json_version(const layer_json_version *layer_json) {
-    // Supported versions are: 1.0.0, 1.0.1, and 1.1.0.
-    if ((layer_json->major == 1 && layer_json->minor == 1 && layer_json->patch == 0) ||
+    // Supported versions are: 1.0.0, 1.0.1, 1.1.0 and 1.1.1.
+    if ((layer_json->major == 1 && layer_json->minor == 1 && layer_json->patch < 2) ||
         (layer_json->major == 1 && layer_json->minor == 0 && layer_json->patch < 2)) {
         return true;
     }
@@ -2189,9 +3267,9 @@ static inline bool layer_json_supports_layers_tag(const layer_json_version *laye
     return false;
 }
 
-// Given a cJSON struct (json) of the top level JSON object from layer manifest
-// file, add entry to the layer_list. Fill out the layer_properties in this list
-// entry from the input cJSON object.
+// Given the text (json) of a layer manifest file, add entries to the
+// layer_list.  Fill out the layer_properties in each list entry straight from
+// the manifest.
 //
 // \returns
 // void
@@ -2199,27 +3277,49 @@ static inline bool layer_json_supports_layers_tag(const layer_json_version *laye
 // If the json input object does not have all the required fields no entry
 // is added to the list.
 static void loader_add_layer_properties(const struct loader_instance *inst, struct loader_layer_list *layer_instance_list,
-                                        cJSON *json, bool is_implicit, char *filename) {
+                                        const char *json, size_t json_len, bool is_implicit, char *filename) {
     // The following Fields in layer manifest file that are required:
     //   - “file_format_version”
     //   - If more than one "layer" object are used, then the "layers" array is
     //     required
 
-    cJSON *item, *layers_node, *layer_node;
+    struct json_reader reader, version_node, layers_node, layer_node;
+    bool have_version = false, have_layers = false;
+    uint16_t layer_count = 0;
+    const char *key;
+    size_t key_len;
     layer_json_version json_version = {0, 0, 0};
+    char file_vers[64];
+    char vers_copy[64];
     char *vers_tok;
-    cJSON *disable_environment = NULL;
-    item = cJSON_GetObjectItem(json, "file_format_version");
-    if (item == NULL) {
+
+    // Find "file_format_version", "layers" and any "layer" objects
+    json_reader_init(&reader, json, json_len);
+    if (!json_reader_begin_object(&reader)) {
         return;
     }
-    char *file_vers = cJSON_PrintUnformatted(item);
-    if (NULL == file_vers) {
+    while (json_reader_next_member(&reader, &key, &key_len)) {
+        if (!have_version && json_reader_key_equals(key, key_len, "file_format_version")) {
+            version_node = reader;
+            have_version = true;
+        } else if (!have_layers && json_reader_key_equals(key, key_len, "layers")) {
+            layers_node = reader;
+            have_layers = true;
+        } else if (json_reader_key_equals(key, key_len, "layer")) {
+            if (layer_count == 0) {
+                layer_node = reader;
+            }
+            layer_count++;
+        }
+        json_reader_skip(&reader);
+    }
+    if (!have_version || !json_reader_read_string(&version_node, file_vers, sizeof(file_vers))) {
         return;
     }
-    loader_log(inst, VK_DEBUG_REPORT_INFORMATION_BIT_EXT, 0, "Found manifest file %s, version %s", filename, file_vers);
+    loader_log(inst, VK_DEBUG_REPORT_INFORMATION_BIT_EXT, 0, "Found manifest file %s, version \"%s\"", filename, file_vers);
     // Get the major/minor/and patch as integers for easier comparison
-    vers_tok = strtok(file_vers, ".\"\n\r");
+    strcpy(vers_copy, file_vers);
+    vers_tok = strtok(vers_copy, ".\"\n\r");
     if (NULL != vers_tok) {
         json_version.major = (uint16_t)atoi(vers_tok);
         vers_tok = strtok(NULL, ".\"\n\r");
@@ -2238,12 +3338,9 @@ static void loader_add_layer_properties(const struct loader_instance *inst, stru
                    " manifest file version %d.%d.%d.  May cause errors.",
                    filename, json_version.major, json_version.minor, json_version.patch);
     }
-    cJSON_Free(file_vers);
 
     // If "layers" is present, read in the array of layer objects
-    layers_node = cJSON_GetObjectItem(json, "layers");
-    if (layers_node != NULL) {
-        int numItems = cJSON_GetArraySize(layers_node);
+    if (have_layers) {
         if (!layer_json_supports_layers_tag(&json_version)) {
             loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
                        "loader_add_layer_properties: \'layers\' tag not "
@@ -2251,37 +3348,27 @@ static void loader_add_layer_properties(const struct loader_instance *inst, stru
                        "reporting version %s",
                        filename, file_vers);
         }
-        for (int curLayer = 0; curLayer < numItems; curLayer++) {
-            layer_node = cJSON_GetArrayItem(layers_node, curLayer);
-            if (layer_node == NULL) {
-                loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
-                           "loader_add_layer_properties: Can not find "
-                           "\'layers\' array element %d object in manifest "
-                           "JSON file %s.  Skipping this file",
-                           curLayer, filename);
-                return;
-            }
-            loader_read_json_layer(inst, layer_instance_list, layer_node, json_version, item, disable_environment, is_implicit,
-                                   filename);
+        if (!json_reader_begin_array(&layers_node)) {
+            loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
+                       "loader_add_layer_properties: \'layers\' in manifest "
+                       "JSON file %s is not an array.  Skipping this file",
+                       filename);
+            return;
+        }
+        while (json_reader_next_element(&layers_node)) {
+            layer_node = layers_node;
+            json_reader_skip(&layers_node);
+            loader_read_json_layer(inst, layer_instance_list, &layer_node, json_version, is_implicit, filename);
         }
     } else {
         // Otherwise, try to read in individual layers
-        layer_node = cJSON_GetObjectItem(json, "layer");
-        if (layer_node == NULL) {
+        if (layer_count == 0) {
             loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
                        "loader_add_layer_properties: Can not find \'layer\' "
                        "object in manifest JSON file %s.  Skipping this file.",
                        filename);
             return;
         }
-        // Loop through all "layer" objects in the file to get a count of them
-        // first.
-        uint16_t layer_count = 0;
-        cJSON *tempNode = layer_node;
-        do {
-            tempNode = tempNode->next;
-            layer_count++;
-        } while (tempNode != NULL);
 
         // Throw a warning if we encounter multiple "layer" objects in file
         // versions newer than 1.0.0.  Having multiple objects with the same
@@ -2292,12 +3379,19 @@ static void loader_add_layer_properties(const struct loader_instance *inst, stru
                        " are deprecated starting in file version \"1.0.1\".  "
                        "Please use \'layers\' : [] array instead in %s.",
                        filename);
+        } else if (layer_count == 1) {
+            loader_read_json_layer(inst, layer_instance_list, &layer_node, json_version, is_implicit, filename);
         } else {
-            do {
-                loader_read_json_layer(inst, layer_instance_list, layer_node, json_version, item, disable_environment, is_implicit,
-                                       filename);
-                layer_node = layer_node->next;
-            } while (layer_node != NULL);
+            // The reader never modifies the text, so walk the top level again
+            json_reader_init(&reader, json, json_len);
+            json_reader_begin_object(&reader);
+            while (json_reader_next_member(&reader, &key, &key_len)) {
+                layer_node = reader;
+                json_reader_skip(&reader);
+                if (json_reader_key_equals(key, key_len, "layer")) {
+                    loader_read_json_layer(inst, layer_instance_list, &layer_node, json_version, is_implicit, filename);
+                }
+            }
         }
     }
     return;
@@ -2338,9 +3432,10 @@ static VkResult loader_get_manifest_files(const struct loader_instance *inst, co
     char *file, *next_file, *name;
     size_t alloced_count = 64;
     char full_path[2048];
-    DIR *sysdir = NULL;
+    struct loader_manifest_cache_dir *dir_listing = NULL;
+    uint32_t dir_index = 0;
+    bool cache_locked = false;
     bool list_is_dirs = false;
-    struct dirent *dent;
     VkResult res = VK_SUCCESS;
 
     out_files->count = 0;
@@ -2534,13 +3629,14 @@ static VkResult loader_get_manifest_files(const struct loader_instance *inst, co
     while (*file) {
         next_file = loader_get_next_path(file);
         if (list_is_dirs) {
-            sysdir = opendir(file);
+            // The listing stays valid until loader_manifest_cache_lock is released
+            loader_platform_thread_lock_mutex(&loader_manifest_cache_lock);
+            cache_locked = true;
+            dir_listing = loader_manifest_cache_get_dir(inst, file);
+            dir_index = 0;
             name = NULL;
-            if (sysdir) {
-                dent = readdir(sysdir);
-                if (dent == NULL) break;
-                name = &(dent->d_name[0]);
-                loader_get_fullpath(name, file, sizeof(full_path), full_path);
+            if (dir_listing != NULL && dir_listing->count > 0) {
+                loader_platform_combine_path(full_path, sizeof(full_path), file, dir_listing->names[dir_index++], NULL);
                 name = full_path;
             }
         } else {
@@ -2603,20 +3699,19 @@ static VkResult loader_get_manifest_files(const struct loader_instance *inst, co
                            name);
             }
             if (list_is_dirs) {
-                dent = readdir(sysdir);
-                if (dent == NULL) {
+                if (dir_listing == NULL || dir_index >= dir_listing->count) {
                     break;
                 }
-                name = &(dent->d_name[0]);
-                loader_get_fullpath(name, file, sizeof(full_path), full_path);
+                loader_platform_combine_path(full_path, sizeof(full_path), file, dir_listing->names[dir_index++], NULL);
                 name = full_path;
             } else {
                 break;
             }
         }
-        if (sysdir) {
-            closedir(sysdir);
-            sysdir = NULL;
+        if (cache_locked) {
+            loader_platform_thread_unlock_mutex(&loader_manifest_cache_lock);
+            cache_locked = false;
+            dir_listing = NULL;
         }
         file = next_file;
 #if !defined(_WIN32)
@@ -2701,8 +3796,8 @@ out:
         out_files->filename_list = NULL;
     }
 
-    if (NULL != sysdir) {
-        closedir(sysdir);
+    if (cache_locked) {
+        loader_platform_thread_unlock_mutex(&loader_manifest_cache_lock);
     }
 
     if (override_getenv != NULL) {
@@ -2738,7 +3833,9 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
     struct loader_manifest_files manifest_files;
     VkResult res = VK_SUCCESS;
     bool lockedMutex = false;
-    cJSON *json = NULL;
+    char *json = NULL;
+    size_t json_len = 0;
+    struct loader_json_prefetch *prefetch = NULL;
     uint32_t num_good_icds = 0;
 
     memset(&manifest_files, 0, sizeof(struct loader_manifest_files));
@@ -2756,18 +3853,17 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
     }
     loader_platform_thread_lock_mutex(&loader_json_lock);
     lockedMutex = true;
+    prefetch = loader_prefetch_json(inst, &manifest_files, 1);
     for (uint32_t i = 0; i < manifest_files.count; i++) {
         file_str = manifest_files.filename_list[i];
         if (file_str == NULL) {
             continue;
         }
 
-        VkResult temp_res = loader_get_json(inst, file_str, &json);
+        VkResult temp_res = loader_get_json(inst, file_str, prefetch, i, &json, &json_len);
         if (NULL == json || temp_res != VK_SUCCESS) {
-            if (NULL != json) {
-                cJSON_Delete(json);
-                json = NULL;
-            }
+            free(json);
+            json = NULL;
             // If we haven't already found an ICD, copy this result to
             // the returned result.
             if (num_good_icds == 0) {
@@ -2781,9 +3877,23 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
         }
         res = temp_res;
 
-        cJSON *item, *itemICD;
-        item = cJSON_GetObjectItem(json, "file_format_version");
-        if (item == NULL) {
+        struct json_reader reader, file_format_version, icd_node, library_path_node, api_version_node;
+        bool have_file_format_version = false, have_icd = false, have_library_path = false, have_api_version = false;
+        const char *key;
+        size_t key_len;
+        json_reader_init(&reader, json, json_len);
+        json_reader_begin_object(&reader);
+        while (json_reader_next_member(&reader, &key, &key_len)) {
+            if (!have_file_format_version && json_reader_key_equals(key, key_len, "file_format_version")) {
+                file_format_version = reader;
+                have_file_format_version = true;
+            } else if (!have_icd && json_reader_key_equals(key, key_len, "ICD")) {
+                icd_node = reader;
+                have_icd = true;
+            }
+            json_reader_skip(&reader);
+        }
+        if (!have_file_format_version) {
             if (num_good_icds == 0) {
                 res = VK_ERROR_INITIALIZATION_FAILED;
             }
@@ -2791,26 +3901,25 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
                        "loader_icd_scan: ICD JSON %s does not have a"
                        " \'file_format_version\' field. Skipping ICD JSON.",
                        file_str);
-            cJSON_Delete(json);
+            free(json);
             json = NULL;
             continue;
         }
 
-        char *file_vers = cJSON_Print(item);
-        if (NULL == file_vers) {
-            // Only reason the print can fail is if there was an allocation issue
+        char file_vers[64];
+        if (!json_reader_read_string(&file_format_version, file_vers, sizeof(file_vers))) {
             if (num_good_icds == 0) {
-                res = VK_ERROR_OUT_OF_HOST_MEMORY;
+                res = VK_ERROR_INITIALIZATION_FAILED;
             }
             loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
                        "loader_icd_scan: Failed retrieving ICD JSON %s"
                        " \'file_format_version\' field.  Skipping ICD JSON",
                        file_str);
-            cJSON_Delete(json);
+            free(json);
             json = NULL;
             continue;
         }
-        loader_log(inst, VK_DEBUG_REPORT_INFORMATION_BIT_EXT, 0, "Found ICD manifest file %s, version %s", file_str, file_vers);
+        loader_log(inst, VK_DEBUG_REPORT_INFORMATION_BIT_EXT, 0, "Found ICD manifest file %s, version \"%s\"", file_str, file_vers);
 
         // Get the major/minor/and patch as integers for easier comparison
         vers_tok = strtok(file_vers, ".\"\n\r");
@@ -2831,49 +3940,38 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
                        "loader_icd_scan: Unexpected manifest file version "
                        "(expected 1.0.0 or 1.0.1), may cause errors");
         }
-        cJSON_Free(file_vers);
 
-        itemICD = cJSON_GetObjectItem(json, "ICD");
-        if (itemICD != NULL) {
-            item = cJSON_GetObjectItem(itemICD, "library_path");
-            if (item != NULL) {
-                char *temp = cJSON_Print(item);
-                if (!temp || strlen(temp) == 0) {
+        if (have_icd && json_reader_begin_object(&icd_node)) {
+            while (json_reader_next_member(&icd_node, &key, &key_len)) {
+                if (!have_library_path && json_reader_key_equals(key, key_len, "library_path")) {
+                    library_path_node = icd_node;
+                    have_library_path = true;
+                } else if (!have_api_version && json_reader_key_equals(key, key_len, "api_version")) {
+                    api_version_node = icd_node;
+                    have_api_version = true;
+                }
+                json_reader_skip(&icd_node);
+            }
+            if (have_library_path) {
+                char library_path[MAX_STRING_SIZE];
+                if (!json_reader_read_string(&library_path_node, library_path, sizeof(library_path))) {
                     if (num_good_icds == 0) {
-                        res = VK_ERROR_OUT_OF_HOST_MEMORY;
+                        res = VK_ERROR_INITIALIZATION_FAILED;
                     }
                     loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
                                "loader_icd_scan: Failed retrieving ICD JSON %s"
                                " \'library_path\' field.  Skipping ICD JSON.",
                                file_str);
-                    cJSON_Free(temp);
-                    cJSON_Delete(json);
+                    free(json);
                     json = NULL;
                     continue;
                 }
-                // strip out extra quotes
-                temp[strlen(temp) - 1] = '\0';
-                char *library_path = loader_stack_alloc(strlen(temp) + 1);
-                if (NULL == library_path) {
-                    loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                               "loader_icd_scan: Failed to allocate space for "
-                               "ICD JSON %s \'library_path\' value.  Skipping "
-                               "ICD JSON.",
-                               file_str);
-                    res = VK_ERROR_OUT_OF_HOST_MEMORY;
-                    cJSON_Free(temp);
-                    cJSON_Delete(json);
-                    json = NULL;
-                    goto out;
-                }
-                strcpy(library_path, &temp[1]);
-                cJSON_Free(temp);
                 if (strlen(library_path) == 0) {
                     loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
                                "loader_icd_scan: ICD JSON %s \'library_path\'"
                                " field is empty.  Skipping ICD JSON.",
                                file_str);
-                    cJSON_Delete(json);
+                    free(json);
                     json = NULL;
                     continue;
                 }
@@ -2894,28 +3992,21 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
                 }
 
                 uint32_t vers = 0;
-                item = cJSON_GetObjectItem(itemICD, "api_version");
-                if (item != NULL) {
-                    temp = cJSON_Print(item);
-                    if (NULL == temp) {
+                if (have_api_version) {
+                    char api_version[64];
+                    if (!json_reader_read_string(&api_version_node, api_version, sizeof(api_version))) {
                         loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
                                    "loader_icd_scan: Failed retrieving ICD JSON %s"
                                    " \'api_version\' field.  Skipping ICD JSON.",
                                    file_str);
-
-                        // Only reason the print can fail is if there was an
-                        // allocation issue
                         if (num_good_icds == 0) {
-                            res = VK_ERROR_OUT_OF_HOST_MEMORY;
+                            res = VK_ERROR_INITIALIZATION_FAILED;
                         }
-
-                        cJSON_Free(temp);
-                        cJSON_Delete(json);
+                        free(json);
                         json = NULL;
                         continue;
                     }
-                    vers = loader_make_version(temp);
-                    cJSON_Free(temp);
+                    vers = loader_make_version(api_version);
                 } else {
                     loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
                                "loader_icd_scan: ICD JSON %s does not have an"
@@ -2929,7 +4020,7 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
                                "loader_icd_scan: Failed to add ICD JSON %s. "
                                " Skipping ICD JSON.",
                                fullpath);
-                    cJSON_Delete(json);
+                    free(json);
                     json = NULL;
                     continue;
                 }
@@ -2947,16 +4038,17 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
                        file_str);
         }
 
-        cJSON_Delete(json);
+        free(json);
         json = NULL;
     }
 
+    loader_dev_ext_cache_check_icds(inst, icd_tramp_list);
+
 out:
 
-    if (NULL != json) {
-        cJSON_Delete(json);
-    }
+    free(json);
 
+    loader_free_json_prefetch(inst, prefetch);
     if (NULL != manifest_files.filename_list) {
         for (uint32_t i = 0; i < manifest_files.count; i++) {
             if (NULL != manifest_files.filename_list[i]) {
@@ -2968,6 +4060,7 @@ out:
     if (lockedMutex) {
         loader_platform_thread_unlock_mutex(&loader_json_lock);
     }
+    loader_manifest_cache_flush(inst);
 
     return res;
 }
@@ -2975,9 +4068,11 @@ out:
 void loader_layer_scan(const struct loader_instance *inst, struct loader_layer_list *instance_layers) {
     char *file_str;
     struct loader_manifest_files manifest_files[2];  // [0] = explicit, [1] = implicit
-    cJSON *json;
+    char *json;
+    size_t json_len;
     uint32_t implicit;
     bool lockedMutex = false;
+    struct loader_json_prefetch *prefetch = NULL;
 
     memset(manifest_files, 0, sizeof(struct loader_manifest_files) * 2);
 
@@ -3005,21 +4100,24 @@ void loader_layer_scan(const struct loader_instance *inst, struct loader_layer_l
 
     loader_platform_thread_lock_mutex(&loader_json_lock);
     lockedMutex = true;
+    // The prefetch is indexed across both lists, explicit layers first
+    prefetch = loader_prefetch_json(inst, manifest_files, 2);
     for (implicit = 0; implicit < 2; implicit++) {
+        uint32_t prefetch_base = implicit ? manifest_files[0].count : 0;
         for (uint32_t i = 0; i < manifest_files[implicit].count; i++) {
             file_str = manifest_files[implicit].filename_list[i];
             if (file_str == NULL) continue;
 
             // parse file into JSON struct
-            VkResult res = loader_get_json(inst, file_str, &json);
+            VkResult res = loader_get_json(inst, file_str, prefetch, prefetch_base + i, &json, &json_len);
             if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
                 break;
             } else if (VK_SUCCESS != res || NULL == json) {
                 continue;
             }
 
-            loader_add_layer_properties(inst, instance_layers, json, (implicit == 1), file_str);
-            cJSON_Delete(json);
+            loader_add_layer_properties(inst, instance_layers, json, json_len, (implicit == 1), file_str);
+            free(json);
         }
     }
 
@@ -3029,6 +4127,7 @@ void loader_layer_scan(const struct loader_instance *inst, struct loader_layer_l
 
 out:
 
+    loader_free_json_prefetch(inst, prefetch);
     for (uint32_t manFile = 0; manFile < 2; manFile++) {
         if (NULL != manifest_files[manFile].filename_list) {
             for (uint32_t i = 0; i < manifest_files[manFile].count; i++) {
@@ -3042,12 +4141,15 @@ out:
     if (lockedMutex) {
         loader_platform_thread_unlock_mutex(&loader_json_lock);
     }
+    loader_manifest_cache_flush(inst);
 }
 
 void loader_implicit_layer_scan(const struct loader_instance *inst, struct loader_layer_list *instance_layers) {
     char *file_str;
     struct loader_manifest_files manifest_files;
-    cJSON *json;
+    char *json;
+    size_t json_len;
+    struct loader_json_prefetch *prefetch;
     uint32_t i;
 
     // Pass NULL for environment variable override - implicit layers are not
@@ -3063,6 +4165,7 @@ void loader_implicit_layer_scan(const struct loader_instance *inst, struct loade
 
     loader_platform_thread_lock_mutex(&loader_json_lock);
 
+    prefetch = loader_prefetch_json(inst, &manifest_files, 1);
     for (i = 0; i < manifest_files.count; i++) {
         file_str = manifest_files.filename_list[i];
         if (file_str == NULL) {
@@ -3070,18 +4173,19 @@ void loader_implicit_layer_scan(const struct loader_instance *inst, struct loade
         }
 
         // parse file into JSON struct
-        res = loader_get_json(inst, file_str, &json);
+        res = loader_get_json(inst, file_str, prefetch, i, &json, &json_len);
         if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
             break;
         } else if (VK_SUCCESS != res || NULL == json) {
             continue;
         }
 
-        loader_add_layer_properties(inst, instance_layers, json, true, file_str);
+        loader_add_layer_properties(inst, instance_layers, json, json_len, true, file_str);
 
         loader_instance_heap_free(inst, file_str);
-        cJSON_Delete(json);
+        free(json);
     }
+    loader_free_json_prefetch(inst, prefetch);
     loader_instance_heap_free(inst, manifest_files.filename_list);
 
     // add a meta layer for validation if the validation layers are all present
@@ -3089,6 +4193,7 @@ void loader_implicit_layer_scan(const struct loader_instance *inst, struct loade
                                    instance_layers);
 
     loader_platform_thread_unlock_mutex(&loader_json_lock);
+    loader_manifest_cache_flush(inst);
 }
 
 static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL loader_gpdpa_instance_internal(VkInstance inst, const char *pName) {
@@ -3228,13 +4333,106 @@ static void loader_init_dispatch_dev_ext_entry(struct loader_instance *inst, str
     }
 }
 
-// Find all dev extension in the hash table  and initialize the dispatch table
-// for dev  for each of those extension entrypoints found in hash table.
+// Initialize the dispatch table for dev for each unknown device extension
+// entrypoint that has been given a trampoline slot.
 void loader_init_dispatch_dev_ext(struct loader_instance *inst, struct loader_device *dev) {
-    for (uint32_t i = 0; i < MAX_NUM_UNKNOWN_EXTS; i++) {
-        if (inst->dev_ext_disp_hash[i].func_name != NULL)
-            loader_init_dispatch_dev_ext_entry(inst, dev, i, inst->dev_ext_disp_hash[i].func_name);
+    for (uint32_t i = 0; i < inst->dev_ext_count; i++) {
+        loader_init_dispatch_dev_ext_entry(inst, dev, i, inst->dev_ext_names[i]);
+    }
+}
+
+#define LOADER_EXT_NAME_INDEX_INITIAL_CAPACITY 64
+
+static void loader_free_ext_name_index(struct loader_instance *inst, struct loader_ext_name_index *index) {
+    for (uint32_t i = 0; i < index->capacity; i++) {
+        loader_instance_heap_free(inst, index->entries[i]);
+    }
+    loader_instance_heap_free(inst, index->entries);
+    memset(index, 0, sizeof(*index));
+}
+
+// Find funcName in the name index, adding an entry for it if it isn't there
+// yet.  New entries have no slot and have not been checked against the ICDs or
+// layers.  Returns NULL if memory for the entry couldn't be allocated.
+static struct loader_ext_name_entry *loader_find_ext_name(struct loader_instance *inst, struct loader_ext_name_index *index,
+                                                          const char *funcName) {
+    size_t name_len = strlen(funcName);
+    uint32_t hash = murmurhash(funcName, name_len, 0);
+    struct loader_ext_name_entry *entry;
+    uint32_t i;
+
+    if (index->capacity != 0) {
+        for (i = hash & (index->capacity - 1); index->entries[i] != NULL; i = (i + 1) & (index->capacity - 1)) {
+            entry = index->entries[i];
+            if (entry->hash == hash && !strcmp(entry->func_name, funcName)) {
+                return entry;
+            }
+        }
+    }
+
+    // Keep the index at most three quarters full so probe runs stay short
+    if ((index->count + 1) * 4 > index->capacity * 3) {
+        uint32_t capacity = index->capacity == 0 ? LOADER_EXT_NAME_INDEX_INITIAL_CAPACITY : index->capacity * 2;
+        struct loader_ext_name_entry **entries = loader_instance_heap_alloc(inst, sizeof(struct loader_ext_name_entry *) * capacity,
+                                                                            VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (entries == NULL) {
+            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                       "loader_find_ext_name: Failed to allocate memory for "
+                       "unknown extension name index");
+            return NULL;
+        }
+        memset(entries, 0, sizeof(struct loader_ext_name_entry *) * capacity);
+        for (uint32_t j = 0; j < index->capacity; j++) {
+            if (index->entries[j] != NULL) {
+                i = index->entries[j]->hash & (capacity - 1);
+                while (entries[i] != NULL) {
+                    i = (i + 1) & (capacity - 1);
+                }
+                entries[i] = index->entries[j];
+            }
+        }
+        loader_instance_heap_free(inst, index->entries);
+        index->entries = entries;
+        index->capacity = capacity;
+    }
+
+    entry =
+        loader_instance_heap_alloc(inst, sizeof(struct loader_ext_name_entry) + name_len + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (entry == NULL) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "loader_find_ext_name: Failed to allocate memory "
+                   "for func_name %s",
+                   funcName);
+        return NULL;
+    }
+    memset(entry, 0, sizeof(struct loader_ext_name_entry));
+    entry->func_name = (char *)(entry + 1);
+    memcpy(entry->func_name, funcName, name_len + 1);
+    entry->hash = hash;
+    entry->slot = LOADER_EXT_SLOT_NONE;
+
+    i = hash & (index->capacity - 1);
+    while (index->entries[i] != NULL) {
+        i = (i + 1) & (index->capacity - 1);
+    }
+    index->entries[i] = entry;
+    index->count++;
+    return entry;
+}
+
+// Bind entry to the next free trampoline slot
+static bool loader_assign_ext_slot(struct loader_instance *inst, struct loader_ext_name_entry *entry, uint32_t *count,
+                                   const char **names) {
+    if (*count >= MAX_NUM_UNKNOWN_EXTS) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "loader_assign_ext_slot: All %u unknown extension "
+                   "trampolines are in use, can't dispatch %s",
+                   MAX_NUM_UNKNOWN_EXTS, entry->func_name);
+        return false;
     }
+    entry->slot = (*count)++;
+    names[entry->slot] = entry->func_name;
+    return true;
 }
 
 static bool loader_check_icds_for_dev_ext_address(struct loader_instance *inst, const char *funcName) {
@@ -3270,143 +4468,48 @@ static bool loader_check_layer_list_for_dev_ext_address(const struct loader_laye
 }
 
 static void loader_free_dev_ext_table(struct loader_instance *inst) {
-    for (uint32_t i = 0; i < MAX_NUM_UNKNOWN_EXTS; i++) {
-        loader_instance_heap_free(inst, inst->dev_ext_disp_hash[i].func_name);
-        loader_instance_heap_free(inst, inst->dev_ext_disp_hash[i].list.index);
-    }
-    memset(inst->dev_ext_disp_hash, 0, sizeof(inst->dev_ext_disp_hash));
-}
-
-static bool loader_add_dev_ext_table(struct loader_instance *inst, uint32_t *ptr_idx, const char *funcName) {
-    uint32_t i;
-    uint32_t idx = *ptr_idx;
-    struct loader_dispatch_hash_list *list = &inst->dev_ext_disp_hash[idx].list;
-
-    if (!inst->dev_ext_disp_hash[idx].func_name) {
-        // no entry here at this idx, so use it
-        assert(list->capacity == 0);
-        inst->dev_ext_disp_hash[idx].func_name =
-            (char *)loader_instance_heap_alloc(inst, strlen(funcName) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (inst->dev_ext_disp_hash[idx].func_name == NULL) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "loader_add_dev_ext_table: Failed to allocate memory "
-                       "for func_name %s",
-                       funcName);
-            return false;
-        }
-        strncpy(inst->dev_ext_disp_hash[idx].func_name, funcName, strlen(funcName) + 1);
-        return true;
-    }
-
-    // check for enough capacity
-    if (list->capacity == 0) {
-        list->index = loader_instance_heap_alloc(inst, 8 * sizeof(*(list->index)), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (list->index == NULL) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "loader_add_dev_ext_table: Failed to allocate memory "
-                       "for list index",
-                       funcName);
-            return false;
-        }
-        list->capacity = 8 * sizeof(*(list->index));
-    } else if (list->capacity < (list->count + 1) * sizeof(*(list->index))) {
-        list->index = loader_instance_heap_realloc(inst, list->index, list->capacity, list->capacity * 2,
-                                                   VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (list->index == NULL) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "loader_add_dev_ext_table: Failed to reallocate memory "
-                       "for list index",
-                       funcName);
-            return false;
-        }
-        list->capacity *= 2;
-    }
-
-    // find an unused index in the hash table and use it
-    i = (idx + 1) % MAX_NUM_UNKNOWN_EXTS;
-    do {
-        if (!inst->dev_ext_disp_hash[i].func_name) {
-            assert(inst->dev_ext_disp_hash[i].list.capacity == 0);
-            inst->dev_ext_disp_hash[i].func_name =
-                (char *)loader_instance_heap_alloc(inst, strlen(funcName) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-            if (inst->dev_ext_disp_hash[i].func_name == NULL) {
-                loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                           "loader_add_dev_ext_table: Failed to allocate memory "
-                           "for func_name %s",
-                           funcName);
-                return false;
-            }
-            strncpy(inst->dev_ext_disp_hash[i].func_name, funcName, strlen(funcName) + 1);
-            list->index[list->count] = i;
-            list->count++;
-            *ptr_idx = i;
-            return true;
-        }
-        i = (i + 1) % MAX_NUM_UNKNOWN_EXTS;
-    } while (i != idx);
-
-    loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-               "loader_add_dev_ext_table:  Could not insert into hash table; is "
-               "it full?");
-
-    return false;
-}
-
-static bool loader_name_in_dev_ext_table(struct loader_instance *inst, uint32_t *idx, const char *funcName) {
-    uint32_t alt_idx;
-    if (inst->dev_ext_disp_hash[*idx].func_name && !strcmp(inst->dev_ext_disp_hash[*idx].func_name, funcName)) return true;
-
-    // funcName wasn't at the primary spot in the hash table
-    // search the list of secondary locations (shallow search, not deep search)
-    for (uint32_t i = 0; i < inst->dev_ext_disp_hash[*idx].list.count; i++) {
-        alt_idx = inst->dev_ext_disp_hash[*idx].list.index[i];
-        if (!strcmp(inst->dev_ext_disp_hash[*idx].func_name, funcName)) {
-            *idx = alt_idx;
-            return true;
-        }
-    }
-
-    return false;
+    loader_free_ext_name_index(inst, &inst->dev_ext_index);
+    inst->dev_ext_count = 0;
+    memset(inst->dev_ext_names, 0, sizeof(inst->dev_ext_names));
 }
 
 // This function returns generic trampoline code address for unknown entry
 // points.
 // Presumably, these unknown entry points (as given by funcName) are device
-// extension entrypoints.  A hash table is used to keep a list of unknown entry
-// points and their mapping to the device extension dispatch table
+// extension entrypoints.  The name index maps each unknown entry point to its
+// slot in the device extension dispatch table
 // (struct loader_dev_ext_dispatch_table).
 // \returns
-// For a given entry point string (funcName), if an existing mapping is found
-// the
-// trampoline address for that mapping is returned. Otherwise, this unknown
-// entry point
-// has not been seen yet. Next check if a layer or ICD supports it.  If so then
-// a
-// new entry in the hash table is initialized and that trampoline address for
-// the new entry is returned. Null is returned if the hash table is full or
-// if no discovered layer or ICD returns a non-NULL GetProcAddr for it.
+// For a given entry point string (funcName), if it already has a slot the
+// trampoline address for that slot is returned.  Otherwise, if a layer or ICD
+// supports it, the next slot is assigned to it and that trampoline address is
+// returned.  Null is returned if all slots are in use or if no discovered layer
+// or ICD returns a non-NULL GetProcAddr for it.
 void *loader_dev_ext_gpa(struct loader_instance *inst, const char *funcName) {
-    uint32_t idx;
-    uint32_t seed = 0;
-
-    idx = murmurhash(funcName, strlen(funcName), seed) % MAX_NUM_UNKNOWN_EXTS;
-
-    if (loader_name_in_dev_ext_table(inst, &idx, funcName))
-        // found funcName already in hash
-        return loader_get_dev_ext_trampoline(idx);
+    struct loader_ext_name_entry *entry = loader_find_ext_name(inst, &inst->dev_ext_index, funcName);
+    if (entry == NULL) {
+        return NULL;
+    }
+    if (entry->slot != LOADER_EXT_SLOT_NONE) {
+        // found funcName already in the index
+        return loader_get_dev_ext_trampoline(entry->slot);
+    }
 
-    // Check if funcName is supported in either ICDs or a layer library
-    if (!loader_check_icds_for_dev_ext_address(inst, funcName) &&
-        !loader_check_layer_list_for_dev_ext_address(&inst->instance_layer_list, funcName)) {
-        // if support found in layers continue on
+    // Check if funcName is supported in either ICDs or a layer library.  The
+    // answer can't change once the ICDs have been set up, so it is kept.
+    if (!entry->icds_checked) {
+        entry->icd_supported = loader_check_icds_for_dev_ext_address(inst, funcName);
+        entry->layer_supported = loader_check_layer_list_for_dev_ext_address(&inst->instance_layer_list, funcName);
+        entry->icds_checked = entry->layers_checked = inst->icd_terms != NULL;
+    }
+    if (!entry->icd_supported && !entry->layer_supported) {
         return NULL;
     }
 
-    if (loader_add_dev_ext_table(inst, &idx, funcName)) {
-        // successfully added new table entry
+    if (loader_assign_ext_slot(inst, entry, &inst->dev_ext_count, inst->dev_ext_names)) {
         // init any dev dispatch table entries as needed
-        loader_init_dispatch_dev_ext_entry(inst, NULL, idx, funcName);
-        return loader_get_dev_ext_trampoline(idx);
+        loader_init_dispatch_dev_ext_entry(inst, NULL, entry->slot, funcName);
+        return loader_get_dev_ext_trampoline(entry->slot);
     }
 
     return NULL;
@@ -3417,6 +4520,7 @@ static bool loader_check_icds_for_phys_dev_ext_address(struct loader_instance *i
     icd_term = inst->icd_terms;
     while (NULL != icd_term) {
         if (icd_term->scanned_icd->interface_version >= MIN_PHYS_DEV_EXTENSION_ICD_INTERFACE_VERSION &&
+            NULL != icd_term->scanned_icd->GetPhysicalDeviceProcAddr &&
             icd_term->scanned_icd->GetPhysicalDeviceProcAddr(icd_term->instance, funcName))
             // this icd supports funcName
             return true;
@@ -3444,117 +4548,56 @@ static bool loader_check_layer_list_for_phys_dev_ext_address(struct loader_insta
 }
 
 static void loader_free_phys_dev_ext_table(struct loader_instance *inst) {
-    for (uint32_t i = 0; i < MAX_NUM_UNKNOWN_EXTS; i++) {
-        loader_instance_heap_free(inst, inst->phys_dev_ext_disp_hash[i].func_name);
-        loader_instance_heap_free(inst, inst->phys_dev_ext_disp_hash[i].list.index);
-    }
-    memset(inst->phys_dev_ext_disp_hash, 0, sizeof(inst->phys_dev_ext_disp_hash));
+    loader_free_ext_name_index(inst, &inst->phys_dev_ext_index);
+    inst->phys_dev_ext_count = 0;
+    memset(inst->phys_dev_ext_names, 0, sizeof(inst->phys_dev_ext_names));
 }
 
-static bool loader_add_phys_dev_ext_table(struct loader_instance *inst, uint32_t *ptr_idx, const char *funcName) {
-    uint32_t i;
-    uint32_t idx = *ptr_idx;
-    struct loader_dispatch_hash_list *list = &inst->phys_dev_ext_disp_hash[idx].list;
-
-    if (!inst->phys_dev_ext_disp_hash[idx].func_name) {
-        // no entry here at this idx, so use it
-        assert(list->capacity == 0);
-        inst->phys_dev_ext_disp_hash[idx].func_name =
-            (char *)loader_instance_heap_alloc(inst, strlen(funcName) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (inst->phys_dev_ext_disp_hash[idx].func_name == NULL) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "loader_add_phys_dev_ext_table() can't allocate memory for "
-                       "func_name");
-            return false;
-        }
-        strncpy(inst->phys_dev_ext_disp_hash[idx].func_name, funcName, strlen(funcName) + 1);
-        return true;
-    }
-
-    // check for enough capacity
-    if (list->capacity == 0) {
-        list->index = loader_instance_heap_alloc(inst, 8 * sizeof(*(list->index)), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (list->index == NULL) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_add_phys_dev_ext_table() can't allocate list memory");
-            return false;
-        }
-        list->capacity = 8 * sizeof(*(list->index));
-    } else if (list->capacity < (list->count + 1) * sizeof(*(list->index))) {
-        list->index = loader_instance_heap_realloc(inst, list->index, list->capacity, list->capacity * 2,
-                                                   VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (list->index == NULL) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_add_phys_dev_ext_table() can't reallocate list memory");
-            return false;
-        }
-        list->capacity *= 2;
+// Give entry a trampoline slot and point the ICD terminators at each ICD's
+// implementation of it
+static bool loader_add_phys_dev_ext_slot(struct loader_instance *inst, struct loader_ext_name_entry *entry) {
+    if (!loader_assign_ext_slot(inst, entry, &inst->phys_dev_ext_count, inst->phys_dev_ext_names)) {
+        return false;
     }
 
-    // find an unused index in the hash table and use it
-    i = (idx + 1) % MAX_NUM_UNKNOWN_EXTS;
-    do {
-        if (!inst->phys_dev_ext_disp_hash[i].func_name) {
-            assert(inst->phys_dev_ext_disp_hash[i].list.capacity == 0);
-            inst->phys_dev_ext_disp_hash[i].func_name =
-                (char *)loader_instance_heap_alloc(inst, strlen(funcName) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-            if (inst->phys_dev_ext_disp_hash[i].func_name == NULL) {
-                loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                           "loader_add_dev_ext_table() can't reallocate "
-                           "func_name memory");
-                return false;
-            }
-            strncpy(inst->phys_dev_ext_disp_hash[i].func_name, funcName, strlen(funcName) + 1);
-            list->index[list->count] = i;
-            list->count++;
-            *ptr_idx = i;
-            return true;
+    uint32_t idx = entry->slot;
+    struct loader_icd_term *icd_term = inst->icd_terms;
+    while (NULL != icd_term) {
+        if (MIN_PHYS_DEV_EXTENSION_ICD_INTERFACE_VERSION <= icd_term->scanned_icd->interface_version &&
+            NULL != icd_term->scanned_icd->GetPhysicalDeviceProcAddr) {
+            icd_term->phys_dev_ext[idx] =
+                (PFN_PhysDevExt)icd_term->scanned_icd->GetPhysicalDeviceProcAddr(icd_term->instance, entry->func_name);
+
+            // Make sure we set the instance dispatch to point to the
+            // loader's terminator now since we can at least handle it
+            // in one ICD.
+            inst->disp->phys_dev_ext[idx] = loader_get_phys_dev_ext_termin(idx);
+        } else {
+            icd_term->phys_dev_ext[idx] = NULL;
         }
-        i = (i + 1) % MAX_NUM_UNKNOWN_EXTS;
-    } while (i != idx);
 
-    loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-               "loader_add_phys_dev_ext_table() couldn't insert into hash table; is "
-               "it full?");
-    return false;
-}
-
-static bool loader_name_in_phys_dev_ext_table(struct loader_instance *inst, uint32_t *idx, const char *funcName) {
-    uint32_t alt_idx;
-    if (inst->phys_dev_ext_disp_hash[*idx].func_name && !strcmp(inst->phys_dev_ext_disp_hash[*idx].func_name, funcName))
-        return true;
-
-    // funcName wasn't at the primary spot in the hash table
-    // search the list of secondary locations (shallow search, not deep search)
-    for (uint32_t i = 0; i < inst->phys_dev_ext_disp_hash[*idx].list.count; i++) {
-        alt_idx = inst->phys_dev_ext_disp_hash[*idx].list.index[i];
-        if (!strcmp(inst->phys_dev_ext_disp_hash[*idx].func_name, funcName)) {
-            *idx = alt_idx;
-            return true;
-        }
+        icd_term = icd_term->next;
     }
-
-    return false;
+    return true;
 }
 
 // This function returns a generic trampoline and/or terminator function
-// address for any unknown physical device extension commands.  A hash
-// table is used to keep a list of unknown entry points and their
-// mapping to the physical device extension dispatch table (struct
-// loader_phys_dev_ext_dispatch_table).
-// For a given entry point string (funcName), if an existing mapping is
-// found, then the trampoline address for that mapping is returned in
-// tramp_addr (if it is not NULL) and the terminator address for that
-// mapping is returned in term_addr (if it is not NULL). Otherwise,
-// this unknown entry point has not been seen yet.
-// If it has not been seen before, and perform_checking is 'true',
-// check if a layer or and ICD supports it.  If so then a new entry in
-// the hash table is initialized and the trampoline and/or terminator
-// addresses are returned.
-// Null is returned if the hash table is full or if no discovered layer or
+// address for any unknown physical device extension commands.  The name
+// index maps each unknown entry point to its slot in the physical device
+// extension dispatch table (struct loader_phys_dev_ext_dispatch_table), and
+// remembers which ICDs and layers support it.
+// For a given entry point string (funcName), if an ICD supports it, or
+// perform_checking is 'true' and a layer supports it, the trampoline address
+// for its slot is returned in tramp_addr (if it is not NULL) and the
+// terminator address is returned in term_addr (if it is not NULL).  The slot
+// is assigned and initialized the first time this happens.  When
+// perform_checking is 'true', the instance dispatch entry is also pointed at
+// the first layer that handles funcName.
+// False is returned if all slots are in use or if no discovered layer or
 // ICD returns a non-NULL GetProcAddr for it.
 bool loader_phys_dev_ext_gpa(struct loader_instance *inst, const char *funcName, bool perform_checking, void **tramp_addr,
                              void **term_addr) {
-    uint32_t idx;
-    uint32_t seed = 0;
+    struct loader_ext_name_entry *entry;
     bool success = false;
 
     if (inst == NULL) {
@@ -3568,48 +4611,34 @@ bool loader_phys_dev_ext_gpa(struct loader_instance *inst, const char *funcName,
         *term_addr = NULL;
     }
 
-    // We should always check to see if any ICD supports it.
-    if (!loader_check_icds_for_phys_dev_ext_address(inst, funcName)) {
-        // If we're not checking layers, or we are and it's not in a layer, just
-        // return
-        if (!perform_checking || !loader_check_layer_list_for_phys_dev_ext_address(inst, funcName)) {
-            goto out;
-        }
+    entry = loader_find_ext_name(inst, &inst->phys_dev_ext_index, funcName);
+    if (entry == NULL) {
+        goto out;
     }
 
-    idx = murmurhash(funcName, strlen(funcName), seed) % MAX_NUM_UNKNOWN_EXTS;
-    if (perform_checking && !loader_name_in_phys_dev_ext_table(inst, &idx, funcName)) {
-        uint32_t i;
-        bool added = false;
-
-        // Only need to add first one to get index in Instance.  Others will use
-        // the same index.
-        if (!added && loader_add_phys_dev_ext_table(inst, &idx, funcName)) {
-            added = true;
-        }
-
-        // Setup the ICD function pointers
-        struct loader_icd_term *icd_term = inst->icd_terms;
-        while (NULL != icd_term) {
-            if (MIN_PHYS_DEV_EXTENSION_ICD_INTERFACE_VERSION <= icd_term->scanned_icd->interface_version &&
-                NULL != icd_term->scanned_icd->GetPhysicalDeviceProcAddr) {
-                icd_term->phys_dev_ext[idx] =
-                    (PFN_PhysDevExt)icd_term->scanned_icd->GetPhysicalDeviceProcAddr(icd_term->instance, funcName);
-
-                // Make sure we set the instance dispatch to point to the
-                // loader's terminator now since we can at least handle it
-                // in one ICD.
-                inst->disp->phys_dev_ext[idx] = loader_get_phys_dev_ext_termin(idx);
-            } else {
-                icd_term->phys_dev_ext[idx] = NULL;
-            }
+    // Remember what the ICDs and layers said once the ICDs have been set up.
+    // Layers are only asked when perform_checking is set; they call back in
+    // here without it.
+    if (!entry->icds_checked) {
+        entry->icd_supported = loader_check_icds_for_phys_dev_ext_address(inst, funcName);
+        entry->icds_checked = inst->icd_terms != NULL;
+    }
+    if (perform_checking && !entry->layers_checked) {
+        entry->layer_supported = loader_check_layer_list_for_phys_dev_ext_address(inst, funcName);
+    }
+    if (!entry->icd_supported && (!perform_checking || !entry->layer_supported)) {
+        goto out;
+    }
 
-            icd_term = icd_term->next;
-        }
+    if (entry->slot == LOADER_EXT_SLOT_NONE && !loader_add_phys_dev_ext_slot(inst, entry)) {
+        goto out;
+    }
 
+    if (perform_checking && !entry->layers_checked) {
         // Now, search for the first layer attached and query using it to get
         // the first entry point.
-        for (i = 0; i < inst->activated_layer_list.count; i++) {
+        uint32_t idx = entry->slot;
+        for (uint32_t i = 0; i < inst->activated_layer_list.count; i++) {
             struct loader_layer_properties *layer_prop = &inst->activated_layer_list.list[i];
             if (layer_prop->interface_version > 1 && NULL != layer_prop->functions.get_physical_device_proc_addr) {
                 inst->disp->phys_dev_ext[idx] =
@@ -3619,14 +4648,15 @@ bool loader_phys_dev_ext_gpa(struct loader_instance *inst, const char *funcName,
                 }
             }
         }
+        entry->layers_checked = inst->icd_terms != NULL;
     }
 
     if (NULL != tramp_addr) {
-        *tramp_addr = loader_get_phys_dev_ext_tramp(idx);
+        *tramp_addr = loader_get_phys_dev_ext_tramp(entry->slot);
     }
 
     if (NULL != term_addr) {
-        *term_addr = loader_get_phys_dev_ext_termin(idx);
+        *term_addr = loader_get_phys_dev_ext_termin(entry->slot);
     }
 
     success = true;
@@ -3988,6 +5018,76 @@ void loader_activate_instance_layer_extensions(struct loader_instance *inst, VkI
                                                   created_inst);
 }
 
+// Skip links let device commands bypass layers that don't intercept them.  When
+// a layer in the device chain lists its intercepted functions in its manifest,
+// the loader gives each layer, and its own dispatch table, a
+// vkGetDeviceProcAddr for the chain position below it instead of the next
+// layer's.  That lookup goes straight to the first layer further down the
+// chain that intercepts the command, or to the ICD.  Layers that don't list
+// their functions are never skipped.
+#define LOADER_MAX_SKIP_LINK_LAYERS 16
+
+static bool loader_layer_intercepts(const struct loader_layer_properties *props, const char *name) {
+    return NULL == props->intercepted_functions ||
+           NULL != bsearch(name, props->intercepted_functions, props->intercepted_function_count, sizeof(char *),
+                           loader_compare_entry_name);
+}
+
+static PFN_vkVoidFunction loader_skip_link_gdpa(VkDevice device, const char *pName, uint32_t position);
+
+#define LOADER_SKIP_LINK_GDPA(position)                                                                          \
+    static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL loader_skip_link_gdpa_##position(VkDevice device, const char *pName) { \
+        return loader_skip_link_gdpa(device, pName, position);                                                   \
+    }
+
+LOADER_SKIP_LINK_GDPA(0)
+LOADER_SKIP_LINK_GDPA(1)
+LOADER_SKIP_LINK_GDPA(2)
+LOADER_SKIP_LINK_GDPA(3)
+LOADER_SKIP_LINK_GDPA(4)
+LOADER_SKIP_LINK_GDPA(5)
+LOADER_SKIP_LINK_GDPA(6)
+LOADER_SKIP_LINK_GDPA(7)
+LOADER_SKIP_LINK_GDPA(8)
+LOADER_SKIP_LINK_GDPA(9)
+LOADER_SKIP_LINK_GDPA(10)
+LOADER_SKIP_LINK_GDPA(11)
+LOADER_SKIP_LINK_GDPA(12)
+LOADER_SKIP_LINK_GDPA(13)
+LOADER_SKIP_LINK_GDPA(14)
+LOADER_SKIP_LINK_GDPA(15)
+LOADER_SKIP_LINK_GDPA(16)
+
+// Indexed by chain position; the last entry is below the bottom layer
+static const PFN_vkGetDeviceProcAddr loader_skip_link_gdpas[LOADER_MAX_SKIP_LINK_LAYERS + 1] = {
+    loader_skip_link_gdpa_0,  loader_skip_link_gdpa_1,  loader_skip_link_gdpa_2,  loader_skip_link_gdpa_3,
+    loader_skip_link_gdpa_4,  loader_skip_link_gdpa_5,  loader_skip_link_gdpa_6,  loader_skip_link_gdpa_7,
+    loader_skip_link_gdpa_8,  loader_skip_link_gdpa_9,  loader_skip_link_gdpa_10, loader_skip_link_gdpa_11,
+    loader_skip_link_gdpa_12, loader_skip_link_gdpa_13, loader_skip_link_gdpa_14, loader_skip_link_gdpa_15,
+    loader_skip_link_gdpa_16,
+};
+
+static PFN_vkVoidFunction loader_skip_link_gdpa(VkDevice device, const char *pName, uint32_t position) {
+    struct loader_device *dev;
+
+    // Keep handing out this position's lookup, the same way
+    // loader_gpa_device_internal returns itself
+    if (!strcmp(pName, "vkGetDeviceProcAddr")) {
+        return (PFN_vkVoidFunction)loader_skip_link_gdpas[position];
+    }
+
+    if (NULL == loader_get_icd_and_device(device, &dev, NULL)) {
+        return NULL;
+    }
+    for (uint32_t i = position; i < dev->chain_layer_count; i++) {
+        const struct loader_device_chain_layer *layer = &dev->chain_layers[i];
+        if (loader_layer_intercepts(layer->props, pName)) {
+            return layer->get_device_proc_addr(device, pName);
+        }
+    }
+    return loader_gpa_device_internal(device, pName);
+}
+
 VkResult loader_create_device_chain(const struct loader_physical_device_tramp *pd, const VkDeviceCreateInfo *pCreateInfo,
                                     const VkAllocationCallbacks *pAllocator, const struct loader_instance *inst,
                                     struct loader_device *dev) {
@@ -4046,7 +5146,10 @@ VkResult loader_create_device_chain(const struct loader_physical_device_tramp *p
     }
 
     layer_device_link_info = loader_stack_alloc(sizeof(VkLayerDeviceLink) * dev->activated_layer_list.count);
-    if (!layer_device_link_info) {
+    struct loader_device_chain_layer *chain_layers =
+        loader_stack_alloc(sizeof(struct loader_device_chain_layer) * dev->activated_layer_list.count);
+    bool use_skip_links = false;
+    if (!layer_device_link_info || !chain_layers) {
         loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
                    "loader_create_device_chain: Failed to alloc Device objects"
                    " for layer.  Skipping Layer.");
@@ -4145,6 +5248,12 @@ VkResult loader_create_device_chain(const struct loader_physical_device_tramp *p
             nextGIPA = fpGIPA;
             nextGDPA = fpGDPA;
 
+            chain_layers[activated_layers].props = layer_prop;
+            chain_layers[activated_layers].get_device_proc_addr = fpGDPA;
+            if (NULL != layer_prop->intercepted_functions) {
+                use_skip_links = true;
+            }
+
             loader_log(inst, VK_DEBUG_REPORT_INFORMATION_BIT_EXT, 0, "Insert device layer %s (%s)", layer_prop->info.layerName,
                        layer_prop->lib_name);
 
@@ -4152,6 +5261,35 @@ VkResult loader_create_device_chain(const struct loader_physical_device_tramp *p
         }
     }
 
+    if (use_skip_links && activated_layers > LOADER_MAX_SKIP_LINK_LAYERS) {
+        loader_log(inst, VK_DEBUG_REPORT_DEBUG_BIT_EXT, 0,
+                   "loader_create_device_chain: %d device layers is more than the %d "
+                   "supported with skip links, calling through every layer",
+                   activated_layers, LOADER_MAX_SKIP_LINK_LAYERS);
+        use_skip_links = false;
+    }
+    if (use_skip_links) {
+        // chain_layers and the links were filled in from the bottom of the
+        // chain up; store the layers first layer first, and point each link
+        // at the skip link lookup for the position below its layer.
+        dev->chain_layers = loader_device_heap_alloc(dev, sizeof(struct loader_device_chain_layer) * activated_layers,
+                                                     VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+        if (NULL == dev->chain_layers) {
+            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                       "loader_create_device_chain: Failed to allocate device "
+                       "chain layer list of size %d",
+                       activated_layers);
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        for (uint32_t i = 0; i < activated_layers; i++) {
+            uint32_t position = activated_layers - 1 - i;
+            dev->chain_layers[position] = chain_layers[i];
+            layer_device_link_info[i].pfnNextGetDeviceProcAddr = loader_skip_link_gdpas[position + 1];
+        }
+        dev->chain_layer_count = activated_layers;
+        nextGDPA = loader_skip_link_gdpas[0];
+    }
+
     VkDevice created_device = (VkDevice)dev;
     PFN_vkCreateDevice fpCreateDevice = (PFN_vkCreateDevice)nextGIPA(inst->instance, "vkCreateDevice");
     if (fpCreateDevice) {
@@ -4356,6 +5494,9 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateInstance(const VkInstanceCreateI
     icd_create_info.ppEnabledExtensionNames = (const char *const *)filtered_extension_names;
 
     for (uint32_t i = 0; i < ptr_instance->icd_tramp_list.count; i++) {
+        if (!loader_scanned_icd_load(ptr_instance, &ptr_instance->icd_tramp_list.scanned_list[i])) {
+            continue;
+        }
         icd_term = loader_icd_add(ptr_instance, &ptr_instance->icd_tramp_list.scanned_list[i]);
         if (NULL == icd_term) {
             loader_log(ptr_instance, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
@@ -4427,8 +5568,8 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateInstance(const VkInstanceCreateI
             continue;
         }
 
-        if (!loader_icd_init_entries(icd_term, icd_term->instance,
-                                     ptr_instance->icd_tramp_list.scanned_list[i].GetInstanceProcAddr)) {
+        if (!loader_icd_init_entries(icd_term, icd_term->instance, ptr_instance->icd_tramp_list.scanned_list[i].GetInstanceProcAddr,
+                                     &icd_create_info)) {
             loader_log(ptr_instance, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
                        "terminator_CreateInstance: Failed to CreateInstance and find "
                        "entrypoints with ICD.  Skipping ICD.");
@@ -4501,7 +5642,7 @@ VKAPI_ATTR void VKAPI_CALL terminator_DestroyInstance(VkInstance instance, const
     loader_destroy_generic_list(ptr_instance, (struct loader_generic_list *)&ptr_instance->ext_list);
     if (NULL != ptr_instance->phys_devs_term) {
         for (uint32_t i = 0; i < ptr_instance->phys_dev_count_term; i++) {
-            loader_instance_heap_free(ptr_instance, ptr_instance->phys_devs_term[i]);
+            loader_free_phys_dev_term(ptr_instance, ptr_instance->phys_devs_term[i]);
         }
         loader_instance_heap_free(ptr_instance, ptr_instance->phys_devs_term);
     }
@@ -4569,8 +5710,13 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDevice(VkPhysicalDevice physical
         goto out;
     }
 
-    res = loader_add_device_extensions(icd_term->this_instance, icd_term->dispatch.EnumerateDeviceExtensionProperties,
-                                       phys_dev_term->phys_dev, icd_term->scanned_icd->lib_name, &icd_exts);
+    uint32_t icd_ext_count;
+    const VkExtensionProperties *icd_ext_props;
+    res = loader_get_icd_device_extensions(icd_term->this_instance, phys_dev_term, &icd_ext_count, &icd_ext_props);
+    if (res != VK_SUCCESS) {
+        goto out;
+    }
+    res = loader_add_to_ext_list(icd_term->this_instance, &icd_exts, icd_ext_count, icd_ext_props);
     if (res != VK_SUCCESS) {
         goto out;
     }
@@ -4870,6 +6016,7 @@ VkResult setupLoaderTermPhysDevs(struct loader_instance *inst) {
                 for (uint32_t old_idx = 0; old_idx < inst->phys_dev_count_term; old_idx++) {
                     if (icd_phys_dev_array[icd_idx].phys_devs[pd_idx] == inst->phys_devs_term[old_idx]->phys_dev) {
                         new_phys_devs[idx] = inst->phys_devs_term[old_idx];
+                        new_phys_devs[idx]->icd_phys_dev_index = pd_idx;
                         break;
                     }
                 }
@@ -4893,6 +6040,10 @@ VkResult setupLoaderTermPhysDevs(struct loader_instance *inst) {
                 new_phys_devs[idx]->this_icd_term = icd_phys_dev_array[icd_idx].this_icd_term;
                 new_phys_devs[idx]->icd_index = (uint8_t)(icd_idx);
                 new_phys_devs[idx]->phys_dev = icd_phys_dev_array[icd_idx].phys_devs[pd_idx];
+                new_phys_devs[idx]->icd_phys_dev_index = pd_idx;
+                new_phys_devs[idx]->icd_exts_known = false;
+                new_phys_devs[idx]->icd_ext_count = 0;
+                new_phys_devs[idx]->icd_ext_props = NULL;
             }
             idx++;
         }
@@ -4904,7 +6055,7 @@ out:
         if (NULL != new_phys_devs) {
             // We've encountered an error, so we should free the new buffers.
             for (uint32_t i = 0; i < inst->total_gpu_count; i++) {
-                loader_instance_heap_free(inst, new_phys_devs[i]);
+                loader_free_phys_dev_term(inst, new_phys_devs[i]);
             }
             loader_instance_heap_free(inst, new_phys_devs);
         }
@@ -4923,7 +6074,7 @@ out:
                     }
                 }
                 if (!found) {
-                    loader_instance_heap_free(inst, inst->phys_devs_term[cur_pd]);
+                    loader_free_phys_dev_term(inst, inst->phys_devs_term[cur_pd]);
                 }
             }
             loader_instance_heap_free(inst, inst->phys_devs_term);
@@ -5060,14 +6211,23 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_EnumerateDeviceExtensionProperties(VkP
 
     // This case is during the call down the instance chain with pLayerName == NULL
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    uint32_t icd_ext_count = *pPropertyCount;
+    uint32_t icd_ext_count;
+    const VkExtensionProperties *icd_ext_props;
     VkResult res;
 
     // Get the available device extensions
-    res = icd_term->dispatch.EnumerateDeviceExtensionProperties(phys_dev_term->phys_dev, NULL, &icd_ext_count, pProperties);
+    res = loader_get_icd_device_extensions(icd_term->this_instance, phys_dev_term, &icd_ext_count, &icd_ext_props);
     if (res != VK_SUCCESS) {
         goto out;
     }
+    if (pProperties != NULL) {
+        if (*pPropertyCount < icd_ext_count) {
+            memcpy(pProperties, icd_ext_props, *pPropertyCount * sizeof(VkExtensionProperties));
+            res = VK_INCOMPLETE;
+            goto out;
+        }
+        memcpy(pProperties, icd_ext_props, icd_ext_count * sizeof(VkExtensionProperties));
+    }
 
     if (!loader_init_layer_list(icd_term->this_instance, &implicit_layer_list)) {
         res = VK_ERROR_OUT_OF_HOST_MEMORY;
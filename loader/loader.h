@@ -142,6 +142,13 @@ struct loader_layer_properties {
     struct loader_device_extension_list device_extension_list;
     struct loader_name_value disable_env_var;
     struct loader_name_value enable_env_var;
+
+    // Device commands the layer intercepts, from the manifest's
+    // "intercepted_functions", sorted by name in a single allocation.  NULL if
+    // the manifest doesn't list them, in which case every device command is
+    // looked up through the layer.
+    uint32_t intercepted_function_count;
+    char **intercepted_functions;
 };
 
 struct loader_layer_list {
@@ -150,19 +157,29 @@ struct loader_layer_list {
     struct loader_layer_properties *list;
 };
 
-struct loader_dispatch_hash_list {
-    size_t capacity;
-    uint32_t count;
-    uint32_t *index;  // index into the dev_ext dispatch table
+#define LOADER_EXT_SLOT_NONE UINT32_MAX
+
+// Unknown device and physical device extension commands are dispatched through
+// the fixed set of trampolines in dev_ext_trampoline.c and phys_dev_ext.c.
+// Slots are handed out in order as new commands are looked up.  The name index
+// remembers every command name looked up, its slot, and whether any ICD or
+// layer supports it, so repeat lookups don't query each ICD again.
+struct loader_ext_name_entry {
+    char *func_name;  // Stored right after the entry
+    uint32_t hash;
+    uint32_t slot;  // LOADER_EXT_SLOT_NONE until the command is supported somewhere
+    bool icd_supported;
+    bool icds_checked;
+    bool layer_supported;
+    bool layers_checked;
 };
 
-// loader_dispatch_hash_entry and loader_dev_ext_dispatch_table.dev_ext have
-// one to one correspondence; one loader_dispatch_hash_entry for one dev_ext
-// dispatch entry.
-// Also have a one to one correspondence with functions in dev_ext_trampoline.c
-struct loader_dispatch_hash_entry {
-    char *func_name;
-    struct loader_dispatch_hash_list list;  // to handle hashing collisions
+// Entries are allocated one by one so they stay put while the index grows;
+// looking up a command calls into ICDs and layers, which may look up others.
+struct loader_ext_name_index {
+    uint32_t capacity;  // Always a power of two
+    uint32_t count;
+    struct loader_ext_name_entry **entries;
 };
 
 typedef void(VKAPI_PTR *PFN_vkDevExt)(VkDevice device);
@@ -176,6 +193,11 @@ struct loader_dev_dispatch_table {
 };
 
 // per CreateDevice structure
+struct loader_device_chain_layer {
+    const struct loader_layer_properties *props;
+    PFN_vkGetDeviceProcAddr get_device_proc_addr;
+};
+
 struct loader_device {
     struct loader_dev_dispatch_table loader_dispatch;
     VkDevice chain_device;  // device object from the dispatch chain
@@ -184,6 +206,11 @@ struct loader_device {
 
     struct loader_layer_list activated_layer_list;
 
+    // Layers in the device chain, first layer first, when the chain uses skip
+    // links.  See loader_create_device_chain.
+    uint32_t chain_layer_count;
+    struct loader_device_chain_layer *chain_layers;
+
     VkAllocationCallbacks alloc_callbacks;
 
     struct loader_device *next;
@@ -246,8 +273,13 @@ struct loader_instance {
     struct loader_icd_term *icd_terms;
     struct loader_icd_tramp_list icd_tramp_list;
 
-    struct loader_dispatch_hash_entry dev_ext_disp_hash[MAX_NUM_UNKNOWN_EXTS];
-    struct loader_dispatch_hash_entry phys_dev_ext_disp_hash[MAX_NUM_UNKNOWN_EXTS];
+    // Unknown extension commands, and the command bound to each trampoline slot
+    struct loader_ext_name_index dev_ext_index;
+    uint32_t dev_ext_count;
+    const char *dev_ext_names[MAX_NUM_UNKNOWN_EXTS];
+    struct loader_ext_name_index phys_dev_ext_index;
+    uint32_t phys_dev_ext_count;
+    const char *phys_dev_ext_names[MAX_NUM_UNKNOWN_EXTS];
 
     struct loader_msg_callback_map_entry *icd_msg_callback_map;
 
@@ -314,14 +346,22 @@ struct loader_physical_device_term {
     struct loader_icd_term *this_icd_term;
     uint8_t icd_index;
     VkPhysicalDevice phys_dev;  // object from ICD
+    uint32_t icd_phys_dev_index;  // position in the ICD's vkEnumeratePhysicalDevices list
+
+    // Device extensions reported by the ICD, see loader_get_icd_device_extensions
+    bool icd_exts_known;
+    uint32_t icd_ext_count;
+    VkExtensionProperties *icd_ext_props;
 };
 
 struct loader_struct {
     struct loader_instance *instances;
 };
 
+// ICD libraries are only opened when first needed, see loader_scanned_icd_load
 struct loader_scanned_icd {
     char *lib_name;
+    bool load_attempted;
     loader_platform_dl_handle handle;
     uint32_t api_version;
     uint32_t interface_version;
@@ -333,6 +373,17 @@ struct loader_scanned_icd {
 
 static inline struct loader_instance *loader_instance(VkInstance instance) { return (struct loader_instance *)instance; }
 
+// Name to dispatch table offset, used by the generated dispatch table lookups
+struct loader_dispatch_name_offset {
+    const char *name;
+    size_t offset;
+};
+
+// bsearch() comparison of a name against a table entry whose first member is its name
+static inline int loader_compare_entry_name(const void *name, const void *entry) {
+    return strcmp((const char *)name, *(const char *const *)entry);
+}
+
 static inline VkPhysicalDevice loader_unwrap_physical_device(VkPhysicalDevice physicalDevice) {
     struct loader_physical_device_tramp *phys_dev = (struct loader_physical_device_tramp *)physicalDevice;
     return phys_dev->phys_dev;
@@ -415,6 +466,9 @@ VkResult loader_add_device_extensions(const struct loader_instance *inst,
                                       PFN_vkEnumerateDeviceExtensionProperties fpEnumerateDeviceExtensionProperties,
                                       VkPhysicalDevice physical_device, const char *lib_name,
                                       struct loader_extension_list *ext_list);
+VkResult loader_get_icd_device_extensions(const struct loader_instance *inst, struct loader_physical_device_term *phys_dev_term,
+                                          uint32_t *count, const VkExtensionProperties **props);
+void loader_free_phys_dev_term(const struct loader_instance *inst, struct loader_physical_device_term *phys_dev_term);
 VkResult loader_init_generic_list(const struct loader_instance *inst, struct loader_generic_list *list_info, size_t element_size);
 void loader_destroy_generic_list(const struct loader_instance *inst, struct loader_generic_list *list);
 void loader_destroy_layer_list(const struct loader_instance *inst, struct loader_device *device,
@@ -432,6 +486,7 @@ VkResult loader_add_to_layer_list(const struct loader_instance *inst, struct loa
 void loader_find_layer_name_add_list(const struct loader_instance *inst, const char *name, const enum layer_type type,
                                      const struct loader_layer_list *search_list, struct loader_layer_list *found_list);
 void loader_scanned_icd_clear(const struct loader_instance *inst, struct loader_icd_tramp_list *icd_tramp_list);
+bool loader_scanned_icd_load(const struct loader_instance *inst, struct loader_scanned_icd *scanned_icd);
 VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_tramp_list *icd_tramp_list);
 void loader_layer_scan(const struct loader_instance *inst, struct loader_layer_list *instance_layers);
 void loader_implicit_layer_scan(const struct loader_instance *inst, struct loader_layer_list *instance_layers);
@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include "vk_loader_platform.h"
+#include "vulkan/vulkan.h"
+#include "log_trace.h"
+
+// Number of distinct format strings that get an id.  The loader has a few
+// hundred; any beyond this are written inline with each message.
+#define LOADER_TRACE_MAX_FORMATS 1024
+
+// Longest string argument recorded, since lengths are stored as uint16
+#define LOADER_TRACE_MAX_STRING 0xFFFE
+#define LOADER_TRACE_NULL_STRING 0xFFFF
+
+bool g_loader_trace_enabled = false;
+
+static FILE *trace_file;
+static loader_platform_thread_mutex trace_lock;
+
+// Format string ids, keyed by the format string's address.  This relies on
+// every loader_log format being a string literal, so that one address always
+// holds the same format; text built at runtime, such as a dlerror() message,
+// must be passed through "%s" instead.
+static const char *trace_formats[LOADER_TRACE_MAX_FORMATS];
+static uint32_t trace_format_count;
+
+static void trace_put(const void *data, size_t size) { fwrite(data, 1, size, trace_file); }
+
+static void trace_put_u8(uint8_t value) { fputc(value, trace_file); }
+
+static void trace_put_u16(uint16_t value) {
+    uint8_t bytes[2] = {(uint8_t)value, (uint8_t)(value >> 8)};
+    trace_put(bytes, sizeof(bytes));
+}
+
+static void trace_put_u32(uint32_t value) {
+    uint8_t bytes[4];
+    for (uint32_t i = 0; i < 4; i++) {
+        bytes[i] = (uint8_t)(value >> (8 * i));
+    }
+    trace_put(bytes, sizeof(bytes));
+}
+
+static void trace_put_u64(uint64_t value) {
+    uint8_t bytes[8];
+    for (uint32_t i = 0; i < 8; i++) {
+        bytes[i] = (uint8_t)(value >> (8 * i));
+    }
+    trace_put(bytes, sizeof(bytes));
+}
+
+static void trace_put_double(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    trace_put_u64(bits);
+}
+
+// Write a string as a uint16 length and its bytes, reading at most max_len
+// bytes of it
+static void trace_put_string(const char *str, size_t max_len) {
+    size_t len = 0;
+
+    if (str == NULL) {
+        trace_put_u16(LOADER_TRACE_NULL_STRING);
+        return;
+    }
+    if (max_len > LOADER_TRACE_MAX_STRING) {
+        max_len = LOADER_TRACE_MAX_STRING;
+    }
+    while (len < max_len && str[len] != '\0') {
+        len++;
+    }
+    trace_put_u16((uint16_t)len);
+    trace_put(str, len);
+}
+
+// Find the id of a format string, assigning one and writing a format record
+// the first time it is seen.  Returns false if there is no room for another.
+static bool trace_format_id(const char *format, uint32_t *id) {
+    uint32_t mask = LOADER_TRACE_MAX_FORMATS - 1;
+    uint32_t slot = (uint32_t)(((uintptr_t)format >> 3) * 2654435761u) & mask;
+
+    for (uint32_t probe = 0; probe < LOADER_TRACE_MAX_FORMATS; probe++, slot = (slot + 1) & mask) {
+        if (trace_formats[slot] == format) {
+            *id = slot;
+            return true;
+        }
+        if (trace_formats[slot] == NULL) {
+            // Keep a quarter of the table empty so probes stay short
+            if (trace_format_count >= LOADER_TRACE_MAX_FORMATS / 4 * 3) {
+                return false;
+            }
+            trace_formats[slot] = format;
+            trace_format_count++;
+            *id = slot;
+            trace_put_u8(LOADER_TRACE_FORMAT);
+            trace_put_u32(slot);
+            trace_put_string(format, LOADER_TRACE_MAX_STRING);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Write the arguments of a message, one value per conversion in format.  The
+// arguments have to be fetched with the types printf would use, so this
+// follows the same parsing rules.
+static void trace_put_args(const char *format, va_list ap) {
+    const char *p = format;
+
+    while (*p != '\0') {
+        size_t precision = (size_t)-1;
+        enum { LEN_INT, LEN_CHAR, LEN_SHORT, LEN_LONG, LEN_LONG_LONG, LEN_SIZE, LEN_INTMAX, LEN_PTRDIFF, LEN_LONG_DOUBLE } length;
+
+        if (*p++ != '%') {
+            continue;
+        }
+        if (*p == '%') {
+            p++;
+            continue;
+        }
+
+        while (*p != '\0' && strchr("-+ #0'", *p) != NULL) {
+            p++;
+        }
+        if (*p == '*') {
+            trace_put_u64((uint64_t)(int64_t)va_arg(ap, int));
+            p++;
+        } else {
+            while (*p >= '0' && *p <= '9') {
+                p++;
+            }
+        }
+        if (*p == '.') {
+            p++;
+            if (*p == '*') {
+                int value = va_arg(ap, int);
+                trace_put_u64((uint64_t)(int64_t)value);
+                if (value >= 0) {
+                    precision = (size_t)value;
+                }
+                p++;
+            } else {
+                precision = 0;
+                while (*p >= '0' && *p <= '9') {
+                    precision = precision * 10 + (size_t)(*p - '0');
+                    p++;
+                }
+            }
+        }
+
+        length = LEN_INT;
+        switch (*p) {
+            case 'h':
+                length = (p[1] == 'h') ? LEN_CHAR : LEN_SHORT;
+                p += (p[1] == 'h') ? 2 : 1;
+                break;
+            case 'l':
+                length = (p[1] == 'l') ? LEN_LONG_LONG : LEN_LONG;
+                p += (p[1] == 'l') ? 2 : 1;
+                break;
+            case 'z':
+                length = LEN_SIZE;
+                p++;
+                break;
+            case 'j':
+                length = LEN_INTMAX;
+                p++;
+                break;
+            case 't':
+                length = LEN_PTRDIFF;
+                p++;
+                break;
+            case 'L':
+                length = LEN_LONG_DOUBLE;
+                p++;
+                break;
+            default:
+                break;
+        }
+
+        switch (*p) {
+            case 'd':
+            case 'i': {
+                int64_t value;
+                switch (length) {
+                    case LEN_LONG:
+                        value = va_arg(ap, long);
+                        break;
+                    case LEN_LONG_LONG:
+                        value = va_arg(ap, long long);
+                        break;
+                    case LEN_SIZE:
+                    case LEN_PTRDIFF:
+                        value = va_arg(ap, ptrdiff_t);
+                        break;
+                    case LEN_INTMAX:
+                        value = va_arg(ap, intmax_t);
+                        break;
+                    default:
+                        value = va_arg(ap, int);
+                        if (length == LEN_CHAR) value = (signed char)value;
+                        if (length == LEN_SHORT) value = (short)value;
+                        break;
+                }
+                trace_put_u64((uint64_t)value);
+                break;
+            }
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o':
+            case 'c': {
+                uint64_t value;
+                switch (length) {
+                    case LEN_LONG:
+                        value = va_arg(ap, unsigned long);
+                        break;
+                    case LEN_LONG_LONG:
+                        value = va_arg(ap, unsigned long long);
+                        break;
+                    case LEN_SIZE:
+                    case LEN_PTRDIFF:
+                        value = va_arg(ap, size_t);
+                        break;
+                    case LEN_INTMAX:
+                        value = va_arg(ap, uintmax_t);
+                        break;
+                    default:
+                        value = va_arg(ap, unsigned int);
+                        if (length == LEN_CHAR) value = (unsigned char)value;
+                        if (length == LEN_SHORT) value = (unsigned short)value;
+                        break;
+                }
+                trace_put_u64(value);
+                break;
+            }
+            case 'p':
+                trace_put_u64((uint64_t)(uintptr_t)va_arg(ap, void *));
+                break;
+            case 's':
+                trace_put_string(va_arg(ap, const char *), precision);
+                break;
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+                if (length == LEN_LONG_DOUBLE) {
+                    trace_put_double((double)va_arg(ap, long double));
+                } else {
+                    trace_put_double(va_arg(ap, double));
+                }
+                break;
+            case 'n':
+                // Nothing to record, and never written through
+                (void)va_arg(ap, void *);
+                break;
+            case '\0':
+                return;
+            default:
+                break;
+        }
+        p++;
+    }
+}
+
+void loader_trace_init(const char *path) {
+    trace_file = fopen(path, "wb");
+    if (trace_file == NULL) {
+        fprintf(stderr, "VK_LOADER_TRACE: unable to open %s for writing\n", path);
+        return;
+    }
+
+    loader_platform_thread_create_mutex(&trace_lock);
+    trace_put(LOADER_TRACE_MAGIC, 4);
+    trace_put_u32(LOADER_TRACE_VERSION);
+    fflush(trace_file);
+    g_loader_trace_enabled = true;
+}
+
+void loader_trace_message(uint32_t msg_type, int32_t msg_code, const char *format, va_list ap) {
+    uint32_t id;
+
+    loader_platform_thread_lock_mutex(&trace_lock);
+
+    if (trace_format_id(format, &id)) {
+        trace_put_u8(LOADER_TRACE_MESSAGE);
+        trace_put_u32(id);
+    } else {
+        trace_put_u8(LOADER_TRACE_INLINE_MESSAGE);
+        trace_put_string(format, LOADER_TRACE_MAX_STRING);
+    }
+    trace_put_u32(msg_type);
+    trace_put_u32((uint32_t)msg_code);
+    trace_put_args(format, ap);
+
+    // Make sure errors reach the file even if the application goes on to crash
+    if (msg_type & VK_DEBUG_REPORT_ERROR_BIT_EXT) {
+        fflush(trace_file);
+    }
+
+    loader_platform_thread_unlock_mutex(&trace_lock);
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Binary trace of loader messages, enabled by setting VK_LOADER_TRACE to the
+// path of the file to write.  Every loader_log() message is recorded,
+// whatever VK_LOADER_DEBUG selects, without being formatted: each record
+// holds the message's format string id and its raw arguments.
+// scripts/loader_trace_decode.py turns a trace back into text.
+//
+// All values are little-endian.  The file starts with the magic "VKLT" and a
+// uint32 version, followed by records that each start with a uint8 kind:
+//
+//   LOADER_TRACE_FORMAT: uint32 id, uint16 length, format string bytes.
+//     Written the first time a format string is seen.
+//   LOADER_TRACE_MESSAGE: uint32 format id, uint32 message type (the
+//     VkDebugReportFlagsEXT bits), int32 message code, then one value per
+//     conversion in the format string, including '*' widths and precisions:
+//       integers and %c: int64 (d and i) or uint64 (the others)
+//       %p: uint64
+//       floating point: double
+//       %s: uint16 length then the bytes, or length 0xFFFF for NULL
+//   LOADER_TRACE_INLINE_MESSAGE: as LOADER_TRACE_MESSAGE, but the format id is
+//     replaced by a uint16 length and the format string bytes.  Used once the
+//     table of format ids is full.
+
+#define LOADER_TRACE_MAGIC "VKLT"
+#define LOADER_TRACE_VERSION 1
+
+enum loader_trace_record_kind {
+    LOADER_TRACE_FORMAT = 1,
+    LOADER_TRACE_MESSAGE = 2,
+    LOADER_TRACE_INLINE_MESSAGE = 3,
+};
+
+extern bool g_loader_trace_enabled;
+
+// Start writing the trace to path, the value of VK_LOADER_TRACE
+void loader_trace_init(const char *path);
+
+// Append a message to the trace.  Only call this if g_loader_trace_enabled.
+void loader_trace_message(uint32_t msg_type, int32_t msg_code, const char *format, va_list ap);
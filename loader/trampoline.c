@@ -32,6 +32,7 @@
 #include "wsi.h"
 #include "vk_loader_extensions.h"
 #include "gpa_helper.h"
+#include "vk_loader_dispatch.h"
 
 // Trampoline entrypoints are in this file for core Vulkan commands
 
@@ -683,6 +684,34 @@ LOADER_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyDevice(VkDevice device, const
     loader_platform_thread_unlock_mutex(&loader_lock);
 }
 
+// Copy device's dispatch table, resolved through its enabled layers down to
+// the ICD, so an application can call straight into the first layer or ICD
+// without going through the exported trampolines.  The few device functions
+// that the loader must see itself keep pointing at the loader.
+LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vk_loaderGetDeviceDispatchTable(VkDevice device, size_t tableSize,
+                                                                           VkLayerDispatchTable *pTable) {
+    if (device == VK_NULL_HANDLE || pTable == NULL) {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    // The table layout comes from the generated vk_layer_dispatch_table.h, so
+    // the caller must have been built against the same one
+    if (tableSize != sizeof(VkLayerDispatchTable)) {
+        loader_log(NULL, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "vk_loaderGetDeviceDispatchTable: Caller's VkLayerDispatchTable "
+                   "doesn't match this loader's, rebuild against its vk_layer.h");
+        return VK_ERROR_INCOMPATIBLE_DRIVER;
+    }
+
+    const VkLayerDispatchTable *disp = loader_get_dispatch(device);
+    memcpy(pTable, disp, sizeof(VkLayerDispatchTable));
+    pTable->GetDeviceProcAddr = vkGetDeviceProcAddr;
+    pTable->DestroyDevice = vkDestroyDevice;
+    pTable->GetDeviceQueue = vkGetDeviceQueue;
+    pTable->AllocateCommandBuffers = vkAllocateCommandBuffers;
+    return VK_SUCCESS;
+}
+
 LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice,
                                                                                   const char *pLayerName, uint32_t *pPropertyCount,
                                                                                   VkExtensionProperties *pProperties) {
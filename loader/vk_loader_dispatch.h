@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Entry points this loader exports beyond the Vulkan API.  They are not part of
+// the Khronos headers, so older loaders and other loader implementations may
+// not have them; look them up with dlsym() or GetProcAddress() to fall back.
+
+#include <vulkan/vk_layer.h>
+
+// Copy a device's fully resolved dispatch table into pTable.  tableSize must be
+// sizeof(VkLayerDispatchTable).
+typedef VkResult(VKAPI_PTR *PFN_vk_loaderGetDeviceDispatchTable)(VkDevice device, size_t tableSize, VkLayerDispatchTable *pTable);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+VKAPI_ATTR VkResult VKAPI_CALL vk_loaderGetDeviceDispatchTable(VkDevice device, size_t tableSize, VkLayerDispatchTable *pTable);
+
+#ifdef __cplusplus
+}
+#endif
@@ -119,6 +119,12 @@ static inline void loader_platform_thread_once(pthread_once_t *ctl, void (*func)
     assert(ctl != NULL);
     pthread_once(ctl, func);
 }
+#define LOADER_PLATFORM_THREAD_FUNCTION(name, arg) void *name(void *arg)
+#define LOADER_PLATFORM_THREAD_RETURN NULL
+static inline bool loader_platform_thread_create(loader_platform_thread *thread, void *(*func)(void *), void *arg) {
+    return pthread_create(thread, NULL, func, arg) == 0;
+}
+static inline void loader_platform_thread_join(loader_platform_thread thread) { pthread_join(thread, NULL); }
 
 // Thread IDs:
 typedef pthread_t loader_platform_thread_id;
@@ -136,6 +142,7 @@ static inline void loader_platform_thread_cond_wait(loader_platform_thread_cond
     pthread_cond_wait(pCond, pMutex);
 }
 static inline void loader_platform_thread_cond_broadcast(loader_platform_thread_cond *pCond) { pthread_cond_broadcast(pCond); }
+static inline void loader_platform_thread_delete_cond(loader_platform_thread_cond *pCond) { pthread_cond_destroy(pCond); }
 
 #define loader_stack_alloc(size) alloca(size)
 
@@ -273,6 +280,16 @@ static void loader_platform_thread_once(void *ctl, void (*func)(void)) {
     assert(ctl != NULL);
     InitOnceExecuteOnce((PINIT_ONCE)ctl, InitFuncWrapper, func, NULL);
 }
+#define LOADER_PLATFORM_THREAD_FUNCTION(name, arg) DWORD WINAPI name(LPVOID arg)
+#define LOADER_PLATFORM_THREAD_RETURN 0
+static bool loader_platform_thread_create(loader_platform_thread *thread, LPTHREAD_START_ROUTINE func, void *arg) {
+    *thread = CreateThread(NULL, 0, func, arg, 0, NULL);
+    return *thread != NULL;
+}
+static void loader_platform_thread_join(loader_platform_thread thread) {
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
 
 // Thread IDs:
 typedef DWORD loader_platform_thread_id;
@@ -290,6 +307,8 @@ static void loader_platform_thread_cond_wait(loader_platform_thread_cond *pCond,
     SleepConditionVariableCS(pCond, pMutex, INFINITE);
 }
 static void loader_platform_thread_cond_broadcast(loader_platform_thread_cond *pCond) { WakeAllConditionVariable(pCond); }
+// Windows condition variables hold no resources and have nothing to delete
+static void loader_platform_thread_delete_cond(loader_platform_thread_cond *pCond) { (void)pCond; }
 
 #define loader_stack_alloc(size) _alloca(size)
 #else  // defined(_WIN32)
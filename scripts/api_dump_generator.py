@@ -67,6 +67,7 @@ COMMON_CODEGEN = """
  */
  
 #include "api_dump_text.h"
+#include "vk_layer_stats.h"
 
 //============================= Dump Functions ==============================//
 
@@ -120,6 +121,7 @@ VK_LAYER_EXPORT VKAPI_ATTR {funcReturn} VKAPI_CALL {funcName}({funcTypedParams})
     {funcReturn} result = fpCreateInstance({funcNamedParams});
     if(result == VK_SUCCESS) {{
         initInstanceTable(*pInstance, fpGetInstanceProcAddr);
+        GetLayerStats().Init("lunarg_api_dump");
     }}
 
     // Output the API dump
@@ -138,6 +140,7 @@ VK_LAYER_EXPORT VKAPI_ATTR {funcReturn} VKAPI_CALL {funcName}({funcTypedParams})
     
     // Output the API dump
     dump_{funcName}(ApiDumpInstance::current(), {funcNamedParams});
+    GetLayerStats().DumpJson();
 }}
 @end function
 
@@ -222,7 +225,10 @@ VK_LAYER_EXPORT VKAPI_ATTR {funcReturn} VKAPI_CALL {funcName}({funcTypedParams})
 @foreach function where('{funcName}' == 'vkQueuePresentKHR')
 VK_LAYER_EXPORT VKAPI_ATTR {funcReturn} VKAPI_CALL {funcName}({funcTypedParams})
 {{
+    LAYER_STATS_CALL("{funcName}");
+    layer_stats_call.Pause();
     {funcReturn} result = device_dispatch_table({funcDispatchParam})->{funcShortName}({funcNamedParams});
+    layer_stats_call.Resume();
     dump_{funcName}(ApiDumpInstance::current(), result, {funcNamedParams});
     ApiDumpInstance::current().nextFrame();
     return result;
@@ -234,7 +240,10 @@ VK_LAYER_EXPORT VKAPI_ATTR {funcReturn} VKAPI_CALL {funcName}({funcTypedParams})
 @foreach function where('{funcType}' == 'instance' and '{funcReturn}' != 'void' and '{funcName}' not in ['vkCreateInstance', 'vkDestroyInstance', 'vkCreateDevice', 'vkGetInstanceProcAddr', 'vkEnumerateDeviceExtensionProperties', 'vkEnumerateDeviceLayerProperties'])
 VK_LAYER_EXPORT VKAPI_ATTR {funcReturn} VKAPI_CALL {funcName}({funcTypedParams})
 {{
+    LAYER_STATS_CALL("{funcName}");
+    layer_stats_call.Pause();
     {funcReturn} result = instance_dispatch_table({funcDispatchParam})->{funcShortName}({funcNamedParams});
+    layer_stats_call.Resume();
     dump_{funcName}(ApiDumpInstance::current(), result, {funcNamedParams});
     return result;
 }}
@@ -243,7 +252,10 @@ VK_LAYER_EXPORT VKAPI_ATTR {funcReturn} VKAPI_CALL {funcName}({funcTypedParams})
 @foreach function where('{funcType}' == 'instance' and '{funcReturn}' == 'void' and '{funcName}' not in ['vkCreateInstance', 'vkDestroyInstance', 'vkCreateDevice', 'vkGetInstanceProcAddr', 'vkEnumerateDeviceExtensionProperties', 'vkEnumerateDeviceLayerProperties'])
 VK_LAYER_EXPORT VKAPI_ATTR {funcReturn} VKAPI_CALL {funcName}({funcTypedParams})
 {{
+    LAYER_STATS_CALL("{funcName}");
+    layer_stats_call.Pause();
     instance_dispatch_table({funcDispatchParam})->{funcShortName}({funcNamedParams});
+    layer_stats_call.Resume();
     dump_{funcName}(ApiDumpInstance::current(), {funcNamedParams});
 }}
 @end function
@@ -253,7 +265,10 @@ VK_LAYER_EXPORT VKAPI_ATTR {funcReturn} VKAPI_CALL {funcName}({funcTypedParams})
 @foreach function where('{funcType}' == 'device' and '{funcReturn}' != 'void' and '{funcName}' not in ['vkDestroyDevice', 'vkEnumerateInstanceExtensionProperties', 'vkEnumerateInstanceLayerProperties', 'vkQueuePresentKHR', 'vkGetDeviceProcAddr'])
 VK_LAYER_EXPORT VKAPI_ATTR {funcReturn} VKAPI_CALL {funcName}({funcTypedParams})
 {{
+    LAYER_STATS_CALL("{funcName}");
+    layer_stats_call.Pause();
     {funcReturn} result = device_dispatch_table({funcDispatchParam})->{funcShortName}({funcNamedParams});
+    layer_stats_call.Resume();
     dump_{funcName}(ApiDumpInstance::current(), result, {funcNamedParams});
     return result;
 }}
@@ -262,7 +277,10 @@ VK_LAYER_EXPORT VKAPI_ATTR {funcReturn} VKAPI_CALL {funcName}({funcTypedParams})
 @foreach function where('{funcType}' == 'device' and '{funcReturn}' == 'void' and '{funcName}' not in ['vkDestroyDevice', 'vkEnumerateInstanceExtensionProperties', 'vkEnumerateInstanceLayerProperties', 'vkGetDeviceProcAddr'])
 VK_LAYER_EXPORT VKAPI_ATTR {funcReturn} VKAPI_CALL {funcName}({funcTypedParams})
 {{
+    LAYER_STATS_CALL("{funcName}");
+    layer_stats_call.Pause();
     device_dispatch_table({funcDispatchParam})->{funcShortName}({funcNamedParams});
+    layer_stats_call.Resume();
     dump_{funcName}(ApiDumpInstance::current(), {funcNamedParams});
 }}
 @end function
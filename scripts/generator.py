@@ -23,6 +23,30 @@ def write( *args, **kwargs ):
     file.write(' '.join([str(arg) for arg in args]))
     file.write(end)
 
+# sortInterceptLines - sort the entries of a generated '{"vkName", ...},'
+# intercept table by command name, so the layers can binary search it.
+# Entries keep the '#ifdef' guard they were emitted under.
+#   lines - list of table lines, including '#ifdef'/'#endif' lines
+def sortInterceptLines(lines):
+    entries = []
+    protect = None
+    for line in lines:
+        text = line.strip()
+        if text.startswith('#ifdef'):
+            protect = text
+        elif text.startswith('#endif'):
+            protect = None
+        elif text:
+            name = re.search(r'"(\w+)"', text).group(1)
+            entries.append((name, protect, line))
+    sorted_lines = []
+    for (name, protect, line) in sorted(entries, key=lambda entry: entry[0]):
+        if protect is not None:
+            sorted_lines += [ protect, line, '#endif' ]
+        else:
+            sorted_lines.append(line)
+    return sorted_lines
+
 # noneStr - returns string argument, or "" if argument is None.
 # Used in converting etree Elements into text.
 #   str - string to convert
@@ -379,7 +379,8 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
         protos += 'extern const char *const LOADER_INSTANCE_EXTENSIONS[];\n'
         protos += '\n'
         protos += 'VKAPI_ATTR bool VKAPI_CALL loader_icd_init_entries(struct loader_icd_term *icd_term, VkInstance inst,\n'
-        protos += '                                                   const PFN_vkGetInstanceProcAddr fp_gipa);\n'
+        protos += '                                                   const PFN_vkGetInstanceProcAddr fp_gipa,\n'
+        protos += '                                                   const VkInstanceCreateInfo *icd_create_info);\n'
         protos += '\n'
         protos += '// Init Device function pointer dispatch table with core commands\n'
         protos += 'VKAPI_ATTR void VKAPI_CALL loader_init_device_dispatch_table(struct loader_dev_dispatch_table *dev_table, PFN_vkGetDeviceProcAddr gpa,\n'
@@ -405,7 +406,8 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
         protos += '                                                                  bool *found_name);\n'
         protos += '\n'
         protos += 'VKAPI_ATTR bool VKAPI_CALL loader_icd_init_entries(struct loader_icd_term *icd_term, VkInstance inst,\n'
-        protos += '                                                   const PFN_vkGetInstanceProcAddr fp_gipa);\n'
+        protos += '                                                   const PFN_vkGetInstanceProcAddr fp_gipa,\n'
+        protos += '                                                   const VkInstanceCreateInfo *icd_create_info);\n'
         protos += '\n'
         return protos
 
@@ -559,10 +561,23 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
     def OutputIcdDispatchTableInit(self):
         commands = []
         cur_extension_name = ''
+        in_enable_block = False
 
         table = ''
+        table += '// Instance extension commands can only be reached through an ICD instance that\n'
+        table += '// enabled the extension, so only those extensions are looked up\n'
+        table += 'static bool loader_icd_extension_enabled(const VkInstanceCreateInfo *icd_create_info, const char *extension_name) {\n'
+        table += '    for (uint32_t i = 0; i < icd_create_info->enabledExtensionCount; i++) {\n'
+        table += '        if (!strcmp(icd_create_info->ppEnabledExtensionNames[i], extension_name)) {\n'
+        table += '            return true;\n'
+        table += '        }\n'
+        table += '    }\n'
+        table += '    return false;\n'
+        table += '}\n'
+        table += '\n'
         table += 'VKAPI_ATTR bool VKAPI_CALL loader_icd_init_entries(struct loader_icd_term *icd_term, VkInstance inst,\n'
-        table += '                                                   const PFN_vkGetInstanceProcAddr fp_gipa) {\n'
+        table += '                                                   const PFN_vkGetInstanceProcAddr fp_gipa,\n'
+        table += '                                                   const VkInstanceCreateInfo *icd_create_info) {\n'
         table += '\n'
         table += '#define LOOKUP_GIPA(func, required)                                                        \\\n'
         table += '    do {                                                                                   \\\n'
@@ -593,10 +608,17 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
                 if ((is_inst_handle_type or cur_cmd.name in DEVICE_CMDS_NEED_TERM) and (cur_cmd.name not in skip_gipa_commands)):
 
                     if cur_cmd.ext_name != cur_extension_name:
+                        if in_enable_block:
+                            table += '    }\n'
+                            in_enable_block = False
                         if 'VK_VERSION_' in cur_cmd.ext_name:
                             table += '\n    // ---- Core %s\n' % cur_cmd.ext_name[11:]
                         else:
                             table += '\n    // ---- %s extension commands\n' % cur_cmd.ext_name
+                        # Instance extension commands are resolved only when the ICD enabled the extension
+                        if x == 1 and cur_cmd.ext_type == 'instance':
+                            table += '    if (loader_icd_extension_enabled(icd_create_info, "%s")) {\n' % cur_cmd.ext_name
+                            in_enable_block = True
                         cur_extension_name = cur_cmd.ext_name
 
                     # Remove 'vk' from proto name
@@ -609,12 +631,16 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
                     # For example: VK_VERSION_1_0 wraps the core 1.0 Vulkan functionality
                     if x == 0:
                         table += '    LOOKUP_GIPA(%s, true);\n' % (base_name)
+                    elif in_enable_block:
+                        table += '        LOOKUP_GIPA(%s, false);\n' % (base_name)
                     else:
                         table += '    LOOKUP_GIPA(%s, false);\n' % (base_name)
 
                     if cur_cmd.protect is not None:
                         table += '#endif // %s\n' % cur_cmd.protect
 
+        if in_enable_block:
+            table += '    }\n'
         table += '\n'
         table += '#undef LOOKUP_GIPA\n'
         table += '\n'
@@ -755,31 +781,19 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
         commands = []
         tables = ''
         cur_type = ''
-        cur_extension_name = ''
 
         for x in range(0, 2):
             if x == 0:
                 cur_type = 'device'
-
-                tables += '// Device command lookup function\n'
-                tables += 'VKAPI_ATTR void* VKAPI_CALL loader_lookup_device_dispatch_table(const VkLayerDispatchTable *table, const char *name) {\n'
-                tables += '    if (!name || name[0] != \'v\' || name[1] != \'k\') return NULL;\n'
-                tables += '\n'
-                tables += '    name += 2;\n'
+                table_type = 'VkLayerDispatchTable'
+                names = 'loader_device_dispatch_names'
             else:
                 cur_type = 'instance'
+                table_type = 'VkLayerInstanceDispatchTable'
+                names = 'loader_instance_dispatch_names'
 
-                tables += '// Instance command lookup function\n'
-                tables += 'VKAPI_ATTR void* VKAPI_CALL loader_lookup_instance_dispatch_table(const VkLayerInstanceDispatchTable *table, const char *name,\n'
-                tables += '                                                                 bool *found_name) {\n'
-                tables += '    if (!name || name[0] != \'v\' || name[1] != \'k\') {\n'
-                tables += '        *found_name = false;\n'
-                tables += '        return NULL;\n'
-                tables += '    }\n'
-                tables += '\n'
-                tables += '    *found_name = true;\n'
-                tables += '    name += 2;\n'
-
+            # Collect (name, protect) pairs and emit them sorted so the lookup can binary search
+            entries = []
             for y in range(0, 2):
                 if y == 0:
                     commands = self.core_commands
@@ -790,13 +804,6 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
                     is_inst_handle_type = cur_cmd.ext_type == 'instance' or cur_cmd.handle_type == 'VkInstance' or cur_cmd.handle_type == 'VkPhysicalDevice'
                     if ((cur_type == 'instance' and is_inst_handle_type) or (cur_type == 'device' and not is_inst_handle_type)):
 
-                        if cur_cmd.ext_name != cur_extension_name:
-                            if 'VK_VERSION_' in cur_cmd.ext_name:
-                                tables += '\n    // ---- Core %s commands\n' % cur_cmd.ext_name[11:]
-                            else:
-                                tables += '\n    // ---- %s extension commands\n' % cur_cmd.ext_name
-                            cur_extension_name = cur_cmd.ext_name
-
                         # Remove 'vk' from proto name
                         base_name = cur_cmd.name[2:]
 
@@ -805,18 +812,38 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
                             base_name == 'EnumerateInstanceLayerProperties'):
                             continue
 
-                        if cur_cmd.protect is not None:
-                            tables += '#ifdef %s\n' % cur_cmd.protect
-
-                        tables += '    if (!strcmp(name, "%s")) return (void *)table->%s;\n' % (base_name, base_name)
+                        entries.append((base_name, cur_cmd.protect))
 
-                        if cur_cmd.protect is not None:
-                            tables += '#endif // %s\n' % cur_cmd.protect
+            tables += '// %s dispatch table offsets, sorted by command name for bsearch()\n' % cur_type.capitalize()
+            tables += 'static const struct loader_dispatch_name_offset %s[] = {\n' % names
+            for (base_name, protect) in sorted(entries, key=lambda entry: entry[0]):
+                if protect is not None:
+                    tables += '#ifdef %s\n' % protect
+                tables += '    {"%s", offsetof(%s, %s)},\n' % (base_name, table_type, base_name)
+                if protect is not None:
+                    tables += '#endif // %s\n' % protect
+            tables += '};\n\n'
 
+            if x == 0:
+                tables += '// Device command lookup function\n'
+                tables += 'VKAPI_ATTR void* VKAPI_CALL loader_lookup_device_dispatch_table(const VkLayerDispatchTable *table, const char *name) {\n'
+                tables += '    if (!name || name[0] != \'v\' || name[1] != \'k\') return NULL;\n'
+            else:
+                tables += '// Instance command lookup function\n'
+                tables += 'VKAPI_ATTR void* VKAPI_CALL loader_lookup_instance_dispatch_table(const VkLayerInstanceDispatchTable *table, const char *name,\n'
+                tables += '                                                                 bool *found_name) {\n'
+                tables += '    if (!name || name[0] != \'v\' || name[1] != \'k\') {\n'
+                tables += '        *found_name = false;\n'
+                tables += '        return NULL;\n'
+                tables += '    }\n'
             tables += '\n'
+            tables += '    const struct loader_dispatch_name_offset *entry =\n'
+            tables += '        bsearch(name + 2, %s, sizeof(%s) / sizeof(%s[0]), sizeof(%s[0]),\n' % (names, names, names, names)
+            tables += '                loader_compare_entry_name);\n'
             if x == 1:
-                tables += '    *found_name = false;\n'
-            tables += '    return NULL;\n'
+                tables += '    *found_name = (entry != NULL);\n'
+            tables += '    if (entry == NULL) return NULL;\n'
+            tables += '    return (void *)*(const PFN_vkVoidFunction *)((const char *)table + entry->offset);\n'
             tables += '}\n\n'
         return tables
 
@@ -1084,12 +1111,8 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
     # Create a function for the extension GPA call
     def InstExtensionGPA(self):
         entries = []
+        enables = []
         gpa_func = ''
-        cur_extension_name = ''
-
-        gpa_func += '// GPA helpers for extensions\n'
-        gpa_func += 'bool extension_instance_gpa(struct loader_instance *ptr_instance, const char *name, void **addr) {\n'
-        gpa_func += '    *addr = NULL;\n\n'
 
         for cur_cmd in self.ext_commands:
             if ('VK_VERSION_' in cur_cmd.ext_name or
@@ -1097,34 +1120,58 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
                 cur_cmd.ext_name in AVOID_EXT_NAMES):
                 continue
 
-            if cur_cmd.ext_name != cur_extension_name:
-                gpa_func += '\n    // ---- %s extension commands\n' % cur_cmd.ext_name
-                cur_extension_name = cur_cmd.ext_name
-
-            if cur_cmd.protect is not None:
-                gpa_func += '#ifdef %s\n' % cur_cmd.protect
-
-            base_name = cur_cmd.name[2:]
-
+            # Instance extension commands are only returned if their extension is enabled,
+            # device extension commands use enable index 0 and are always returned
+            enable = 0
             if (cur_cmd.ext_type == 'instance'):
-                gpa_func += '    if (!strcmp("%s", name)) {\n' % (cur_cmd.name)
-                gpa_func += '        *addr = (ptr_instance->enabled_known_extensions.'
-                gpa_func += cur_cmd.ext_name[3:].lower()
-                gpa_func += ' == 1)\n'
-                gpa_func += '                     ? (void *)%s\n' % (base_name)
-                gpa_func += '                     : NULL;\n'
-                gpa_func += '        return true;\n'
-                gpa_func += '    }\n'
-            else:
-                gpa_func += '    if (!strcmp("%s", name)) {\n' % (cur_cmd.name)
-                gpa_func += '        *addr = (void *)%s;\n' % (base_name)
-                gpa_func += '        return true;\n'
-                gpa_func += '    }\n'
+                if (cur_cmd.ext_name, cur_cmd.protect) not in enables:
+                    enables.append((cur_cmd.ext_name, cur_cmd.protect))
+                enable = enables.index((cur_cmd.ext_name, cur_cmd.protect)) + 1
+
+            entries.append((cur_cmd.name, cur_cmd.name[2:], enable, cur_cmd.protect))
+
+        gpa_func += '// Instance extension enables checked by extension_instance_gpa\n'
+        gpa_func += 'static bool extension_instance_gpa_enabled(const struct loader_instance *ptr_instance, uint32_t enable) {\n'
+        gpa_func += '    switch (enable) {\n'
+        for (index, (ext_name, protect)) in enumerate(enables):
+            if protect is not None:
+                gpa_func += '#ifdef %s\n' % protect
+            gpa_func += '        case %d:  // %s\n' % (index + 1, ext_name)
+            gpa_func += '            return ptr_instance->enabled_known_extensions.%s == 1;\n' % ext_name[3:].lower()
+            if protect is not None:
+                gpa_func += '#endif // %s\n' % protect
+        gpa_func += '        default:\n'
+        gpa_func += '            return true;\n'
+        gpa_func += '    }\n'
+        gpa_func += '}\n\n'
 
-            if cur_cmd.protect is not None:
-                gpa_func += '#endif // %s\n' % cur_cmd.protect
+        gpa_func += '// Extension commands handled by the loader, sorted by name for bsearch()\n'
+        gpa_func += 'static const struct loader_extension_gpa_entry {\n'
+        gpa_func += '    const char *name;\n'
+        gpa_func += '    PFN_vkVoidFunction proc;\n'
+        gpa_func += '    uint32_t enable;\n'
+        gpa_func += '} extension_instance_gpa_entries[] = {\n'
+        for (name, base_name, enable, protect) in sorted(entries, key=lambda entry: entry[0]):
+            if protect is not None:
+                gpa_func += '#ifdef %s\n' % protect
+            gpa_func += '    {"%s", (PFN_vkVoidFunction)%s, %d},\n' % (name, base_name, enable)
+            if protect is not None:
+                gpa_func += '#endif // %s\n' % protect
+        gpa_func += '};\n\n'
 
-        gpa_func += '    return false;\n'
+        gpa_func += '// GPA helpers for extensions\n'
+        gpa_func += 'bool extension_instance_gpa(struct loader_instance *ptr_instance, const char *name, void **addr) {\n'
+        gpa_func += '    *addr = NULL;\n'
+        gpa_func += '\n'
+        gpa_func += '    const struct loader_extension_gpa_entry *entry =\n'
+        gpa_func += '        bsearch(name, extension_instance_gpa_entries, sizeof(extension_instance_gpa_entries) / sizeof(extension_instance_gpa_entries[0]),\n'
+        gpa_func += '                sizeof(extension_instance_gpa_entries[0]), loader_compare_entry_name);\n'
+        gpa_func += '    if (entry == NULL) return false;\n'
+        gpa_func += '\n'
+        gpa_func += '    if (extension_instance_gpa_enabled(ptr_instance, entry->enable)) {\n'
+        gpa_func += '        *addr = (void *)entry->proc;\n'
+        gpa_func += '    }\n'
+        gpa_func += '    return true;\n'
         gpa_func += '}\n\n'
 
         return gpa_func
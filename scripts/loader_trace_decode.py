@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2017 The Khronos Group Inc.
+# Copyright (c) 2017 Valve Corporation
+# Copyright (c) 2017 LunarG, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Decodes a loader trace written with VK_LOADER_TRACE=<file> and prints the
+# messages the way VK_LOADER_DEBUG=all would.  The file format is described in
+# loader/log_trace.h.
+#
+# Usage: loader_trace_decode.py [--types info,warn,perf,error,debug] <trace file>
+
+import argparse
+import re
+import struct
+import sys
+
+TRACE_MAGIC = b'VKLT'
+TRACE_VERSION = 1
+
+RECORD_FORMAT = 1
+RECORD_MESSAGE = 2
+RECORD_INLINE_MESSAGE = 3
+
+NULL_STRING = 0xFFFF
+
+# Message type bits, in the order the loader prints them
+MESSAGE_TYPES = [
+    ('info', 0x01, 'INFO'),
+    ('warn', 0x02, 'WARNING'),
+    ('perf', 0x04, 'PERF'),
+    ('error', 0x08, 'ERROR'),
+    ('debug', 0x10, 'DEBUG'),
+]
+
+CONVERSION = re.compile(r"%([-+ #0']*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|z|j|t|L)?([diouxXcpsfFeEgGaAn%])")
+
+class TraceError(Exception):
+    pass
+
+class TraceReader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def at_end(self):
+        return self.pos >= len(self.data)
+
+    def read(self, fmt):
+        size = struct.calcsize(fmt)
+        if self.pos + size > len(self.data):
+            raise TraceError('truncated record at offset %d' % self.pos)
+        values = struct.unpack_from(fmt, self.data, self.pos)
+        self.pos += size
+        return values[0]
+
+    def read_string(self):
+        length = self.read('<H')
+        if length == NULL_STRING:
+            return None
+        if self.pos + length > len(self.data):
+            raise TraceError('truncated string at offset %d' % self.pos)
+        value = self.data[self.pos:self.pos + length].decode('utf-8', 'replace')
+        self.pos += length
+        return value
+
+# Rebuild the message from its format string, reading one value per conversion
+# in the same order the loader wrote them
+def format_message(reader, fmt):
+    def convert(match):
+        flags, width, precision, length, conversion = match.groups()
+        if conversion == '%':
+            return '%'
+        if width == '*':
+            width = str(struct.unpack('<q', struct.pack('<Q', reader.read('<Q')))[0])
+        if precision == '*':
+            precision = str(max(struct.unpack('<q', struct.pack('<Q', reader.read('<Q')))[0], 0))
+        spec = '%' + flags.replace("'", '') + (width or '')
+        if precision is not None:
+            spec += '.' + (precision or '0')
+        if conversion in 'di':
+            return (spec + 'd') % reader.read('<q')
+        if conversion in 'uxXo':
+            return (spec + ('d' if conversion == 'u' else conversion)) % reader.read('<Q')
+        if conversion == 'c':
+            return (spec + 'c') % chr(reader.read('<Q') & 0xFF)
+        if conversion == 'p':
+            return '0x%x' % reader.read('<Q')
+        if conversion == 's':
+            value = reader.read_string()
+            return (spec + 's') % ('(null)' if value is None else value)
+        if conversion in 'fFeEgGaA':
+            value = reader.read('<d')
+            if conversion in 'aA':
+                return value.hex()
+            return (spec + conversion) % value
+        return ''
+
+    return CONVERSION.sub(convert, fmt)
+
+def message_prefix(msg_type):
+    names = [name for _, bit, name in MESSAGE_TYPES if msg_type & bit]
+    return ' | '.join(names) + ': ' if names else ''
+
+def decode(data, type_mask, out):
+    reader = TraceReader(data)
+    if data[:4] != TRACE_MAGIC:
+        raise TraceError('not a loader trace')
+    reader.pos = 4
+    version = reader.read('<I')
+    if version != TRACE_VERSION:
+        raise TraceError('unsupported trace version %d' % version)
+
+    formats = {}
+    while not reader.at_end():
+        kind = reader.read('<B')
+        if kind == RECORD_FORMAT:
+            format_id = reader.read('<I')
+            formats[format_id] = reader.read_string()
+            continue
+        if kind == RECORD_MESSAGE:
+            format_id = reader.read('<I')
+            if format_id not in formats:
+                raise TraceError('unknown format id %d at offset %d' % (format_id, reader.pos))
+            fmt = formats[format_id]
+        elif kind == RECORD_INLINE_MESSAGE:
+            fmt = reader.read_string()
+        else:
+            raise TraceError('unknown record kind %d at offset %d' % (kind, reader.pos - 1))
+        msg_type = reader.read('<I')
+        reader.read('<i')  # message code
+        message = format_message(reader, fmt)
+        if msg_type & type_mask:
+            out.write(message_prefix(msg_type) + message + '\n')
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode a Vulkan loader trace written with VK_LOADER_TRACE.')
+    parser.add_argument('--types', default='all',
+                        help='comma-separated message types to print, as for VK_LOADER_DEBUG (default: all)')
+    parser.add_argument('trace', help='trace file to decode')
+    args = parser.parse_args()
+
+    type_mask = 0
+    for name in args.types.split(','):
+        if name == 'all':
+            type_mask = ~0
+        else:
+            bits = [bit for type_name, bit, _ in MESSAGE_TYPES if type_name == name]
+            if not bits:
+                parser.error('unknown message type %s' % name)
+            type_mask |= bits[0]
+
+    with open(args.trace, 'rb') as trace_file:
+        data = trace_file.read()
+    try:
+        decode(data, type_mask, sys.stdout)
+    except TraceError as error:
+        sys.stderr.write('%s: %s\n' % (args.trace, error))
+        return 1
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -213,9 +213,9 @@ class ParamCheckerOutputGenerator(OutputGenerator):
         # Output declarations and record intercepted procedures
         write('// Declarations', file=self.outFile)
         write('\n'.join(self.declarations), file=self.outFile)
-        write('// Intercepts', file=self.outFile)
+        write('// Intercepts, sorted by name for util_FindEntryByName', file=self.outFile)
         write('struct { const char* name; PFN_vkVoidFunction pFunc;} procmap[] = {', file=self.outFile)
-        write('\n'.join(self.intercepts), file=self.outFile)
+        write('\n'.join(sortInterceptLines(self.intercepts)), file=self.outFile)
         write('};\n', file=self.outFile)
         self.newline()
         # Namespace
@@ -1010,6 +1010,7 @@ class ParamCheckerOutputGenerator(OutputGenerator):
             if lines:
                 cmdDef = self.getCmdDef(command) + '\n'
                 cmdDef += '{\n'
+                cmdDef += indent + 'LAYER_STATS_CALL("{}");\n'.format(command.name)
                 # Process unused parameters, Ignoring the first dispatch handle parameter, which is not
                 # processed by parameter_validation (except for vkCreateInstance, which does not have a
                 # handle as its first parameter)
@@ -271,9 +271,9 @@ class ThreadOutputGenerator(OutputGenerator):
         # Finish C++ namespace and multiple inclusion protection
         self.newline()
         # record intercepted procedures
-        write('// intercepts', file=self.outFile)
+        write('// intercepts, sorted by name for util_FindEntryByName', file=self.outFile)
         write('struct { const char* name; PFN_vkVoidFunction pFunc;} procmap[] = {', file=self.outFile)
-        write('\n'.join(self.intercepts), file=self.outFile)
+        write('\n'.join(sortInterceptLines(self.intercepts)), file=self.outFile)
         write('};\n', file=self.outFile)
         self.newline()
         write('} // namespace threading', file=self.outFile)
@@ -413,6 +413,7 @@ class ThreadOutputGenerator(OutputGenerator):
         self.appendSection('command', '')
         self.appendSection('command', decls[0][:-1])
         self.appendSection('command', '{')
+        self.appendSection('command', '    LAYER_STATS_CALL("%s");' % name)
         # setup common to call wrappers
         # first parameter is always dispatchable
         dispatchable_type = cmdinfo.elem.find('param/type').text
@@ -440,7 +441,9 @@ class ThreadOutputGenerator(OutputGenerator):
         params = cmdinfo.elem.findall('param/name')
         paramstext = ','.join([str(param.text) for param in params])
         API = cmdinfo.elem.attrib.get('name').replace('vk','pTable->',1)
+        self.appendSection('command', '    layer_stats_call.Pause();')
         self.appendSection('command', '    ' + assignresult + API + '(' + paramstext + ');')
+        self.appendSection('command', '    layer_stats_call.Resume();')
         self.appendSection('command', '    if (threadChecks) {')
         self.appendSection('command', "    "+"\n    ".join(str(finishthreadsafety).rstrip().split("\n")))
         self.appendSection('command', '    } else {')
@@ -137,6 +137,7 @@ class UniqueObjectsOutputGenerator(OutputGenerator):
             'vkCreateSwapchainKHR',
             'vkCreateSharedSwapchainsKHR',
             'vkGetSwapchainImagesKHR',
+            'vkDestroySwapchainKHR',
             'vkQueuePresentKHR',
             'vkEnumerateInstanceLayerProperties',
             'vkEnumerateDeviceLayerProperties',
@@ -147,6 +148,10 @@ class UniqueObjectsOutputGenerator(OutputGenerator):
             'vkCmdPushDescriptorSetWithTemplateKHR',
             'vkDebugMarkerSetObjectTagEXT',
             'vkDebugMarkerSetObjectNameEXT',
+            'vkAllocateDescriptorSets',
+            'vkFreeDescriptorSets',
+            'vkResetDescriptorPool',
+            'vkDestroyDescriptorPool',
             ]
         # Commands shadowed by interface functions and are not implemented
         self.interface_functions = [
@@ -172,6 +177,7 @@ class UniqueObjectsOutputGenerator(OutputGenerator):
                                        # A sister-struct may contain no handles but shares <validextensionstructs> with one that does
         self.structTypes = dict()      # Map of Vulkan struct typename to required VkStructureType
         self.struct_member_dict = dict()
+        self.scratch_fail_code = ''    # Statement that abandons the function being generated when a scratch copy fails
         # Named tuples to store struct and command data
         self.StructType = namedtuple('StructType', ['name', 'value'])
         self.CmdMemberData = namedtuple('CmdMemberData', ['name', 'members'])
@@ -258,9 +264,9 @@ class UniqueObjectsOutputGenerator(OutputGenerator):
         self.newline()
 
         # Record intercepted procedures
-        write('// intercepts', file=self.outFile)
+        write('// intercepts, sorted by name for util_FindEntryByName', file=self.outFile)
         write('struct { const char* name; PFN_vkVoidFunction pFunc;} procmap[] = {', file=self.outFile)
-        write('\n'.join(self.intercepts), file=self.outFile)
+        write('\n'.join(sortInterceptLines(self.intercepts)), file=self.outFile)
         write('};\n', file=self.outFile)
         self.newline()
         write('} // namespace unique_objects', file=self.outFile)
@@ -413,10 +419,6 @@ class UniqueObjectsOutputGenerator(OutputGenerator):
         self.structMembers.append(self.StructMemberData(name=typeName, members=membersInfo))
 
     #
-    # Insert a lock_guard line
-    def lock_guard(self, indent):
-        return '%sstd::lock_guard<std::mutex> lock(global_lock);\n' % indent
-    #
     # Determine if a struct has an NDO as a member or an embedded member
     def struct_contains_ndo(self, struct_item):
         struct_member_dict = dict(self.structMembers)
@@ -481,28 +483,29 @@ class UniqueObjectsOutputGenerator(OutputGenerator):
     #
     # Generate pNext handling function
     def build_extension_processing_func(self):
-        # Construct helper functions to build and free pNext extension chains
+        # Construct helper function to build an unwrapped pNext extension chain out of scratch-arena shallow copies
         pnext_proc = ''
-        pnext_proc += 'void *CreateUnwrappedExtensionStructs(layer_data *dev_data, const void *pNext) {\n'
-        pnext_proc += '    void *cur_pnext = const_cast<void *>(pNext);\n'
+        # A failed copy ends the chain early; callers check the arena before using it
+        self.scratch_fail_code = 'return NULL;'
+        pnext_proc += 'void *CreateUnwrappedExtensionStructs(ScratchArena *scratch, const void *pNext) {\n'
         pnext_proc += '    void *head_pnext = NULL;\n'
-        pnext_proc += '    void *prev_ext_struct = NULL;\n'
-        pnext_proc += '    void *cur_ext_struct = NULL;\n\n'
-        pnext_proc += '    while (cur_pnext != NULL) {\n'
-        pnext_proc += '        GenericHeader *header = reinterpret_cast<GenericHeader *>(cur_pnext);\n\n'
-        pnext_proc += '        switch (header->sType) {\n'
+        pnext_proc += '    GenericHeader *prev_ext_struct = NULL;\n\n'
+        pnext_proc += '    for (auto cur_pnext = reinterpret_cast<const GenericHeader *>(pNext); cur_pnext != NULL;\n'
+        pnext_proc += '         cur_pnext = reinterpret_cast<const GenericHeader *>(cur_pnext->pNext)) {\n'
+        pnext_proc += '        void *cur_ext_struct = NULL;\n\n'
+        pnext_proc += '        switch (cur_pnext->sType) {\n'
         for item in self.extension_structs:
             struct_info = self.struct_member_dict[item]
             if struct_info[0].feature_protect is not None:
                 pnext_proc += '#ifdef %s \n' % struct_info[0].feature_protect
             pnext_proc += '            case %s: {\n' % self.structTypes[item].value
-            pnext_proc += '                    safe_%s *safe_struct = reinterpret_cast<safe_%s *>(new safe_%s);\n' % (item, item, item)
-            pnext_proc += '                    safe_struct->initialize(reinterpret_cast<const %s *>(cur_pnext));\n' % item
+            pnext_proc += '                    %s *ext_struct = scratch->Copy(reinterpret_cast<const %s *>(cur_pnext), 1);\n' % (item, item)
+            pnext_proc += '                    if (!ext_struct) %s\n' % self.scratch_fail_code
             # Generate code to unwrap the handles
             indent = '                '
-            (tmp_decl, tmp_pre, tmp_post) = self.uniquify_members(struct_info, indent, 'safe_struct->', 0, False, False, False, False)
-            pnext_proc += tmp_pre
-            pnext_proc += '                    cur_ext_struct = reinterpret_cast<void *>(safe_struct);\n'
+            (tmp_decl, tmp_pre, tmp_post) = self.uniquify_members(struct_info, indent, 'ext_struct->', 0, False, False, False, False)
+            pnext_proc += tmp_pre.replace('scratch.', 'scratch->')
+            pnext_proc += '                    cur_ext_struct = ext_struct;\n'
             pnext_proc += '                } break;\n'
             if struct_info[0].feature_protect is not None:
                 pnext_proc += '#endif // %s \n' % struct_info[0].feature_protect
@@ -510,30 +513,18 @@ class UniqueObjectsOutputGenerator(OutputGenerator):
         pnext_proc += '            default:\n'
         pnext_proc += '                break;\n'
         pnext_proc += '        }\n\n'
-        pnext_proc += '        // Save pointer to the first structure in the pNext chain\n'
-        pnext_proc += '        head_pnext = (head_pnext ? head_pnext : cur_ext_struct);\n\n'
-        pnext_proc += '        // For any extension structure but the first, link the last struct\'s pNext to the current ext struct\n'
+        pnext_proc += '        if (cur_ext_struct == NULL) continue;\n\n'
+        pnext_proc += '        // Save pointer to the first structure in the pNext chain, and link any later one to its predecessor\n'
         pnext_proc += '        if (prev_ext_struct) {\n'
-        pnext_proc += '            (reinterpret_cast<GenericHeader *>(prev_ext_struct))->pNext = cur_ext_struct;\n'
+        pnext_proc += '            prev_ext_struct->pNext = cur_ext_struct;\n'
+        pnext_proc += '        } else {\n'
+        pnext_proc += '            head_pnext = cur_ext_struct;\n'
         pnext_proc += '        }\n'
-        pnext_proc += '        prev_ext_struct = cur_ext_struct;\n\n'
-        pnext_proc += '        // Process the next structure in the chain\n'
-        pnext_proc += '        cur_pnext = const_cast<void *>(header->pNext);\n'
+        pnext_proc += '        prev_ext_struct = reinterpret_cast<GenericHeader *>(cur_ext_struct);\n'
         pnext_proc += '    }\n'
         pnext_proc += '    return head_pnext;\n'
-        pnext_proc += '}\n\n'
-        pnext_proc += '// Free a pNext extension chain\n'
-        pnext_proc += 'void FreeUnwrappedExtensionStructs(void *head) {\n'
-        pnext_proc += '    void * curr_ptr = head;\n'
-        pnext_proc += '    while (curr_ptr) {\n'
-        pnext_proc += '        GenericHeader *header = reinterpret_cast<GenericHeader *>(curr_ptr);\n'
-        pnext_proc += '        void *temp = curr_ptr;\n'
-        pnext_proc += '        curr_ptr = header->pNext;\n'
-        pnext_proc += '        free(temp);\n'
-        pnext_proc += '    }\n'
         pnext_proc += '}\n'
         return pnext_proc
-
     #
     # Generate source for creating a non-dispatchable object
     def generate_create_ndo_code(self, indent, proto, params, cmd_info):
@@ -547,15 +538,12 @@ class UniqueObjectsOutputGenerator(OutputGenerator):
             handle_name = params[-1].find('name')
             create_ndo_code += '%sif (VK_SUCCESS == result) {\n' % (indent)
             indent = self.incIndent(indent)
-            create_ndo_code += '%sstd::lock_guard<std::mutex> lock(global_lock);\n' % (indent)
             ndo_dest = '*%s' % handle_name.text
             if ndo_array == True:
                 create_ndo_code += '%sfor (uint32_t index0 = 0; index0 < %s; index0++) {\n' % (indent, cmd_info[-1].len)
                 indent = self.incIndent(indent)
                 ndo_dest = '%s[index0]' % cmd_info[-1].name
-            create_ndo_code += '%suint64_t unique_id = global_unique_id++;\n' % (indent)
-            create_ndo_code += '%sdev_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(%s);\n' % (indent, ndo_dest)
-            create_ndo_code += '%s%s = reinterpret_cast<%s&>(unique_id);\n' % (indent, ndo_dest, handle_type.text)
+            create_ndo_code += '%s%s = WrapNew(dev_data, %s);\n' % (indent, ndo_dest, ndo_dest)
             if ndo_array == True:
                 indent = self.decIndent(indent)
                 create_ndo_code += '%s}\n' % indent
@@ -579,42 +567,30 @@ class UniqueObjectsOutputGenerator(OutputGenerator):
                     # This API is freeing an array of handles.  Remove them from the unique_id map.
                     destroy_ndo_code += '%sif ((VK_SUCCESS == result) && (%s)) {\n' % (indent, cmd_info[param].name)
                     indent = self.incIndent(indent)
-                    destroy_ndo_code += '%sstd::unique_lock<std::mutex> lock(global_lock);\n' % (indent)
                     destroy_ndo_code += '%sfor (uint32_t index0 = 0; index0 < %s; index0++) {\n' % (indent, cmd_info[param].len)
                     indent = self.incIndent(indent)
-                    destroy_ndo_code += '%s%s handle = %s[index0];\n' % (indent, cmd_info[param].type, cmd_info[param].name)
-                    destroy_ndo_code += '%suint64_t unique_id = reinterpret_cast<uint64_t &>(handle);\n' % (indent)
-                    destroy_ndo_code += '%sdev_data->unique_id_mapping.erase(unique_id);\n' % (indent)
+                    destroy_ndo_code += '%sUnwrapAndRelease(%s[index0]);\n' % (indent, cmd_info[param].name)
                     indent = self.decIndent(indent);
                     destroy_ndo_code += '%s}\n' % indent
                     indent = self.decIndent(indent);
                     destroy_ndo_code += '%s}\n' % indent
                 else:
                     # Remove a single handle from the map
-                    destroy_ndo_code += '%sstd::unique_lock<std::mutex> lock(global_lock);\n' % (indent)
-                    destroy_ndo_code += '%suint64_t %s_id = reinterpret_cast<uint64_t &>(%s);\n' % (indent, cmd_info[param].name, cmd_info[param].name)
-                    destroy_ndo_code += '%s%s = (%s)dev_data->unique_id_mapping[%s_id];\n' % (indent, cmd_info[param].name, cmd_info[param].type, cmd_info[param].name)
-                    destroy_ndo_code += '%sdev_data->unique_id_mapping.erase(%s_id);\n' % (indent, cmd_info[param].name)
-                    destroy_ndo_code += '%slock.unlock();\n' % (indent)
+                    destroy_ndo_code += '%s%s = UnwrapAndRelease(%s);\n' % (indent, cmd_info[param].name, cmd_info[param].name)
         return ndo_array, destroy_ndo_code
 
     #
-    # Clean up local declarations
-    def cleanUpLocalDeclarations(self, indent, prefix, name, len, index, process_pnext):
-        cleanup = '%sif (local_%s%s)\n' % (indent, prefix, name)
-        if len is not None:
-            if process_pnext:
-                cleanup += '%s    for (uint32_t %s = 0; %s < %s%s; ++%s) {\n' % (indent, index, index, prefix, len, index)
-                cleanup += '%s        FreeUnwrappedExtensionStructs(const_cast<void *>(local_%s%s[%s].pNext));\n' % (indent, prefix, name, index)
-                cleanup += '%s    }\n' % indent
-            cleanup += '%s    delete[] local_%s%s;\n' % (indent, prefix, name)
-        else:
-            if process_pnext:
-                cleanup += '%s    FreeUnwrappedExtensionStructs(const_cast<void *>(local_%s%s->pNext));\n' % (indent, prefix, name)
-            cleanup += '%s    delete local_%s%s;\n' % (indent, prefix, name)
-        return cleanup
+    # Structs whose shallow copies need pointers the spec says to ignore cleared before any nested array is copied
+    struct_copy_fixups = {'VkWriteDescriptorSet' : 'ClearIgnoredDescriptorPointers'}
     #
-    # Output UO code for a single NDO (ndo_count is NULL) or a counted list of NDOs
+    # Emit a fixup call for a freshly shallow-copied struct, if its type needs one
+    def structCopyFixup(self, indent, struct_type, struct_ref):
+        if struct_type in self.struct_copy_fixups:
+            return '%s    %s(&%s);\n' % (indent, self.struct_copy_fixups[struct_type], struct_ref)
+        return ''
+    #
+    # Output UO code for a single NDO (ndo_count is NULL) or a counted list of NDOs. Counted lists are copied into the
+    # per-call scratch arena and unwrapped in place; nested lists are then linked into their (already copied) parent.
     def outputNDOs(self, ndo_type, ndo_name, ndo_count, prefix, index, indent, destroy_func, destroy_array, top_level):
         decl_code = ''
         pre_call_code = ''
@@ -622,44 +598,39 @@ class UniqueObjectsOutputGenerator(OutputGenerator):
         if ndo_count is not None:
             if top_level == True:
                 decl_code += '%s%s *local_%s%s = NULL;\n' % (indent, ndo_type, prefix, ndo_name)
+                copy_name = 'local_%s%s' % (prefix, ndo_name)
+            else:
+                copy_name = 'local_%s_%s' % (ndo_name, index)
             pre_call_code += '%s    if (%s%s) {\n' % (indent, prefix, ndo_name)
             indent = self.incIndent(indent)
             if top_level == True:
-                pre_call_code += '%s    local_%s%s = new %s[%s];\n' % (indent, prefix, ndo_name, ndo_type, ndo_count)
-                pre_call_code += '%s    for (uint32_t %s = 0; %s < %s; ++%s) {\n' % (indent, index, index, ndo_count, index)
-                indent = self.incIndent(indent)
-                pre_call_code += '%s    local_%s%s[%s] = (%s)dev_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(%s[%s])];\n' % (indent, prefix, ndo_name, index, ndo_type, ndo_name, index)
+                pre_call_code += '%s    %s = scratch.Copy(%s, %s);\n' % (indent, copy_name, ndo_name, ndo_count)
             else:
-                pre_call_code += '%s    for (uint32_t %s = 0; %s < %s; ++%s) {\n' % (indent, index, index, ndo_count, index)
-                indent = self.incIndent(indent)
-                pre_call_code += '%s    %s%s[%s] = (%s)dev_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(%s%s[%s])];\n' % (indent, prefix, ndo_name, index, ndo_type, prefix, ndo_name, index)
-            indent = self.decIndent(indent)
+                pre_call_code += '%s    %s *%s = scratch.Copy(%s%s, %s);\n' % (indent, ndo_type, copy_name, prefix, ndo_name, ndo_count)
+            pre_call_code += '%s    if (!%s) %s\n' % (indent, copy_name, self.scratch_fail_code)
+            pre_call_code += '%s    for (uint32_t %s = 0; %s < %s; ++%s) {\n' % (indent, index, index, ndo_count, index)
+            pre_call_code += '%s        %s[%s] = Unwrap(%s[%s]);\n' % (indent, copy_name, index, copy_name, index)
             pre_call_code += '%s    }\n' % indent
+            if top_level == False:
+                pre_call_code += '%s    %s%s = %s;\n' % (indent, prefix, ndo_name, copy_name)
             indent = self.decIndent(indent)
             pre_call_code += '%s    }\n' % indent
-            if top_level == True:
-                post_call_code += '%sif (local_%s%s)\n' % (indent, prefix, ndo_name)
-                indent = self.incIndent(indent)
-                post_call_code += '%sdelete[] local_%s;\n' % (indent, ndo_name)
         else:
             if top_level == True:
                 if (destroy_func == False) or (destroy_array == True):
-                    pre_call_code += '%s    %s = (%s)dev_data->unique_id_mapping[reinterpret_cast<uint64_t &>(%s)];\n' % (indent, ndo_name, ndo_type, ndo_name)
+                    pre_call_code += '%s    %s = Unwrap(%s);\n' % (indent, ndo_name, ndo_name)
             else:
-                # Make temp copy of this var with the 'local' removed. It may be better to not pass in 'local_'
-                # as part of the string and explicitly print it
-                fix = str(prefix).strip('local_');
-                pre_call_code += '%s    if (%s%s) {\n' % (indent, fix, ndo_name)
-                indent = self.incIndent(indent)
-                pre_call_code += '%s    %s%s = (%s)dev_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(%s%s)];\n' % (indent, prefix, ndo_name, ndo_type, fix, ndo_name)
-                indent = self.decIndent(indent)
-                pre_call_code += '%s    }\n' % indent
+                pre_call_code += '%s    %s%s = Unwrap(%s%s);\n' % (indent, prefix, ndo_name, prefix, ndo_name)
         return decl_code, pre_call_code, post_call_code
     #
     # first_level_param indicates if elements are passed directly into the function else they're below a ptr/struct
     # create_func means that this is API creates or allocates NDOs
     # destroy_func indicates that this API destroys or frees NDOs
     # destroy_array means that the destroy_func operated on an array of NDOs
+    #
+    # Structs are shallow-copied into a per-call ScratchArena named 'scratch'; only members that lead to an NDO (or to a
+    # pNext chain that may hold one) are copied further, so everything else keeps pointing at the application's data.
+    # Below the first level, prefix always names a struct that already lives in the arena and may be written in place.
     def uniquify_members(self, members, indent, prefix, array_index, create_func, destroy_func, destroy_array, first_level_param):
         decls = ''
         pre_code = ''
@@ -683,64 +654,58 @@ class UniqueObjectsOutputGenerator(OutputGenerator):
                     post_code += tmp_post
             # Handle Structs that contain NDOs at some level
             elif member.type in self.struct_member_dict:
-                # Structs at first level will have an NDO, OR, we need a safe_struct for the pnext chain
+                # Structs at first level will have an NDO, OR, we need a copy for the pnext chain
                 if self.struct_contains_ndo(member.type) == True or process_pnext:
                     struct_info = self.struct_member_dict[member.type]
-                    # Struct Array
-                    if member.len is not None:
-                        # Update struct prefix
-                        if first_level_param == True:
-                            new_prefix = 'local_%s' % member.name
-                            # Declare safe_VarType for struct
-                            decls += '%ssafe_%s *%s = NULL;\n' % (indent, member.type, new_prefix)
-                        else:
-                            new_prefix = '%s%s' % (prefix, member.name)
-                        pre_code += '%s    if (%s%s) {\n' % (indent, prefix, member.name)
-                        indent = self.incIndent(indent)
-                        if first_level_param == True:
-                            pre_code += '%s    %s = new safe_%s[%s];\n' % (indent, new_prefix, member.type, member.len)
-                        pre_code += '%s    for (uint32_t %s = 0; %s < %s%s; ++%s) {\n' % (indent, index, index, prefix, member.len, index)
-                        indent = self.incIndent(indent)
-                        if first_level_param == True:
-                            pre_code += '%s    %s[%s].initialize(&%s[%s]);\n' % (indent, new_prefix, index, member.name, index)
-                            if process_pnext:
-                                pre_code += '%s    %s[%s].pNext = CreateUnwrappedExtensionStructs(dev_data, %s[%s].pNext);\n' % (indent, new_prefix, index, new_prefix, index)
-                        local_prefix = '%s[%s].' % (new_prefix, index)
-                        # Process sub-structs in this struct
-                        (tmp_decl, tmp_pre, tmp_post) = self.uniquify_members(struct_info, indent, local_prefix, array_index, create_func, destroy_func, destroy_array, False)
-                        decls += tmp_decl
-                        pre_code += tmp_pre
-                        post_code += tmp_post
-                        indent = self.decIndent(indent)
-                        pre_code += '%s    }\n' % indent
-                        indent = self.decIndent(indent)
-                        pre_code += '%s    }\n' % indent
-                        if first_level_param == True:
-                            post_code += self.cleanUpLocalDeclarations(indent, prefix, member.name, member.len, index, process_pnext)
-                    # Single Struct
+                    if first_level_param == True:
+                        copy_name = 'local_%s' % member.name
+                        decls += '%s%s *%s = NULL;\n' % (indent, member.type, copy_name)
                     else:
-                        # Update struct prefix
-                        if first_level_param == True:
-                            new_prefix = 'local_%s->' % member.name
-                            decls += '%ssafe_%s *local_%s%s = NULL;\n' % (indent, member.type, prefix, member.name)
-                        else:
-                            new_prefix = '%s%s->' % (prefix, member.name)
-                        # Declare safe_VarType for struct
-                        pre_code += '%s    if (%s%s) {\n' % (indent, prefix, member.name)
-                        indent = self.incIndent(indent)
-                        if first_level_param == True:
-                            pre_code += '%s    local_%s%s = new safe_%s(%s);\n' % (indent, prefix, member.name, member.type, member.name)
-                        # Process sub-structs in this struct
-                        (tmp_decl, tmp_pre, tmp_post) = self.uniquify_members(struct_info, indent, new_prefix, array_index, create_func, destroy_func, destroy_array, False)
+                        copy_name = 'local_%s_%s' % (member.name, index)
+                    # Embedded struct: it was copied along with its parent, so just descend into it
+                    if first_level_param == False and member.ispointer == False:
+                        (tmp_decl, tmp_pre, tmp_post) = self.uniquify_members(struct_info, indent, '%s%s.' % (prefix, member.name), array_index, create_func, destroy_func, destroy_array, False)
                         decls += tmp_decl
                         pre_code += tmp_pre
                         post_code += tmp_post
                         if process_pnext:
-                            pre_code += '%s    local_%s%s->pNext = CreateUnwrappedExtensionStructs(dev_data, local_%s%s->pNext);\n' % (indent, prefix, member.name, prefix, member.name)
+                            pre_code += '%s    %s%s.pNext = CreateUnwrappedExtensionStructs(&scratch, %s%s.pNext);\n' % (indent, prefix, member.name, prefix, member.name)
+                        continue
+                    count = '1'
+                    if member.len is not None:
+                        count = member.len if first_level_param == True else '%s%s' % (prefix, member.len)
+                    pre_code += '%s    if (%s%s) {\n' % (indent, prefix, member.name)
+                    indent = self.incIndent(indent)
+                    if first_level_param == True:
+                        pre_code += '%s    %s = scratch.Copy(%s, %s);\n' % (indent, copy_name, member.name, count)
+                    else:
+                        pre_code += '%s    %s *%s = scratch.Copy(%s%s, %s);\n' % (indent, member.type, copy_name, prefix, member.name, count)
+                    pre_code += '%s    if (!%s) %s\n' % (indent, copy_name, self.scratch_fail_code)
+                    # Struct Array
+                    if member.len is not None:
+                        pre_code += '%s    for (uint32_t %s = 0; %s < %s; ++%s) {\n' % (indent, index, index, count, index)
+                        indent = self.incIndent(indent)
+                        local_prefix = '%s[%s].' % (copy_name, index)
+                        struct_ref = '%s[%s]' % (copy_name, index)
+                    # Single Struct
+                    else:
+                        local_prefix = '%s->' % copy_name
+                        struct_ref = '*%s' % copy_name
+                    pre_code += self.structCopyFixup(indent, member.type, struct_ref)
+                    if process_pnext:
+                        pre_code += '%s    %spNext = CreateUnwrappedExtensionStructs(&scratch, %spNext);\n' % (indent, local_prefix, local_prefix)
+                    # Process sub-structs in this struct
+                    (tmp_decl, tmp_pre, tmp_post) = self.uniquify_members(struct_info, indent, local_prefix, array_index, create_func, destroy_func, destroy_array, False)
+                    decls += tmp_decl
+                    pre_code += tmp_pre
+                    post_code += tmp_post
+                    if member.len is not None:
                         indent = self.decIndent(indent)
                         pre_code += '%s    }\n' % indent
-                        if first_level_param == True:
-                            post_code += self.cleanUpLocalDeclarations(indent, prefix, member.name, member.len, index, process_pnext)
+                    if first_level_param == False:
+                        pre_code += '%s    %s%s = %s;\n' % (indent, prefix, member.name, copy_name)
+                    indent = self.decIndent(indent)
+                    pre_code += '%s    }\n' % indent
         return decls, pre_code, post_code
     #
     # For a particular API, generate the non-dispatchable-object wrapping/unwrapping code
@@ -769,6 +734,12 @@ class UniqueObjectsOutputGenerator(OutputGenerator):
             create_func = True if create_ndo_code else False
             destroy_func = True if destroy_ndo_code else False
             (paramdecl, param_pre_code, param_post_code) = self.uniquify_members(cmd_info, indent, '', 0, create_func, destroy_func, destroy_array, True)
+            # Unwrapped copies live in a per-call arena that is released when the wrapper returns
+            if 'scratch' in param_pre_code:
+                paramdecl = '%sScratchArena scratch;\n' % indent + paramdecl
+            # Extension structs are copied by a helper that stops at the first failure, so check the whole arena afterwards
+            if 'CreateUnwrappedExtensionStructs' in param_pre_code:
+                param_pre_code += '%s    if (scratch.OutOfMemory()) %s\n' % (indent, self.scratch_fail_code)
             param_post_code += create_ndo_code
             if destroy_ndo_code:
                 if destroy_array == True:
@@ -777,7 +748,7 @@ class UniqueObjectsOutputGenerator(OutputGenerator):
                     param_pre_code += destroy_ndo_code
             if param_pre_code:
                 if (not destroy_func) or (destroy_array):
-                    param_pre_code = '%s{\n%s%s%s%s}\n' % ('    ', indent, self.lock_guard(indent), param_pre_code, indent)
+                    param_pre_code = '%s{\n%s%s}\n' % ('    ', param_pre_code, indent)
         return paramdecl, param_pre_code, param_post_code
     #
     # Capture command parameter info needed to wrap NDOs as well as handling some boilerplate code
@@ -853,6 +824,16 @@ class UniqueObjectsOutputGenerator(OutputGenerator):
                 self.appendSection('command', decls[0])
                 self.intercepts += [ '    {"%s", reinterpret_cast<PFN_vkVoidFunction>(%s)},' % (cmdname,cmdname[2:]) ]
                 continue
+            # Handle return values, if any
+            resulttype = cmdinfo.elem.find('proto/type')
+            if (resulttype != None and resulttype.text == 'void'):
+              resulttype = None
+            if (resulttype != None):
+                assignresult = resulttype.text + ' result = '
+            else:
+                assignresult = ''
+            # If the unwrapped copies can't be allocated, the call can't be passed down; void calls are dropped
+            self.scratch_fail_code = 'return VK_ERROR_OUT_OF_HOST_MEMORY;' if resulttype != None else 'return;'
             # Generate NDO wrapping/unwrapping code for all parameters
             (api_decls, api_pre, api_post) = self.generate_wrapping_code(cmdinfo.elem)
             # If API doesn't contain an NDO's, don't fool with it
@@ -869,19 +850,12 @@ class UniqueObjectsOutputGenerator(OutputGenerator):
             self.appendSection('command', '')
             self.appendSection('command', decls[0][:-1])
             self.appendSection('command', '{')
+            self.appendSection('command', '    LAYER_STATS_CALL("%s");' % cmdname)
             # Setup common to call wrappers, first parameter is always dispatchable
             dispatchable_type = cmdinfo.elem.find('param/type').text
             dispatchable_name = cmdinfo.elem.find('param/name').text
             # Generate local instance/pdev/device data lookup
             self.appendSection('command', '    layer_data *dev_data = GetLayerDataPtr(get_dispatch_key('+dispatchable_name+'), layer_data_map);')
-            # Handle return values, if any
-            resulttype = cmdinfo.elem.find('proto/type')
-            if (resulttype != None and resulttype.text == 'void'):
-              resulttype = None
-            if (resulttype != None):
-                assignresult = resulttype.text + ' result = '
-            else:
-                assignresult = ''
             # Pre-pend declarations and pre-api-call codegen
             if api_decls:
                 self.appendSection('command', "\n".join(str(api_decls).rstrip().split("\n")))
@@ -906,7 +880,9 @@ class UniqueObjectsOutputGenerator(OutputGenerator):
             else:
                 API = cmdinfo.elem.attrib.get('name').replace('vk','dev_data->device_dispatch_table->',1)
             # Put all this together for the final down-chain call
+            self.appendSection('command', '    layer_stats_call.Pause();')
             self.appendSection('command', '    ' + assignresult + API + '(' + paramstext + ');')
+            self.appendSection('command', '    layer_stats_call.Resume();')
             # And add the post-API-call codegen
             self.appendSection('command', "\n".join(str(api_post).rstrip().split("\n")))
             # Handle the return result variable, if any
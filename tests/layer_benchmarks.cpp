@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Micro-benchmarks for the data structures the validation layers touch on every call. They exercise the layer headers
+// directly, so no Vulkan driver is needed. Build a release configuration before comparing numbers.
+//
+// Usage: vk_layer_benchmarks [iterations]
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "vk_format_utils.h"
+#include "vk_layer_data.h"
+#include "unique_objects.h"
+#include "threading.h"
+
+namespace {
+
+uint32_t iterations = 10000000;
+
+// Keeps the optimizer from discarding a benchmark's result
+volatile uintptr_t sink;
+
+// Runs body(thread_index) on thread_count threads at once and returns the mean nanoseconds per iteration per thread
+template <typename BODY>
+double TimeThreads(uint32_t thread_count, BODY body) {
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 1; i < thread_count; i++) {
+        threads.emplace_back(body, i);
+    }
+    body(0);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / iterations;
+}
+
+void Report(const char *name, uint32_t thread_count, double ns) {
+    printf("%-48s %2u threads %8.2f ns/call\n", name, thread_count, ns);
+}
+
+// Dispatch key -> layer_data lookup, which every intercepted call makes. Keys are the addresses of dispatch tables, so
+// they are allocated the same way here. Compared against the unlocked std::unordered_map the layers used to call
+// GetLayerDataPtr with, and against the same map behind a mutex, which is what making it thread-safe would cost.
+struct bench_layer_data {
+    uint64_t payload;
+};
+
+void BenchLayerDataMap() {
+    // key_count must be a power of two
+    for (uint32_t key_count : {1u, 4u}) {
+        std::vector<std::unique_ptr<VkLayerDispatchTable>> tables;
+        LayerDataMap<bench_layer_data> map;
+        std::unordered_map<void *, bench_layer_data *> old_map;
+        std::mutex old_map_lock;
+        for (uint32_t i = 0; i < key_count; i++) {
+            tables.emplace_back(new VkLayerDispatchTable());
+            bench_layer_data *data = GetLayerDataPtr(tables.back().get(), map);
+            old_map[tables.back().get()] = data;
+        }
+
+        for (uint32_t thread_count : {1u, 4u}) {
+            char name[64];
+            snprintf(name, sizeof(name), "GetLayerDataPtr LayerDataMap, %u keys", key_count);
+            Report(name, thread_count, TimeThreads(thread_count, [&](uint32_t t) {
+                       uintptr_t sum = 0;
+                       for (uint32_t i = 0; i < iterations; i++) {
+                           sum += (uintptr_t)GetLayerDataPtr(tables[(i + t) & (key_count - 1)].get(), map);
+                       }
+                       sink = sum;
+                   }));
+            if (thread_count == 1) {
+                snprintf(name, sizeof(name), "GetLayerDataPtr unordered_map, %u keys", key_count);
+                Report(name, thread_count, TimeThreads(thread_count, [&](uint32_t t) {
+                           uintptr_t sum = 0;
+                           for (uint32_t i = 0; i < iterations; i++) {
+                               sum += (uintptr_t)GetLayerDataPtr(tables[(i + t) & (key_count - 1)].get(), old_map);
+                           }
+                           sink = sum;
+                       }));
+            }
+            snprintf(name, sizeof(name), "unordered_map + mutex, %u keys", key_count);
+            Report(name, thread_count, TimeThreads(thread_count, [&](uint32_t t) {
+                       uintptr_t sum = 0;
+                       for (uint32_t i = 0; i < iterations; i++) {
+                           std::lock_guard<std::mutex> lock(old_map_lock);
+                           sum += (uintptr_t)old_map.find(tables[(i + t) & (key_count - 1)].get())->second;
+                       }
+                       sink = sum;
+                   }));
+        }
+        for (auto &entry : old_map) {
+            delete entry.second;
+        }
+    }
+}
+
+// unique_objects handle translation as command buffer recording does it: every thread unwraps the handles of its
+// commands at once. Compared against the per-device std::unordered_map behind the layer's global mutex that it replaced.
+void BenchUniqueObjectsUnwrap() {
+    const uint32_t handle_count = 1024;
+    const uint32_t owner_id = unique_objects::next_owner_id++;
+    std::vector<VkBuffer> wrapped(handle_count);
+    std::unordered_map<uint64_t, uint64_t> old_map;
+    std::mutex old_map_lock;
+    for (uint32_t i = 0; i < handle_count; i++) {
+        VkBuffer handle = reinterpret_cast<VkBuffer>(uintptr_t(0x10000 + 16 * i));
+        uint64_t unique_id = unique_objects::unique_id_table.Insert(reinterpret_cast<uint64_t &>(handle), owner_id);
+        wrapped[i] = reinterpret_cast<VkBuffer &>(unique_id);
+        old_map[reinterpret_cast<uint64_t &>(wrapped[i])] = reinterpret_cast<uint64_t &>(handle);
+    }
+
+    for (uint32_t thread_count : {1u, 4u, 16u}) {
+        Report("unique_objects Unwrap", thread_count, TimeThreads(thread_count, [&](uint32_t t) {
+                   uintptr_t sum = 0;
+                   for (uint32_t i = 0; i < iterations; i++) {
+                       sum += (uintptr_t)unique_objects::Unwrap(wrapped[(i * 7 + t) & (handle_count - 1)]);
+                   }
+                   sink = sum;
+               }));
+        Report("unordered_map + mutex", thread_count, TimeThreads(thread_count, [&](uint32_t t) {
+                   uintptr_t sum = 0;
+                   for (uint32_t i = 0; i < iterations; i++) {
+                       std::lock_guard<std::mutex> lock(old_map_lock);
+                       sum += (uintptr_t)old_map[reinterpret_cast<uint64_t &>(wrapped[(i * 7 + t) & (handle_count - 1)])];
+                   }
+                   sink = sum;
+               }));
+    }
+    unique_objects::unique_id_table.RemoveOwner(owner_id);
+}
+
+// threading's per-object use tracking as command buffer recording does it: every thread starts and finishes writes to
+// its own command buffer, so no use ever conflicts. Each run splits the same total work across 1-32 threads and reports
+// wall time per start/finish pair over all of them; ideal scaling keeps it flat on one core and dividing with more
+// cores. Compared against the single mutex-guarded map, with a notify_all per finish, that counter<T> replaced.
+struct locked_use_counter {
+    std::unordered_map<VkCommandBuffer, object_use_data> uses;
+    std::mutex counter_lock;
+    std::condition_variable counter_condition;
+
+    void startWrite(VkCommandBuffer object) {
+        std::unique_lock<std::mutex> lock(counter_lock);
+        object_use_data *use_data = &uses[object];
+        use_data->thread = loader_platform_get_thread_id();
+        use_data->writer_count += 1;
+    }
+
+    void finishWrite(VkCommandBuffer object) {
+        std::unique_lock<std::mutex> lock(counter_lock);
+        if (--uses[object].writer_count == 0) uses.erase(object);
+        lock.unlock();
+        counter_condition.notify_all();
+    }
+};
+
+void BenchThreadingCounter() {
+    const uint32_t max_threads = 32;
+    std::vector<std::unique_ptr<VkLayerDispatchTable>> command_buffers;
+    for (uint32_t i = 0; i < max_threads; i++) {
+        command_buffers.emplace_back(new VkLayerDispatchTable());
+    }
+    counter<VkCommandBuffer> striped_counter("VkCommandBuffer", VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT);
+    locked_use_counter locked_counter;
+
+    for (uint32_t thread_count : {1u, 2u, 4u, 8u, 16u, 32u}) {
+        const uint32_t thread_iterations = iterations / thread_count;
+        Report("threading counter<T> start/finishWrite", thread_count, TimeThreads(thread_count, [&](uint32_t t) {
+                   VkCommandBuffer command_buffer = reinterpret_cast<VkCommandBuffer>(command_buffers[t].get());
+                   for (uint32_t i = 0; i < thread_iterations; i++) {
+                       striped_counter.startWrite(nullptr, command_buffer);
+                       striped_counter.finishWrite(command_buffer);
+                   }
+               }));
+        Report("mutex + unordered_map start/finishWrite", thread_count, TimeThreads(thread_count, [&](uint32_t t) {
+                   VkCommandBuffer command_buffer = reinterpret_cast<VkCommandBuffer>(command_buffers[t].get());
+                   for (uint32_t i = 0; i < thread_iterations; i++) {
+                       locked_counter.startWrite(command_buffer);
+                       locked_counter.finishWrite(command_buffer);
+                   }
+               }));
+    }
+}
+
+// Format property lookups as copy and clear validation makes them, once or more per region, over a mix of core and
+// extension formats. Compared against the std::map keyed by VkFormat that vk_format_utils used to search.
+struct bench_format_info {
+    size_t size;
+    uint32_t channel_count;
+    VkFormatCompatibilityClass format_class;
+};
+
+void BenchFormatLookup() {
+    std::vector<VkFormat> all_formats;
+    for (uint32_t i = VK_FORMAT_BEGIN_RANGE; i <= VK_FORMAT_END_RANGE; i++) {
+        all_formats.push_back(static_cast<VkFormat>(i));
+    }
+    for (uint32_t i = VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG; i <= VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG; i++) {
+        all_formats.push_back(static_cast<VkFormat>(i));
+    }
+    std::map<VkFormat, bench_format_info> old_table;
+    for (VkFormat format : all_formats) {
+        old_table[format] = {FormatSize(format), FormatChannelCount(format), FormatCompatibilityClass(format)};
+    }
+
+    // A fixed pseudo-random walk over the formats, so neither lookup benefits from a repeating pattern
+    const uint32_t format_count = 256;
+    std::vector<VkFormat> formats(format_count);
+    uint32_t seed = 1;
+    for (auto &format : formats) {
+        seed = seed * 1103515245 + 12345;
+        format = all_formats[(seed >> 8) % all_formats.size()];
+    }
+
+    Report("FormatSize/ChannelCount/CompatibilityClass", 1, TimeThreads(1, [&](uint32_t) {
+               uintptr_t sum = 0;
+               for (uint32_t i = 0; i < iterations; i++) {
+                   VkFormat format = formats[i & (format_count - 1)];
+                   sum += FormatSize(format) + FormatChannelCount(format) + FormatCompatibilityClass(format);
+               }
+               sink = sum;
+           }));
+    Report("std::map lookups", 1, TimeThreads(1, [&](uint32_t) {
+               uintptr_t sum = 0;
+               for (uint32_t i = 0; i < iterations; i++) {
+                   VkFormat format = formats[i & (format_count - 1)];
+                   sum += old_table.find(format)->second.size + old_table.find(format)->second.channel_count +
+                          old_table.find(format)->second.format_class;
+               }
+               sink = sum;
+           }));
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    if (argc > 1) {
+        iterations = (uint32_t)strtoul(argv[1], nullptr, 10);
+        if (iterations == 0) {
+            fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    BenchLayerDataMap();
+    BenchUniqueObjectsUnwrap();
+    BenchThreadingCounter();
+    BenchFormatLookup();
+    return 0;
+}
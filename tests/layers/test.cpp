@@ -31,13 +31,14 @@ namespace test
 struct layer_data {
     VkInstance instance;
     VkLayerInstanceDispatchTable *instance_dispatch_table;
+    VkLayerDispatchTable *device_dispatch_table;
 
-    layer_data() : instance(VK_NULL_HANDLE), instance_dispatch_table(nullptr) {};
+    layer_data() : instance(VK_NULL_HANDLE), instance_dispatch_table(nullptr), device_dispatch_table(nullptr) {};
 };
 
 static uint32_t loader_layer_if_version = CURRENT_LOADER_LAYER_INTERFACE_VERSION;
 
-static std::unordered_map<void *, layer_data *> layer_data_map;
+static LayerDataMap<layer_data> layer_data_map;
 
 VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator,
 		VkInstance* pInstance)
@@ -85,6 +86,95 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
     std::cout << "VK_LAYER_LUNARG_test: DestroyInstance" << '\n';
 }
 
+VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo *pCreateInfo,
+        const VkAllocationCallbacks *pAllocator, VkDevice *pDevice)
+{
+    VkLayerDeviceCreateInfo *chain_info = get_chain_info(pCreateInfo, VK_LAYER_LINK_INFO);
+    assert(chain_info != nullptr);
+
+    assert(chain_info->u.pLayerInfo != nullptr);
+    PFN_vkGetInstanceProcAddr fpGetInstanceProcAddr = chain_info->u.pLayerInfo->pfnNextGetInstanceProcAddr;
+    PFN_vkGetDeviceProcAddr fpGetDeviceProcAddr = chain_info->u.pLayerInfo->pfnNextGetDeviceProcAddr;
+    PFN_vkCreateDevice fpCreateDevice = (PFN_vkCreateDevice) fpGetInstanceProcAddr(NULL, "vkCreateDevice");
+    if (fpCreateDevice == nullptr)
+    {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    chain_info->u.pLayerInfo = chain_info->u.pLayerInfo->pNext;
+    VkResult result = fpCreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    layer_data *device_data = GetLayerDataPtr(get_dispatch_key(*pDevice), layer_data_map);
+    device_data->device_dispatch_table = new VkLayerDispatchTable;
+    layer_init_device_dispatch_table(*pDevice, device_data->device_dispatch_table, fpGetDeviceProcAddr);
+
+    return result;
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator)
+{
+    dispatch_key key = get_dispatch_key(device);
+    layer_data *device_data = GetLayerDataPtr(key, layer_data_map);
+    device_data->device_dispatch_table->DestroyDevice(device, pAllocator);
+
+    delete device_data->device_dispatch_table;
+    layer_data_map.erase(key);
+}
+
+// The two commands below only pass calls down the chain.  The loader's tests check which of them it routes through
+// VK_LAYER_LUNARG_test_intercepted, whose manifest lists vkCmdDraw in intercepted_functions but not vkCmdDispatch.
+VKAPI_ATTR void VKAPI_CALL CmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
+        uint32_t firstVertex, uint32_t firstInstance)
+{
+    layer_data *device_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    device_data->device_dispatch_table->CmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
+        uint32_t groupCountZ)
+{
+    layer_data *device_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    device_data->device_dispatch_table->CmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, const char* funcName)
+{
+    // Return the functions that are intercepted by this layer.
+    static const struct
+    {
+        const char *name;
+        PFN_vkVoidFunction proc;
+    } core_device_commands[] =
+    {
+        { "vkGetDeviceProcAddr", reinterpret_cast<PFN_vkVoidFunction>(GetDeviceProcAddr) },
+        { "vkDestroyDevice", reinterpret_cast<PFN_vkVoidFunction>(DestroyDevice) },
+        { "vkCmdDraw", reinterpret_cast<PFN_vkVoidFunction>(CmdDraw) },
+        { "vkCmdDispatch", reinterpret_cast<PFN_vkVoidFunction>(CmdDispatch) }
+    };
+
+    for (size_t i = 0; i < ARRAY_SIZE(core_device_commands); i++)
+    {
+        if (!strcmp(core_device_commands[i].name, funcName))
+        {
+            return core_device_commands[i].proc;
+        }
+    }
+
+    // Only call down the chain for Vulkan commands that this layer does not intercept.
+    layer_data *device_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    VkLayerDispatchTable *pTable = device_data->device_dispatch_table;
+    if (pTable->GetDeviceProcAddr == nullptr)
+    {
+        return nullptr;
+    }
+
+    return pTable->GetDeviceProcAddr(device, funcName);
+}
+
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance, const char* funcName)
 {
     // Return the functions that are intercepted by this layer.
@@ -96,7 +186,8 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance
     {
         { "vkGetInstanceProcAddr", reinterpret_cast<PFN_vkVoidFunction>(GetInstanceProcAddr) },
         { "vkCreateInstance", reinterpret_cast<PFN_vkVoidFunction>(CreateInstance) },
-        { "vkDestroyInstance", reinterpret_cast<PFN_vkVoidFunction>(DestroyInstance) }
+        { "vkDestroyInstance", reinterpret_cast<PFN_vkVoidFunction>(DestroyInstance) },
+        { "vkCreateDevice", reinterpret_cast<PFN_vkVoidFunction>(CreateDevice) }
     };
 
     for (size_t i = 0; i < ARRAY_SIZE(core_instance_commands); i++)
@@ -140,7 +231,7 @@ VK_LAYER_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(V
 
 VK_LAYER_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(VkDevice device, const char *funcName)
 {
-    return nullptr;
+    return test::GetDeviceProcAddr(device, funcName);
 }
 
 VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceExtensionProperties(const char *pLayerName, uint32_t *pCount, VkExtensionProperties *pProperties)
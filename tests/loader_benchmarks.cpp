@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Benchmarks for the loader paths applications go through at startup. They call the loader this binary is linked
+// against; build a release configuration before comparing numbers.
+//
+// Usage: vk_loader_benchmarks [iterations]
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <dlfcn.h>
+#include <ftw.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <vulkan/vulkan.h>
+#include "vk_loader_dispatch.h"
+
+namespace {
+
+uint32_t iterations = 100;
+
+void Report(const char *name, double value, const char *unit = "us") { printf("%-64s %10.2f %s/call\n", name, value, unit); }
+
+#if !defined(_WIN32)
+// Layer manifest enumeration, as every vkCreateInstance and vkEnumerateInstanceLayerProperties does it, over a directory
+// of manifest_count layer manifests. Cold runs are the first enumeration in a new process, which reads and parses every
+// manifest, either directly or, with VK_LOADER_MANIFEST_CACHE set, through the on-disk index. The manifests stay in the
+// page cache either way. Warm runs repeat the enumeration in one process, where the in-memory cache only stats the
+// directory and the manifests.
+const uint32_t manifest_count = 128;
+
+// Sets an environment variable and puts back its previous value, or unsets it, when destroyed
+struct ScopedEnvironment {
+    ScopedEnvironment(char const *name, char const *value) : name(name), was_set(getenv(name) != nullptr) {
+        if (was_set) previous = getenv(name);
+        setenv(name, value, 1);
+    }
+    ~ScopedEnvironment() {
+        if (was_set) {
+            setenv(name, previous.c_str(), 1);
+        } else {
+            unsetenv(name);
+        }
+    }
+
+    char const *name;
+    bool was_set;
+    std::string previous;
+};
+
+double TimeLayerEnumeration(uint32_t repeat) {
+    uint32_t count = 0;
+    std::vector<VkLayerProperties> properties(manifest_count * 2);
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < repeat; i++) {
+        count = (uint32_t)properties.size();
+        vkEnumerateInstanceLayerProperties(&count, properties.data());
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    if (count < manifest_count) {
+        fprintf(stderr, "Only %u of %u layers were enumerated\n", count, manifest_count);
+    }
+    return elapsed.count() / repeat;
+}
+
+// Time the first enumeration in each of iterations child processes. The parent must not have used the loader yet, so
+// each child starts with none of its state.
+double TimeColdLayerEnumeration(bool use_index) {
+    double total = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        int fds[2];
+        if (pipe(fds) != 0) return 0;
+        pid_t pid = fork();
+        if (pid == 0) {
+            if (use_index) setenv("VK_LOADER_MANIFEST_CACHE", "1", 1);
+            double us = TimeLayerEnumeration(1);
+            ssize_t written = write(fds[1], &us, sizeof(us));
+            _exit(written == sizeof(us) ? 0 : 1);
+        }
+        close(fds[1]);
+        double us = 0;
+        if (pid < 0 || read(fds[0], &us, sizeof(us)) != sizeof(us)) {
+            fprintf(stderr, "Cold enumeration child failed\n");
+        }
+        close(fds[0]);
+        if (pid > 0) waitpid(pid, nullptr, 0);
+        total += us;
+    }
+    return total / iterations;
+}
+
+void BenchLayerEnumeration() {
+    char dir[] = "/tmp/vk_loader_benchmark_XXXXXX";
+    if (mkdtemp(dir) == nullptr) return;
+    std::string const layer_dir = std::string(dir) + "/layers";
+    mkdir(layer_dir.c_str(), 0700);
+
+    // Timestamps from the last second aren't cached, so the manifests are given older ones
+    struct timeval times[2] = {{time(nullptr) - 100, 0}, {time(nullptr) - 100, 0}};
+    for (uint32_t i = 0; i < manifest_count; i++) {
+        std::string const path = layer_dir + "/VkLayer_benchmark_" + std::to_string(i) + ".json";
+        FILE *file = fopen(path.c_str(), "w");
+        if (file == nullptr) continue;
+        fprintf(file,
+                "{\n"
+                "    \"file_format_version\" : \"1.0.0\",\n"
+                "    \"layer\" : {\n"
+                "        \"name\": \"VK_LAYER_LUNARG_benchmark_%u\",\n"
+                "        \"type\": \"GLOBAL\",\n"
+                "        \"library_path\": \"./libVkLayer_benchmark_%u.so\",\n"
+                "        \"api_version\": \"1.0.61\",\n"
+                "        \"implementation_version\": \"1\",\n"
+                "        \"description\": \"LunarG benchmark layer %u\",\n"
+                "        \"instance_extensions\": [\n"
+                "             {\n"
+                "                 \"name\": \"VK_EXT_debug_report\",\n"
+                "                 \"spec_version\": \"6\"\n"
+                "             }\n"
+                "         ],\n"
+                "        \"device_extensions\": [\n"
+                "             {\n"
+                "                 \"name\": \"VK_EXT_debug_marker\",\n"
+                "                 \"spec_version\": \"4\",\n"
+                "                 \"entrypoints\": [\"vkDebugMarkerSetObjectTagEXT\",\n"
+                "                        \"vkDebugMarkerSetObjectNameEXT\",\n"
+                "                        \"vkCmdDebugMarkerBeginEXT\",\n"
+                "                        \"vkCmdDebugMarkerEndEXT\",\n"
+                "                        \"vkCmdDebugMarkerInsertEXT\"\n"
+                "                       ]\n"
+                "             }\n"
+                "         ]\n"
+                "    }\n"
+                "}\n",
+                i, i, i);
+        fclose(file);
+        utimes(path.c_str(), times);
+    }
+    utimes(layer_dir.c_str(), times);
+
+    {
+        ScopedEnvironment const layer_path("VK_LAYER_PATH", layer_dir.c_str());
+        ScopedEnvironment const cache_home("XDG_CACHE_HOME", dir);
+        std::string const name = std::to_string(manifest_count) + " layer manifests";
+        Report(("Enumerate " + name + ", cold").c_str(), TimeColdLayerEnumeration(false));
+        Report(("Enumerate " + name + ", cold with on-disk index").c_str(), TimeColdLayerEnumeration(true));
+        TimeLayerEnumeration(1);
+        Report(("Enumerate " + name + ", warm").c_str(), TimeLayerEnumeration(iterations));
+    }
+
+    nftw(dir, [](const char *file, const struct stat *, int, struct FTW *) { return remove(file); }, 16, FTW_DEPTH | FTW_PHYS);
+}
+#endif
+
+#if !defined(_WIN32) && defined(VK_TEST_LOADER_BINARY_DIR)
+// Resolution of every command name the loader dispatches, read from the generated tables in vk_loader_extensions.c,
+// through the loader's vkGetInstanceProcAddr and vkGetDeviceProcAddr and through the entry points of the layers with
+// generated procmap tables. Each result is the time to resolve the whole list once. Needs an ICD, and VK_LAYER_PATH
+// pointing at the layers for the layer results.
+std::vector<std::string> ReadDispatchNames(char const *declaration) {
+    std::vector<std::string> names;
+    FILE *file = fopen(VK_TEST_LOADER_BINARY_DIR "/vk_loader_extensions.c", "r");
+    if (file == nullptr) return names;
+    char line[512];
+    bool in_table = false;
+    while (fgets(line, sizeof(line), file) != nullptr) {
+        if (!in_table) {
+            in_table = strstr(line, declaration) != nullptr;
+        } else if (strncmp(line, "};", 2) == 0) {
+            break;
+        } else if (char const *begin = strstr(line, "{\"")) {
+            char const *end = strchr(begin + 2, '"');
+            if (end != nullptr) names.push_back("vk" + std::string(begin + 2, end));
+        }
+    }
+    fclose(file);
+    return names;
+}
+
+template <typename Handle, typename GetProcAddr>
+double TimeResolution(GetProcAddr get_proc_addr, Handle handle, std::vector<std::string> const &names) {
+    uintptr_t found = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        for (auto const &name : names) {
+            found += (uintptr_t)get_proc_addr(handle, name.c_str()) != 0;
+        }
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    if (found == 0) fprintf(stderr, "No names were resolved\n");
+    return elapsed.count() / iterations;
+}
+
+// The layers with generated procmap tables, by layer name and library name
+struct ProcmapLayer {
+    char const *name;
+    char const *library;
+} const procmap_layers[] = {
+    {"VK_LAYER_GOOGLE_threading", "threading"},
+    {"VK_LAYER_GOOGLE_unique_objects", "unique_objects"},
+    {"VK_LAYER_LUNARG_parameter_validation", "parameter_validation"},
+};
+
+void BenchProcAddrResolution(bool through_layers) {
+    std::vector<std::string> const device_names = ReadDispatchNames("loader_device_dispatch_names[] = {");
+    std::vector<std::string> instance_names = ReadDispatchNames("loader_instance_dispatch_names[] = {");
+    if (device_names.empty() || instance_names.empty()) {
+        fprintf(stderr, "Skipping name resolution: can't read the tables in %s\n", VK_TEST_LOADER_BINARY_DIR);
+        return;
+    }
+    instance_names.insert(instance_names.end(), device_names.begin(), device_names.end());
+
+    std::vector<char const *> layers;
+    if (through_layers) {
+        for (auto const &layer : procmap_layers) layers.push_back(layer.name);
+    }
+    VkInstanceCreateInfo instance_info = {VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO};
+    instance_info.enabledLayerCount = (uint32_t)layers.size();
+    instance_info.ppEnabledLayerNames = layers.data();
+    VkInstance instance;
+    if (vkCreateInstance(&instance_info, nullptr, &instance) != VK_SUCCESS) {
+        fprintf(stderr, "Skipping name resolution%s: vkCreateInstance failed\n", through_layers ? " through layers" : "");
+        return;
+    }
+    uint32_t count = 1;
+    VkPhysicalDevice physical_device;
+    vkEnumeratePhysicalDevices(instance, &count, &physical_device);
+    float const priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_info = {VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO};
+    queue_info.queueCount = 1;
+    queue_info.pQueuePriorities = &priority;
+    VkDeviceCreateInfo device_info = {VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO};
+    device_info.queueCreateInfoCount = 1;
+    device_info.pQueueCreateInfos = &queue_info;
+    VkDevice device;
+    if (count == 0 || vkCreateDevice(physical_device, &device_info, nullptr, &device) != VK_SUCCESS) {
+        fprintf(stderr, "Skipping name resolution: vkCreateDevice failed\n");
+        vkDestroyInstance(instance, nullptr);
+        return;
+    }
+
+    char name[128];
+    if (!through_layers) {
+        snprintf(name, sizeof(name), "Resolve %zu names, vkGetInstanceProcAddr", instance_names.size());
+        Report(name, TimeResolution(vkGetInstanceProcAddr, instance, instance_names));
+        snprintf(name, sizeof(name), "Resolve %zu names, vkGetDeviceProcAddr", device_names.size());
+        Report(name, TimeResolution(vkGetDeviceProcAddr, device, device_names));
+    }
+    for (uint32_t i = 0; through_layers && i < sizeof(procmap_layers) / sizeof(procmap_layers[0]); i++) {
+        // The loader has already opened the layer; its exported entry points look names up in its procmap first
+        char const *layer = procmap_layers[i].library;
+        std::string const library = "libVkLayer_" + std::string(layer) + ".so";
+        void *handle = dlopen(library.c_str(), RTLD_NOW | RTLD_NOLOAD);
+        if (handle == nullptr) {
+            fprintf(stderr, "Skipping %s: %s isn't loaded\n", procmap_layers[i].name, library.c_str());
+            continue;
+        }
+        auto get_instance_proc_addr = (PFN_vkGetInstanceProcAddr)dlsym(handle, "vkGetInstanceProcAddr");
+        auto get_device_proc_addr = (PFN_vkGetDeviceProcAddr)dlsym(handle, "vkGetDeviceProcAddr");
+        snprintf(name, sizeof(name), "Resolve %zu names, %s GetInstanceProcAddr", instance_names.size(), layer);
+        Report(name, TimeResolution(get_instance_proc_addr, instance, instance_names));
+        snprintf(name, sizeof(name), "Resolve %zu names, %s GetDeviceProcAddr", device_names.size(), layer);
+        Report(name, TimeResolution(get_device_proc_addr, device, device_names));
+        dlclose(handle);
+    }
+
+    vkDestroyDevice(device, nullptr);
+    vkDestroyInstance(instance, nullptr);
+}
+#endif
+
+// Recording draws through the exported vkCmdDraw trampoline, through the pointer vkGetDeviceProcAddr returns and through
+// the table vk_loaderGetDeviceDispatchTable copies. Meant for a stub ICD; a real driver records draw_count draws outside
+// a render pass.
+const uint32_t draw_count = 1000000;
+
+template <typename Draw>
+double TimeDraws(VkCommandBuffer command_buffer, Draw draw) {
+    VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+    vkBeginCommandBuffer(command_buffer, &begin_info);
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < draw_count; i++) {
+        draw(command_buffer, 3, 1, 0, 0);
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    vkEndCommandBuffer(command_buffer);
+    vkResetCommandBuffer(command_buffer, 0);
+    return elapsed.count() / draw_count;
+}
+
+void BenchDeviceDispatch() {
+    VkInstanceCreateInfo instance_info = {VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO};
+    VkInstance instance;
+    if (vkCreateInstance(&instance_info, nullptr, &instance) != VK_SUCCESS) {
+        fprintf(stderr, "Skipping device dispatch: vkCreateInstance failed\n");
+        return;
+    }
+    uint32_t count = 1;
+    VkPhysicalDevice physical_device;
+    vkEnumeratePhysicalDevices(instance, &count, &physical_device);
+    float const priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_info = {VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO};
+    queue_info.queueCount = 1;
+    queue_info.pQueuePriorities = &priority;
+    VkDeviceCreateInfo device_info = {VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO};
+    device_info.queueCreateInfoCount = 1;
+    device_info.pQueueCreateInfos = &queue_info;
+    VkDevice device;
+    if (count == 0 || vkCreateDevice(physical_device, &device_info, nullptr, &device) != VK_SUCCESS) {
+        fprintf(stderr, "Skipping device dispatch: vkCreateDevice failed\n");
+        vkDestroyInstance(instance, nullptr);
+        return;
+    }
+    VkCommandPoolCreateInfo pool_info = {VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO};
+    pool_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    VkCommandPool pool;
+    vkCreateCommandPool(device, &pool_info, nullptr, &pool);
+    VkCommandBufferAllocateInfo allocate_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO};
+    allocate_info.commandPool = pool;
+    allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocate_info.commandBufferCount = 1;
+    VkCommandBuffer command_buffer;
+    vkAllocateCommandBuffers(device, &allocate_info, &command_buffer);
+
+    VkLayerDispatchTable table;
+    if (vk_loaderGetDeviceDispatchTable(device, sizeof(table), &table) == VK_SUCCESS) {
+        auto const proc_addr_draw = (PFN_vkCmdDraw)vkGetDeviceProcAddr(device, "vkCmdDraw");
+        Report("1M vkCmdDraw, exported trampoline", TimeDraws(command_buffer, vkCmdDraw), "ns");
+        Report("1M vkCmdDraw, vkGetDeviceProcAddr pointer", TimeDraws(command_buffer, proc_addr_draw), "ns");
+        Report("1M vkCmdDraw, vk_loaderGetDeviceDispatchTable", TimeDraws(command_buffer, table.CmdDraw), "ns");
+    } else {
+        fprintf(stderr, "Skipping device dispatch: vk_loaderGetDeviceDispatchTable failed\n");
+    }
+
+    vkDestroyCommandPool(device, pool, nullptr);
+    vkDestroyDevice(device, nullptr);
+    vkDestroyInstance(instance, nullptr);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    if (argc > 1) {
+        iterations = (uint32_t)strtoul(argv[1], nullptr, 10);
+        if (iterations == 0) {
+            fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+            return 1;
+        }
+    }
+
+#if !defined(_WIN32)
+    // Forks children that need a loader nothing has used yet, so this runs first
+    BenchLayerEnumeration();
+#endif
+#if !defined(_WIN32) && defined(VK_TEST_LOADER_BINARY_DIR)
+    BenchProcAddrResolution(false);
+    BenchProcAddrResolution(true);
+#endif
+    BenchDeviceDispatch();
+    return 0;
+}
@@ -38,8 +38,24 @@
 #include <string>
 #include <vector>
 
+#if !defined(_WIN32)
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <ftw.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 #include "test_common.h"
 #include <vulkan/vulkan.h>
+#include <vulkan/vk_layer.h>
+#include "vk_loader_dispatch.h"
+
+extern "C" {
+#include "json_reader.h"
+}
 
 namespace VK {
 
@@ -403,6 +419,91 @@ VKAPI_ATTR void *VKAPI_CALL ReallocCallbackFunc(void *pUserData, void *pOriginal
     }
 }
 
+#if !defined(_WIN32)
+// Some loader state, such as the on-disk manifest index and VK_LOADER_DEBUG, is only read once per process. Tests of it
+// set up files in a scratch directory and run a DISABLED_ child test in a new copy of this binary.
+
+// A directory under /tmp that is removed, with everything in it, when the test ends
+struct ScratchDirectory {
+    ScratchDirectory() {
+        char name[] = "/tmp/vk_loader_test_XXXXXX";
+        if (mkdtemp(name) != nullptr) {
+            path = name;
+        }
+    }
+
+    ~ScratchDirectory() {
+        if (!path.empty()) {
+            nftw(path.c_str(), [](const char *file, const struct stat *, int, struct FTW *) { return remove(file); }, 16,
+                 FTW_DEPTH | FTW_PHYS);
+        }
+    }
+
+    // Write contents to name, a path relative to the directory, and return the full path. A nonzero mtime is set as the
+    // file's modification time.
+    std::string Write(std::string const &name, std::string const &contents, time_t mtime = 0) const {
+        std::string file_path = path + "/" + name;
+        FILE *file = fopen(file_path.c_str(), "wb");
+        if (file != nullptr) {
+            fwrite(contents.data(), 1, contents.size(), file);
+            fclose(file);
+        }
+        if (mtime != 0) {
+            SetModificationTime(file_path, mtime);
+        }
+        return file_path;
+    }
+
+    static void SetModificationTime(std::string const &file_path, time_t mtime) {
+        struct timeval times[2] = {{mtime, 0}, {mtime, 0}};
+        utimes(file_path.c_str(), times);
+    }
+
+    std::string path;
+};
+
+// Run the tests matching filter in a new copy of this binary, with each "NAME=value" in environment added to its
+// environment and its stderr sent to stderr_path if one is given. Returns 0 if every test passed.
+static int RunChildTest(char const *filter, std::vector<std::string> const &environment, char const *stderr_path = nullptr) {
+    std::string const filter_argument = std::string("--gtest_filter=") + filter;
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        for (auto const &setting : environment) {
+            putenv(const_cast<char *>(setting.c_str()));
+        }
+        if (stderr_path != nullptr) {
+            int fd = open(stderr_path, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+            if (fd >= 0) {
+                dup2(fd, STDERR_FILENO);
+            }
+        }
+        char const *self = CommandLine::arguments[0].c_str();
+        execl(self, self, filter_argument.c_str(), "--gtest_also_run_disabled_tests", (char *)nullptr);
+        _exit(127);
+    }
+    int status = 0;
+    if (pid < 0 || waitpid(pid, &status, 0) != pid) {
+        return -1;
+    }
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+#endif
+
+static std::string ReadFile(std::string const &file_path) {
+    std::string contents;
+    FILE *file = fopen(file_path.c_str(), "rb");
+    if (file != nullptr) {
+        char buffer[4096];
+        size_t count;
+        while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+            contents.append(buffer, count);
+        }
+        fclose(file);
+    }
+    return contents;
+}
+
 // Test groups:
 // LX = lunar exchange
 // LVLGH = loader and validation github
@@ -654,6 +755,62 @@ TEST(CreateDevice, LayersNotPresent) {
     vkDestroyInstance(instance, nullptr);
 }
 
+// The loader's exported device dispatch table should match what vkGetDeviceProcAddr returns, apart from the functions the
+// loader keeps for itself, and should be usable in place of the exported functions.
+TEST(GetDeviceDispatchTable, MatchesGetDeviceProcAddr) {
+    VkInstance instance = VK_NULL_HANDLE;
+    VkResult result = vkCreateInstance(VK::InstanceCreateInfo(), VK_NULL_HANDLE, &instance);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    uint32_t physicalCount = 0;
+    result = vkEnumeratePhysicalDevices(instance, &physicalCount, nullptr);
+    ASSERT_EQ(result, VK_SUCCESS);
+    ASSERT_GT(physicalCount, 0u);
+
+    std::unique_ptr<VkPhysicalDevice[]> physical(new VkPhysicalDevice[physicalCount]);
+    result = vkEnumeratePhysicalDevices(instance, &physicalCount, physical.get());
+    ASSERT_EQ(result, VK_SUCCESS);
+    ASSERT_GT(physicalCount, 0u);
+
+    uint32_t familyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(physical[0], &familyCount, nullptr);
+    ASSERT_GT(familyCount, 0u);
+
+    float const priorities[] = {0.0f};  // Temporary required due to MSVC bug.
+    VkDeviceQueueCreateInfo const queueInfo[1]{
+        VK::DeviceQueueCreateInfo().queueFamilyIndex(0).queueCount(1).pQueuePriorities(priorities)};
+
+    auto const deviceInfo = VK::DeviceCreateInfo().queueCreateInfoCount(1).pQueueCreateInfos(queueInfo);
+
+    VkDevice device;
+    result = vkCreateDevice(physical[0], deviceInfo, nullptr, &device);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    VkLayerDispatchTable table;
+    result = vk_loaderGetDeviceDispatchTable(device, sizeof(table) - 1, &table);
+    ASSERT_EQ(result, VK_ERROR_INCOMPATIBLE_DRIVER);
+
+    result = vk_loaderGetDeviceDispatchTable(device, sizeof(table), &table);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    ASSERT_EQ((void *)table.GetDeviceProcAddr, (void *)vkGetDeviceProcAddr);
+    ASSERT_EQ((void *)table.DestroyDevice, (void *)vkDestroyDevice);
+    ASSERT_EQ((void *)table.GetDeviceQueue, (void *)vkGetDeviceQueue);
+    ASSERT_EQ((void *)table.AllocateCommandBuffers, (void *)vkAllocateCommandBuffers);
+    ASSERT_EQ((void *)table.CmdDraw, (void *)vkGetDeviceProcAddr(device, "vkCmdDraw"));
+    ASSERT_EQ((void *)table.CreateCommandPool, (void *)vkGetDeviceProcAddr(device, "vkCreateCommandPool"));
+
+    VkQueue queue = VK_NULL_HANDLE;
+    table.GetDeviceQueue(device, 0, 0, &queue);
+    ASSERT_NE(queue, (VkQueue)VK_NULL_HANDLE);
+    result = table.QueueWaitIdle(queue);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    table.DestroyDevice(device, nullptr);
+
+    vkDestroyInstance(instance, nullptr);
+}
+
 TEST_F(EnumerateInstanceLayerProperties, PropertyCountLessThanAvailable) {
     uint32_t count = 0u;
     VkResult result = vkEnumerateInstanceLayerProperties(&count, nullptr);
@@ -1640,6 +1797,728 @@ TEST(EnumeratePhysicalDeviceGroupsKHX, TwoCallIncomplete) {
     vkDestroyInstance(instance, nullptr);
 }
 
+#if !defined(_WIN32)
+// Child of the ManifestIndex tests: the loader should report VK_TEST_LAYER_DESCRIPTION for layer VK_TEST_LAYER_NAME
+TEST(DISABLED_ManifestIndexChild, LayerDescription) {
+    char const *name = getenv("VK_TEST_LAYER_NAME");
+    char const *description = getenv("VK_TEST_LAYER_DESCRIPTION");
+    ASSERT_NE(name, nullptr);
+    ASSERT_NE(description, nullptr);
+
+    uint32_t count = 0;
+    ASSERT_EQ(vkEnumerateInstanceLayerProperties(&count, nullptr), VK_SUCCESS);
+    std::vector<VkLayerProperties> properties(count);
+    ASSERT_EQ(vkEnumerateInstanceLayerProperties(&count, properties.data()), VK_SUCCESS);
+
+    auto const layer = std::find_if(properties.begin(), properties.begin() + count,
+                                    [name](VkLayerProperties const &properties) { return !strcmp(properties.layerName, name); });
+    ASSERT_NE(layer, properties.begin() + count);
+    ASSERT_STREQ(layer->description, description);
+}
+
+// The on-disk manifest index (VK_LOADER_MANIFEST_CACHE) is read when a process first scans for manifests, so each step
+// runs in a child process against the same cache directory.
+struct ManifestIndex : public ::testing::Test {
+    void SetUp() override {
+        ASSERT_FALSE(scratch.path.empty());
+        ASSERT_EQ(mkdir((scratch.path + "/layers").c_str(), 0700), 0);
+        index_path = scratch.path + "/cache/vulkan/loader_manifest_cache";
+        // The loader doesn't trust timestamps from the last second, so the manifests are given older ones
+        old_mtime = time(nullptr) - 100;
+        new_mtime = old_mtime + 50;
+    }
+
+    std::string WriteManifest(char const *description, time_t mtime) {
+        std::string const manifest = std::string(
+                                         "{\n"
+                                         "    \"file_format_version\" : \"1.0.0\",\n"
+                                         "    \"layer\" : {\n"
+                                         "        \"name\": \"VK_LAYER_LUNARG_manifest_index_test\",\n"
+                                         "        \"type\": \"GLOBAL\",\n"
+                                         "        \"library_path\": \"libVkLayer_manifest_index_test.so\",\n"
+                                         "        \"api_version\": \"1.0.61\",\n"
+                                         "        \"implementation_version\": \"1\",\n"
+                                         "        \"description\": \"") +
+                                     description +
+                                     "\"\n"
+                                     "    }\n"
+                                     "}\n";
+        std::string const file_path = scratch.Write("layers/manifest_index_test.json", manifest, mtime);
+        ScratchDirectory::SetModificationTime(scratch.path + "/layers", old_mtime);
+        return file_path;
+    }
+
+    // Run the child test in a fresh process with the index enabled and return its exit status
+    int ExpectDescription(char const *description) {
+        return RunChildTest("DISABLED_ManifestIndexChild.LayerDescription",
+                            {"VK_LOADER_MANIFEST_CACHE=1", "XDG_CACHE_HOME=" + scratch.path + "/cache",
+                             "VK_LAYER_PATH=" + scratch.path + "/layers", "VK_TEST_LAYER_NAME=VK_LAYER_LUNARG_manifest_index_test",
+                             std::string("VK_TEST_LAYER_DESCRIPTION=") + description});
+    }
+
+    ScratchDirectory scratch;
+    std::string index_path;
+    time_t old_mtime;
+    time_t new_mtime;
+};
+
+// With an unchanged mtime and size, the manifest text comes from the index rather than the file
+TEST_F(ManifestIndex, UnchangedStampUsesIndex) {
+    WriteManifest("first", old_mtime);
+    ASSERT_EQ(ExpectDescription("first"), 0);
+    ASSERT_NE(ReadFile(index_path).find("\"first\""), std::string::npos);
+
+    WriteManifest("other", old_mtime);
+    ASSERT_EQ(ExpectDescription("first"), 0);
+}
+
+TEST_F(ManifestIndex, ModificationTimeChangeInvalidates) {
+    WriteManifest("first", old_mtime);
+    ASSERT_EQ(ExpectDescription("first"), 0);
+
+    WriteManifest("other", new_mtime);
+    ASSERT_EQ(ExpectDescription("other"), 0);
+    ASSERT_NE(ReadFile(index_path).find("\"other\""), std::string::npos);
+}
+
+TEST_F(ManifestIndex, SizeChangeInvalidates) {
+    WriteManifest("first", old_mtime);
+    ASSERT_EQ(ExpectDescription("first"), 0);
+
+    WriteManifest("longer", old_mtime);
+    ASSERT_EQ(ExpectDescription("longer"), 0);
+}
+
+// A damaged index is ignored, or loses only the entries it can't read, and is rewritten from the manifests
+TEST_F(ManifestIndex, CorruptIndexIsIgnored) {
+    std::string const manifest_path = WriteManifest("first", old_mtime);
+    ASSERT_EQ(ExpectDescription("first"), 0);
+    std::string const magic = "VK_LOADER_MANIFEST_CACHE 1\n";
+    ASSERT_EQ(ReadFile(index_path).compare(0, magic.size(), magic), 0);
+
+    // Not an index at all
+    scratch.Write("cache/vulkan/loader_manifest_cache", "garbage\n");
+    ASSERT_EQ(ExpectDescription("first"), 0);
+    ASSERT_EQ(ReadFile(index_path).compare(0, magic.size(), magic), 0);
+
+    // A record cut off partway through
+    scratch.Write("cache/vulkan/loader_manifest_cache", magic + "F 1 2 300 " + std::to_string(manifest_path.size()) + "\n" +
+                                                             manifest_path + "\n{\"file_format_ver");
+    ASSERT_EQ(ExpectDescription("first"), 0);
+
+    // A complete record whose stamp matches the manifest but whose text is not JSON
+    struct stat st;
+    ASSERT_EQ(stat(manifest_path.c_str(), &st), 0);
+#if defined(__APPLE__)
+    long long const mtime_nsec = st.st_mtimespec.tv_nsec;
+#else
+    long long const mtime_nsec = st.st_mtim.tv_nsec;
+#endif
+    std::string const garbage(static_cast<size_t>(st.st_size), '}');
+    scratch.Write("cache/vulkan/loader_manifest_cache",
+                  magic + "F " + std::to_string((long long)st.st_mtime) + " " + std::to_string(mtime_nsec) + " " +
+                      std::to_string((unsigned long long)st.st_size) + " " + std::to_string(manifest_path.size()) + "\n" +
+                      manifest_path + "\n" + garbage + "\n");
+    ASSERT_EQ(ExpectDescription("first"), 0);
+}
+
+TEST(DISABLED_MissingIcdLibraryChild, EnumerateInstanceExtensionProperties) {
+    // A single call, since every call scans the ICDs again
+    std::vector<VkExtensionProperties> properties(256);
+    uint32_t count = (uint32_t)properties.size();
+    ASSERT_EQ(vkEnumerateInstanceExtensionProperties(nullptr, &count, properties.data()), VK_SUCCESS);
+    ASSERT_GT(count, 0u);
+}
+
+TEST(DISABLED_MissingIcdLibraryChild, CreateInstance) {
+    VkInstance instance = VK_NULL_HANDLE;
+    ASSERT_EQ(vkCreateInstance(VK::InstanceCreateInfo(), VK_NULL_HANDLE, &instance), VK_SUCCESS);
+    uint32_t count = 0;
+    ASSERT_EQ(vkEnumeratePhysicalDevices(instance, &count, nullptr), VK_SUCCESS);
+    ASSERT_GT(count, 0u);
+    vkDestroyInstance(instance, nullptr);
+}
+
+// An ICD manifest whose library_path can't be opened is skipped by the extension query and by vkCreateInstance, and its
+// open failure is reported once per call even though vkCreateInstance walks the ICD list twice.
+struct MissingIcdLibrary : public ::testing::Test {
+    void SetUp() override {
+        ASSERT_FALSE(scratch.path.empty());
+        ASSERT_EQ(mkdir((scratch.path + "/vulkan").c_str(), 0700), 0);
+        ASSERT_EQ(mkdir((scratch.path + "/vulkan/icd.d").c_str(), 0700), 0);
+        library_name = "libVkICD_missing_test.so";
+        std::string const manifest = "{\n"
+                                     "    \"file_format_version\": \"1.0.0\",\n"
+                                     "    \"ICD\": {\n"
+                                     "        \"library_path\": \"" +
+                                     scratch.path + "/" + library_name +
+                                     "\",\n"
+                                     "        \"api_version\": \"1.0.61\"\n"
+                                     "    }\n"
+                                     "}\n";
+        std::string const manifest_path = scratch.Write("vulkan/icd.d/missing_library_test.json", manifest);
+
+        // List the missing ICD first, ahead of the ICDs the rest of the tests use
+        char const *icd_filenames = getenv("VK_ICD_FILENAMES");
+        if (icd_filenames != nullptr && icd_filenames[0] != '\0') {
+            environment.push_back("VK_ICD_FILENAMES=" + manifest_path + ":" + icd_filenames);
+        } else {
+            char const *config_dirs = getenv("XDG_CONFIG_DIRS");
+            environment.push_back("XDG_CONFIG_DIRS=" + scratch.path + ":" +
+                                  (config_dirs != nullptr && config_dirs[0] != '\0' ? config_dirs : "/etc/xdg"));
+        }
+        environment.push_back("VK_LOADER_DEBUG=error");
+    }
+
+    // Run one child test with its stderr captured and return how many lines mention the missing library
+    int CountLogLines(char const *filter) {
+        std::string const log_path = scratch.path + "/stderr.txt";
+        EXPECT_EQ(RunChildTest(filter, environment, log_path.c_str()), 0);
+        std::string const log = ReadFile(log_path);
+        int lines = 0;
+        for (size_t pos = log.find(library_name); pos != std::string::npos; pos = log.find(library_name, pos)) {
+            lines++;
+            pos = log.find('\n', pos);
+        }
+        return lines;
+    }
+
+    ScratchDirectory scratch;
+    std::string library_name;
+    std::vector<std::string> environment;
+};
+
+TEST_F(MissingIcdLibrary, EnumerateInstanceExtensionProperties) {
+    ASSERT_EQ(CountLogLines("DISABLED_MissingIcdLibraryChild.EnumerateInstanceExtensionProperties"), 1);
+}
+
+TEST_F(MissingIcdLibrary, CreateInstance) { ASSERT_EQ(CountLogLines("DISABLED_MissingIcdLibraryChild.CreateInstance"), 1); }
+
+static VKAPI_ATTR VkBool32 VKAPI_CALL CountCacheDrops(VkDebugReportFlagsEXT, VkDebugReportObjectTypeEXT, uint64_t, size_t, int32_t,
+                                                     const char *, const char *message, void *user_data) {
+    if (strstr(message, "ICD list changed") != nullptr) {
+        ++*static_cast<int *>(user_data);
+    }
+    return VK_FALSE;
+}
+
+// Create an instance and return how many times it dropped the device extension cache, along with the first physical
+// device's extensions, which fills the cache
+static int CreateInstanceDroppingCache(std::vector<std::string> &extensions) {
+    int drops = 0;
+    VkDebugReportCallbackCreateInfoEXT callback_info = {VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT};
+    callback_info.flags = VK_DEBUG_REPORT_DEBUG_BIT_EXT;
+    callback_info.pfnCallback = CountCacheDrops;
+    callback_info.pUserData = &drops;
+    VkInstanceCreateInfo instance_info = {VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO};
+    instance_info.pNext = &callback_info;
+    VkInstance instance = VK_NULL_HANDLE;
+    EXPECT_EQ(vkCreateInstance(&instance_info, nullptr, &instance), VK_SUCCESS);
+    uint32_t count = 1;
+    VkPhysicalDevice physical_device = VK_NULL_HANDLE;
+    EXPECT_NE(vkEnumeratePhysicalDevices(instance, &count, &physical_device), VK_ERROR_INITIALIZATION_FAILED);
+    EXPECT_EQ(count, 1u);
+    extensions.clear();
+    if (count == 1 && vkEnumerateDeviceExtensionProperties(physical_device, nullptr, &count, nullptr) == VK_SUCCESS) {
+        std::vector<VkExtensionProperties> properties(count);
+        EXPECT_EQ(vkEnumerateDeviceExtensionProperties(physical_device, nullptr, &count, properties.data()), VK_SUCCESS);
+        for (uint32_t i = 0; i < count; i++) {
+            extensions.push_back(std::string(properties[i].extensionName) + " " + std::to_string(properties[i].specVersion));
+        }
+    }
+    vkDestroyInstance(instance, nullptr);
+    return drops;
+}
+
+// Instances keep using the cached device extensions until VK_ICD_FILENAMES changes to VK_TEST_CHANGED_ICD_FILENAMES
+TEST(DISABLED_DeviceExtensionCacheChild, IcdListChange) {
+    char const *changed = getenv("VK_TEST_CHANGED_ICD_FILENAMES");
+    ASSERT_NE(changed, nullptr);
+    std::vector<std::string> first, again, after_change;
+    CreateInstanceDroppingCache(first);
+    ASSERT_EQ(CreateInstanceDroppingCache(again), 0);
+    ASSERT_EQ(again, first);
+    ASSERT_EQ(setenv("VK_ICD_FILENAMES", changed, 1), 0);
+    ASSERT_EQ(CreateInstanceDroppingCache(after_change), 1);
+    ASSERT_EQ(after_change, first);
+}
+
+// The cache is keyed by ICD library path, so naming the same library by another path is enough to change the ICD list
+// without loading a second driver
+TEST(DeviceExtensionCache, DroppedWhenIcdListChanges) {
+    char const *icd_filenames = getenv("VK_ICD_FILENAMES");
+    if (icd_filenames == nullptr || icd_filenames[0] == '\0') {
+        std::cout << "Skipping: VK_ICD_FILENAMES is not set" << std::endl;
+        return;
+    }
+    std::string const manifest_path = std::string(icd_filenames).substr(0, std::string(icd_filenames).find(':'));
+    std::string manifest = ReadFile(manifest_path);
+    size_t const key = manifest.find("\"library_path\"");
+    size_t const begin = manifest.find('"', manifest.find(':', key) + 1) + 1;
+    size_t const end = manifest.find('"', begin);
+    ASSERT_TRUE(key != std::string::npos && begin != std::string::npos && end != std::string::npos) << manifest_path;
+    std::string library_path = manifest.substr(begin, end - begin);
+    if (library_path.find('/') == std::string::npos) {
+        std::cout << "Skipping: " << manifest_path << " names its library without a path" << std::endl;
+        return;
+    }
+    if (library_path[0] != '/') {
+        std::string const directory = manifest_path.substr(0, manifest_path.rfind('/') + 1) + ".";
+        char *absolute = realpath(directory.c_str(), nullptr);
+        ASSERT_NE(absolute, nullptr) << directory;
+        library_path = std::string(absolute) + "/" + library_path;
+        free(absolute);
+    }
+    manifest.replace(begin, end - begin, "/." + library_path);
+
+    ScratchDirectory scratch;
+    ASSERT_FALSE(scratch.path.empty());
+    std::string const changed_path = scratch.Write("respelled_icd.json", manifest);
+    ASSERT_EQ(RunChildTest("DISABLED_DeviceExtensionCacheChild.IcdListChange", {"VK_TEST_CHANGED_ICD_FILENAMES=" + changed_path}),
+              0);
+}
+
+// More unknown commands than the loader's name index starts with room for, so it has to grow in between lookups
+static const uint32_t unknown_command_count = 100;
+
+static std::string UnknownCommandName(uint32_t i) { return "vkCmdLoaderTestUnknown" + std::to_string(i) + "EXT"; }
+
+TEST(DISABLED_UnknownCommandChild, RepeatLookupReturnsSameTrampoline) {
+    VkInstance instance = VK_NULL_HANDLE;
+    ASSERT_EQ(vkCreateInstance(VK::InstanceCreateInfo(), VK_NULL_HANDLE, &instance), VK_SUCCESS);
+
+    // Nothing supports this one, and asking about it must not use up a trampoline
+    ASSERT_EQ(vkGetInstanceProcAddr(instance, "vkCmdLoaderTestUnsupportedEXT"), nullptr);
+    ASSERT_EQ(vkGetInstanceProcAddr(instance, "vkCmdLoaderTestUnsupportedEXT"), nullptr);
+
+    std::vector<PFN_vkVoidFunction> first(unknown_command_count);
+    for (uint32_t i = 0; i < unknown_command_count; i++) {
+        first[i] = vkGetInstanceProcAddr(instance, UnknownCommandName(i).c_str());
+        ASSERT_NE(first[i], nullptr) << UnknownCommandName(i);
+        ASSERT_EQ(vkGetInstanceProcAddr(instance, UnknownCommandName(i).c_str()), first[i]) << UnknownCommandName(i);
+    }
+    for (uint32_t i = 0; i < unknown_command_count; i++) {
+        ASSERT_EQ(vkGetInstanceProcAddr(instance, UnknownCommandName(i).c_str()), first[i]) << UnknownCommandName(i);
+        for (uint32_t j = 0; j < i; j++) {
+            ASSERT_NE(first[i], first[j]) << UnknownCommandName(i) << " and " << UnknownCommandName(j);
+        }
+    }
+    vkDestroyInstance(instance, nullptr);
+}
+
+// Looking up an unknown device command again returns the trampoline it was given the first time. The commands are
+// listed as device extension entry points of a layer that is found but not enabled, which is enough for the loader to
+// dispatch them.
+TEST(UnknownCommand, RepeatLookupReturnsSameTrampoline) {
+    ScratchDirectory scratch;
+    ASSERT_FALSE(scratch.path.empty());
+    std::string entrypoints;
+    for (uint32_t i = 0; i < unknown_command_count; i++) {
+        entrypoints += (i == 0 ? "\"" : ", \"") + UnknownCommandName(i) + "\"";
+    }
+    scratch.Write("unknown_command_test.json",
+                  "{\"file_format_version\": \"1.1.0\", \"layer\": {\"name\": \"VK_LAYER_LUNARG_unknown_command_test\", "
+                  "\"type\": \"GLOBAL\", \"library_path\": \"libVkLayer_unknown_command_test.so\", \"api_version\": \"1.0.61\", "
+                  "\"implementation_version\": \"1\", \"description\": \"test\", \"device_extensions\": [{\"name\": "
+                  "\"VK_EXT_loader_test_unknown\", \"spec_version\": \"1\", \"entrypoints\": [" +
+                      entrypoints + "]}]}}");
+    ASSERT_EQ(RunChildTest("DISABLED_UnknownCommandChild.RepeatLookupReturnsSameTrampoline", {"VK_LAYER_PATH=" + scratch.path}), 0);
+}
+
+// Check the layers listed, comma separated, in VK_TEST_LAYERS_PRESENT are enumerated and those in VK_TEST_LAYERS_ABSENT
+// are not
+TEST(DISABLED_LayerManifestChild, EnumeratedLayers) {
+    uint32_t count = 0;
+    ASSERT_EQ(vkEnumerateInstanceLayerProperties(&count, nullptr), VK_SUCCESS);
+    std::vector<VkLayerProperties> properties(count);
+    ASSERT_EQ(vkEnumerateInstanceLayerProperties(&count, properties.data()), VK_SUCCESS);
+    auto const enumerated = [&](std::string const &name) {
+        return std::any_of(properties.begin(), properties.begin() + count,
+                           [&](VkLayerProperties const &layer) { return name == layer.layerName; });
+    };
+    struct {
+        char const *variable;
+        bool present;
+    } const expectations[] = {{"VK_TEST_LAYERS_PRESENT", true}, {"VK_TEST_LAYERS_ABSENT", false}};
+    for (auto const &expectation : expectations) {
+        char const *value = getenv(expectation.variable);
+        std::string const names = value != nullptr ? value : "";
+        for (size_t begin = 0, end; begin < names.size(); begin = end + 1) {
+            end = std::min(names.find(',', begin), names.size());
+            ASSERT_EQ(enumerated(names.substr(begin, end - begin)), expectation.present) << names.substr(begin, end - begin);
+        }
+    }
+}
+
+// A manifest holds several layers either in a "layers" array or, in 1.0.0 manifests only, as repeated "layer" objects
+struct LayerManifest : public ::testing::Test {
+    void SetUp() override { ASSERT_FALSE(scratch.path.empty()); }
+
+    static std::string Layer(char const *name) {
+        return std::string("{\"name\": \"") + name +
+               "\", \"type\": \"GLOBAL\", \"library_path\": \"libVkLayer_manifest_test.so\", "
+               "\"api_version\": \"1.0.61\", \"implementation_version\": \"1\", \"description\": \"test\"}";
+    }
+
+    int ExpectLayers(std::string const &manifest, char const *present, char const *absent) {
+        scratch.Write("manifest_test.json", manifest);
+        return RunChildTest("DISABLED_LayerManifestChild.EnumeratedLayers",
+                            {"VK_LAYER_PATH=" + scratch.path, std::string("VK_TEST_LAYERS_PRESENT=") + present,
+                             std::string("VK_TEST_LAYERS_ABSENT=") + absent});
+    }
+
+    ScratchDirectory scratch;
+};
+
+TEST_F(LayerManifest, LayersArray) {
+    ASSERT_EQ(ExpectLayers("{\"file_format_version\": \"1.1.0\", \"layers\": [" + Layer("VK_LAYER_test_a") + ", " +
+                               Layer("VK_LAYER_test_b") + "]}",
+                           "VK_LAYER_test_a,VK_LAYER_test_b", ""),
+              0);
+}
+
+TEST_F(LayerManifest, RepeatedLayerObjects) {
+    ASSERT_EQ(ExpectLayers("{\"file_format_version\": \"1.0.0\", \"layer\": " + Layer("VK_LAYER_test_a") +
+                               ", \"layer\": " + Layer("VK_LAYER_test_b") + "}",
+                           "VK_LAYER_test_a,VK_LAYER_test_b", ""),
+              0);
+}
+
+TEST_F(LayerManifest, RepeatedLayerObjectsInNewerVersionsAreIgnored) {
+    ASSERT_EQ(ExpectLayers("{\"file_format_version\": \"1.1.0\", \"layer\": " + Layer("VK_LAYER_test_a") +
+                               ", \"layer\": " + Layer("VK_LAYER_test_b") + "}",
+                           "", "VK_LAYER_test_a,VK_LAYER_test_b"),
+              0);
+}
+
+TEST_F(LayerManifest, LayersArrayTakesPrecedenceOverLayer) {
+    ASSERT_EQ(ExpectLayers("{\"file_format_version\": \"1.1.0\", \"layer\": " + Layer("VK_LAYER_test_a") +
+                               ", \"layers\": [" + Layer("VK_LAYER_test_b") + "]}",
+                           "VK_LAYER_test_b", "VK_LAYER_test_a"),
+              0);
+}
+
+TEST_F(LayerManifest, TrailingCommaSkipsManifest) {
+    ASSERT_EQ(ExpectLayers("{\"file_format_version\": \"1.1.0\", \"layers\": [" + Layer("VK_LAYER_test_a") + ",]}", "",
+                           "VK_LAYER_test_a"),
+              0);
+}
+
+#if defined(VK_TEST_TEST_LAYERS_BINARY_DIR)
+static bool InTestInterceptedLayer(PFN_vkVoidFunction function) {
+    Dl_info info;
+    return function != nullptr && dladdr(reinterpret_cast<void *>(function), &info) != 0 && info.dli_fname != nullptr &&
+           strstr(info.dli_fname, "libVkLayer_test_intercepted") != nullptr;
+}
+
+TEST(DISABLED_InterceptedFunctionsChild, UnlistedCommandBypassesLayer) {
+    char const *const names[] = {"VK_LAYER_LUNARG_test_intercepted"};
+    VkInstance instance = VK_NULL_HANDLE;
+    ASSERT_EQ(vkCreateInstance(VK::InstanceCreateInfo().enabledLayerCount(1).ppEnabledLayerNames(names), VK_NULL_HANDLE, &instance),
+              VK_SUCCESS);
+    uint32_t count = 1;
+    VkPhysicalDevice physical_device = VK_NULL_HANDLE;
+    ASSERT_NE(vkEnumeratePhysicalDevices(instance, &count, &physical_device), VK_ERROR_INITIALIZATION_FAILED);
+    ASSERT_EQ(count, 1u);
+    float const priorities[] = {0.0f};
+    VkDeviceQueueCreateInfo const queue_info[1]{
+        VK::DeviceQueueCreateInfo().queueFamilyIndex(0).queueCount(1).pQueuePriorities(priorities)};
+    VkDevice device = VK_NULL_HANDLE;
+    ASSERT_EQ(vkCreateDevice(physical_device, VK::DeviceCreateInfo().queueCreateInfoCount(1).pQueueCreateInfos(queue_info),
+                             nullptr, &device),
+              VK_SUCCESS);
+
+    // The layer returns its own vkCmdDraw and vkCmdDispatch, but only lists vkCmdDraw in its manifest
+    VkLayerDispatchTable table;
+    ASSERT_EQ(vk_loaderGetDeviceDispatchTable(device, sizeof(table), &table), VK_SUCCESS);
+    EXPECT_TRUE(InTestInterceptedLayer(vkGetDeviceProcAddr(device, "vkCmdDraw")));
+    EXPECT_TRUE(InTestInterceptedLayer(reinterpret_cast<PFN_vkVoidFunction>(table.CmdDraw)));
+    EXPECT_FALSE(InTestInterceptedLayer(vkGetDeviceProcAddr(device, "vkCmdDispatch")));
+    EXPECT_FALSE(InTestInterceptedLayer(reinterpret_cast<PFN_vkVoidFunction>(table.CmdDispatch)));
+
+    vkDestroyDevice(device, nullptr);
+    vkDestroyInstance(instance, nullptr);
+}
+
+// Device commands a layer doesn't list in its manifest's intercepted_functions go past it, even if the layer would
+// return its own function for them
+TEST(InterceptedFunctions, UnlistedCommandBypassesLayer) {
+    ASSERT_EQ(RunChildTest("DISABLED_InterceptedFunctionsChild.UnlistedCommandBypassesLayer",
+                           {"VK_LAYER_PATH=" VK_TEST_TEST_LAYERS_BINARY_DIR}),
+              0);
+}
+#endif
+
+#if defined(__GLIBC__)
+// The loader formats its messages with vsnprintf and nothing else in it does, so counting the calls made by this
+// process counts the messages the loader formatted
+static int formatted_messages = 0;
+
+// Looked up before any test runs, since calling dlsym would discard a dlerror() string the loader is formatting
+static auto const next_vsnprintf = reinterpret_cast<int (*)(char *, size_t, const char *, va_list)>(dlsym(RTLD_NEXT, "vsnprintf"));
+
+extern "C" int vsnprintf(char *buffer, size_t size, const char *format, va_list ap) __THROWNL {
+    formatted_messages++;
+    return next_vsnprintf(buffer, size, format, ap);
+}
+
+static VKAPI_ATTR VkBool32 VKAPI_CALL CountLoaderMessage(VkDebugReportFlagsEXT, VkDebugReportObjectTypeEXT, uint64_t, size_t,
+                                                        int32_t, const char *layer_prefix, const char *, void *user_data) {
+    if (strcmp(layer_prefix, "loader") == 0) {
+        ++*static_cast<int *>(user_data);
+    }
+    return VK_FALSE;
+}
+
+// Create an instance with a debug report callback for the VkDebugReportFlagsEXT in VK_TEST_CALLBACK_FLAGS and check
+// that the loader formatted exactly the messages the callback received
+TEST(DISABLED_LoaderLogChild, FormattedMessages) {
+    char const *flags = getenv("VK_TEST_CALLBACK_FLAGS");
+    ASSERT_NE(flags, nullptr);
+    int callback_messages = 0;
+    VkDebugReportCallbackCreateInfoEXT callback_info = {VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT};
+    callback_info.flags = (VkDebugReportFlagsEXT)strtoul(flags, nullptr, 0);
+    callback_info.pfnCallback = CountLoaderMessage;
+    callback_info.pUserData = &callback_messages;
+    VkInstanceCreateInfo instance_info = {VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO};
+    instance_info.pNext = &callback_info;
+
+    formatted_messages = 0;
+    VkInstance instance = VK_NULL_HANDLE;
+    ASSERT_EQ(vkCreateInstance(&instance_info, nullptr, &instance), VK_SUCCESS);
+    uint32_t count = 0;
+    ASSERT_EQ(vkEnumeratePhysicalDevices(instance, &count, nullptr), VK_SUCCESS);
+    vkDestroyInstance(instance, nullptr);
+    int const formatted = formatted_messages;
+
+    if (callback_info.flags & VK_DEBUG_REPORT_INFORMATION_BIT_EXT) {
+        ASSERT_GT(callback_messages, 0);
+    }
+    ASSERT_EQ(formatted, callback_messages);
+}
+
+// Messages that neither VK_LOADER_DEBUG nor a debug report callback asks for are dropped before they are formatted
+TEST(LoaderLog, FilteredMessagesAreNotFormatted) {
+    ASSERT_EQ(RunChildTest("DISABLED_LoaderLogChild.FormattedMessages",
+                           {"VK_LOADER_DEBUG=error", "VK_TEST_CALLBACK_FLAGS=" + std::to_string(VK_DEBUG_REPORT_ERROR_BIT_EXT)}),
+              0);
+}
+
+TEST(LoaderLog, WantedMessagesAreFormattedOnce) {
+    ASSERT_EQ(RunChildTest("DISABLED_LoaderLogChild.FormattedMessages",
+                           {"VK_LOADER_DEBUG=error", "VK_TEST_CALLBACK_FLAGS=" +
+                                                         std::to_string(VK_DEBUG_REPORT_INFORMATION_BIT_EXT |
+                                                                        VK_DEBUG_REPORT_DEBUG_BIT_EXT)}),
+              0);
+}
+#endif
+
+#if defined(VK_TEST_LOADER_SOURCE_DIR)
+TEST(DISABLED_LoaderLogChild, CreateInstance) {
+    VkInstance instance = VK_NULL_HANDLE;
+    ASSERT_EQ(vkCreateInstance(VK::InstanceCreateInfo(), VK_NULL_HANDLE, &instance), VK_SUCCESS);
+    uint32_t count = 0;
+    ASSERT_EQ(vkEnumeratePhysicalDevices(instance, &count, nullptr), VK_SUCCESS);
+    vkDestroyInstance(instance, nullptr);
+}
+
+// scripts/loader_trace_decode.py turns a VK_LOADER_TRACE file back into the text VK_LOADER_DEBUG=all prints
+TEST(LoaderLog, TraceDecodesToDebugOutput) {
+    ScratchDirectory scratch;
+    ASSERT_FALSE(scratch.path.empty());
+    std::string const trace_path = scratch.path + "/trace";
+    std::string const stderr_path = scratch.path + "/stderr.txt";
+    std::string const decoded_path = scratch.path + "/decoded.txt";
+    ASSERT_EQ(RunChildTest("DISABLED_LoaderLogChild.CreateInstance", {"VK_LOADER_DEBUG=all", "VK_LOADER_TRACE=" + trace_path},
+                           stderr_path.c_str()),
+              0);
+
+    std::string const command = std::string("python3 " VK_TEST_LOADER_SOURCE_DIR "/../scripts/loader_trace_decode.py ") +
+                                trace_path + " > " + decoded_path;
+    ASSERT_EQ(system(command.c_str()), 0) << command;
+    std::string const expected = ReadFile(stderr_path);
+    ASSERT_NE(expected.find("INFO: "), std::string::npos);
+    ASSERT_EQ(ReadFile(decoded_path), expected);
+}
+#endif
+#endif
+
+static bool ValidateJson(std::string const &text) { return json_reader_validate(text.c_str(), text.size()); }
+
+// Read text, a single JSON value, with json_reader_read_string into a buffer of dst_size bytes
+static std::string ReadJsonString(std::string const &text, size_t dst_size) {
+    std::vector<char> dst(dst_size, 'x');
+    struct json_reader reader;
+    json_reader_init(&reader, text.c_str(), text.size());
+    EXPECT_TRUE(json_reader_read_string(&reader, dst.data(), dst.size()));
+    return std::string(dst.data());
+}
+
+TEST(JsonReader, TruncatedInputIsRejected) {
+    std::string const manifest =
+        "{\"file_format_version\": \"1.0.0\", \"layer\": {\"name\": \"VK_LAYER_test\", \"spec_version\": 6, "
+        "\"instance_extensions\": [{\"name\": \"VK_EXT_debug_report\", \"spec_version\": \"6\"}], \"enabled\": true}}";
+    ASSERT_TRUE(ValidateJson(manifest));
+    for (size_t len = 0; len < manifest.size(); len++) {
+        ASSERT_FALSE(json_reader_validate(manifest.c_str(), len)) << manifest.substr(0, len);
+    }
+    ASSERT_FALSE(ValidateJson("\"\\u12"));
+    ASSERT_FALSE(ValidateJson("\"abc\\"));
+}
+
+TEST(JsonReader, MalformedInputIsRejected) {
+    char const *const malformed[] = {
+        "",           "}",           "{\"a\" 1}", "{\"a\": 1 \"b\": 2}", "{a: 1}",  "[1 2]", "{\"a\": tru}",
+        "{\"a\": nul}", "[1, , 2]", "{\"a\": }",   "[\"\\uZZZZ\"]",        "{1: 2}", "[}",    "{]",
+    };
+    for (auto const text : malformed) {
+        ASSERT_FALSE(ValidateJson(text)) << text;
+    }
+    // Like cJSON, anything after the first complete value is ignored
+    ASSERT_TRUE(ValidateJson("{\"a\": [1, 2.5e3, -1, true, false, null]} trailing"));
+}
+
+TEST(JsonReader, TrailingCommaIsRejected) {
+    ASSERT_FALSE(ValidateJson("{\"a\": 1,}"));
+    ASSERT_FALSE(ValidateJson("{\"a\": 1 , }"));
+    ASSERT_FALSE(ValidateJson("[1, 2,]"));
+    ASSERT_FALSE(ValidateJson("[,]"));
+    ASSERT_FALSE(ValidateJson("{\"a\": [\"b\",]}"));
+    ASSERT_TRUE(ValidateJson("{\"a\": 1, \"b\": [1, 2]}"));
+
+    // The comma is rejected by the call that consumes it, not left for the caller to trip over
+    struct json_reader reader;
+    std::string const text = "[1, 2,]";
+    json_reader_init(&reader, text.c_str(), text.size());
+    ASSERT_EQ(json_reader_count_elements(&reader), 2u);
+    ASSERT_TRUE(json_reader_begin_array(&reader));
+    for (int i = 0; i < 2; i++) {
+        ASSERT_TRUE(json_reader_next_element(&reader));
+        ASSERT_TRUE(json_reader_skip(&reader));
+    }
+    ASSERT_FALSE(json_reader_next_element(&reader));
+    ASSERT_TRUE(reader.failed);
+
+    std::string const object = "{\"a\": 1,}";
+    char const *key;
+    size_t key_len;
+    json_reader_init(&reader, object.c_str(), object.size());
+    ASSERT_TRUE(json_reader_begin_object(&reader));
+    ASSERT_TRUE(json_reader_next_member(&reader, &key, &key_len));
+    ASSERT_TRUE(json_reader_skip(&reader));
+    ASSERT_FALSE(json_reader_next_member(&reader, &key, &key_len));
+    ASSERT_TRUE(reader.failed);
+}
+
+TEST(JsonReader, UnicodeEscapes) {
+    ASSERT_EQ(ReadJsonString("\"a\\u0041\"", 64), "aA");
+    ASSERT_EQ(ReadJsonString("\"\\u00e9\"", 64), "\xc3\xa9");
+    ASSERT_EQ(ReadJsonString("\"\\u20AC\"", 64), "\xe2\x82\xac");
+    // U+1F600 as a surrogate pair
+    ASSERT_EQ(ReadJsonString("\"\\ud83d\\ude00\"", 64), "\xf0\x9f\x98\x80");
+    ASSERT_EQ(ReadJsonString("\"\\uDBFF\\uDFFF\"", 64), "\xf4\x8f\xbf\xbf");
+
+    // A high surrogate needs an escaped low surrogate right after it
+    ASSERT_FALSE(ValidateJson("\"\\ud83d\""));
+    ASSERT_FALSE(ValidateJson("\"\\ud83dx\""));
+    ASSERT_FALSE(ValidateJson("\"\\ud83d\\u0041\""));
+    ASSERT_FALSE(ValidateJson("\"\\ud83d\\ud83d\""));
+}
+
+TEST(JsonReader, UnquotedSpecVersion) {
+    std::string const text = "{\"name\": \"VK_EXT_debug_report\", \"spec_version\": 6}";
+    struct json_reader reader;
+    char const *key;
+    size_t key_len;
+    char value[16];
+    bool found = false;
+    json_reader_init(&reader, text.c_str(), text.size());
+    ASSERT_TRUE(json_reader_begin_object(&reader));
+    while (json_reader_next_member(&reader, &key, &key_len)) {
+        if (json_reader_key_equals(key, key_len, "spec_version")) {
+            ASSERT_EQ(json_reader_peek(&reader), JSON_READER_NUMBER);
+            ASSERT_TRUE(json_reader_read_string(&reader, value, sizeof(value)));
+            found = true;
+        } else {
+            ASSERT_TRUE(json_reader_skip(&reader));
+        }
+    }
+    ASSERT_TRUE(found);
+    ASSERT_STREQ(value, "6");
+    ASSERT_FALSE(reader.failed);
+}
+
+// Strings too long for the buffer are cut to the longest prefix that fits, never splitting a UTF-8 sequence or
+// leaving one out and carrying on after it
+TEST(JsonReader, OverLongStringsAreTruncatedToAPrefix) {
+    ASSERT_EQ(ReadJsonString("\"abcdefghij\"", 8), "abcdefg");
+    ASSERT_EQ(ReadJsonString("\"abcdefg\"", 8), "abcdefg");
+    ASSERT_EQ(ReadJsonString("\"abcdef\\u00e9g\"", 8), "abcdef");
+    ASSERT_EQ(ReadJsonString("\"abcde\\ud83d\\ude00fg\"", 8), "abcde");
+    ASSERT_EQ(ReadJsonString("\"abcdefghij\"", 1), "");
+
+    // The rest of the string is still consumed
+    std::string const text = "[\"abcdef\\u00e9g\", \"next\"]";
+    struct json_reader reader;
+    char value[8];
+    json_reader_init(&reader, text.c_str(), text.size());
+    ASSERT_TRUE(json_reader_begin_array(&reader));
+    ASSERT_TRUE(json_reader_next_element(&reader));
+    ASSERT_TRUE(json_reader_read_string(&reader, value, sizeof(value)));
+    ASSERT_TRUE(json_reader_next_element(&reader));
+    ASSERT_TRUE(json_reader_read_string(&reader, value, sizeof(value)));
+    ASSERT_STREQ(value, "next");
+    ASSERT_FALSE(json_reader_next_element(&reader));
+    ASSERT_FALSE(reader.failed);
+}
+
+#if defined(VK_TEST_LOADER_BINARY_DIR)
+// Return the quoted names of the entries of the table whose definition contains declaration in the file at file_path, in
+// the order they appear. Entries are one per line, starting with {"name", and may be wrapped in #ifdef lines.
+static std::vector<std::string> ReadTableNames(std::string const &file_path, char const *declaration) {
+    std::vector<std::string> names;
+    std::string const contents = ReadFile(file_path);
+    size_t pos = contents.find(declaration);
+    if (pos == std::string::npos) {
+        return names;
+    }
+    pos = contents.find('\n', pos);
+    while (pos != std::string::npos && contents.compare(pos + 1, 2, "};") != 0) {
+        size_t const begin = contents.find_first_not_of(" \t", pos + 1);
+        pos = contents.find('\n', pos + 1);
+        if (begin != std::string::npos && contents.compare(begin, 2, "{\"") == 0) {
+            size_t const end = contents.find('"', begin + 2);
+            names.push_back(contents.substr(begin + 2, end - begin - 2));
+        }
+    }
+    return names;
+}
+
+// The entry point tables the loader and layers bsearch() or util_FindEntryByName() must be in strcmp() order
+TEST(GeneratedTables, SortedByName) {
+    struct {
+        std::string file_path;
+        char const *declaration;
+    } const tables[] = {
+        {VK_TEST_LOADER_SOURCE_DIR "/gpa_helper.h", "trampoline_core_commands[] = {"},
+        {VK_TEST_LOADER_BINARY_DIR "/vk_loader_extensions.c", "loader_device_dispatch_names[] = {"},
+        {VK_TEST_LOADER_BINARY_DIR "/vk_loader_extensions.c", "loader_instance_dispatch_names[] = {"},
+        {VK_TEST_LOADER_BINARY_DIR "/vk_loader_extensions.c", "extension_instance_gpa_entries[] = {"},
+        {VK_TEST_LAYERS_BINARY_DIR "/parameter_validation.h", "procmap[] = {"},
+        {VK_TEST_LAYERS_BINARY_DIR "/thread_check.h", "procmap[] = {"},
+        {VK_TEST_LAYERS_BINARY_DIR "/unique_objects_wrappers.h", "procmap[] = {"},
+    };
+    for (auto const &table : tables) {
+        std::vector<std::string> const names = ReadTableNames(table.file_path, table.declaration);
+        ASSERT_GT(names.size(), 10u) << table.declaration << " in " << table.file_path;
+        for (size_t i = 1; i < names.size(); i++) {
+            ASSERT_LT(strcmp(names[i - 1].c_str(), names[i].c_str()), 0)
+                << table.declaration << " in " << table.file_path << ": " << names[i - 1] << " before " << names[i];
+        }
+    }
+}
+#endif
+
 int main(int argc, char **argv) {
     int result;
 